@@ -0,0 +1,99 @@
+#include "admission_control.h"
+
+#define TOKEN_UNIT 1000
+#define BUDGET_MAX_US ((int32_t)ADMISSION_BUDGET_MS * 1000)
+
+AdmissionControl::AdmissionControl() {
+    memset(clients, 0, sizeof(clients));
+    budgetUs = BUDGET_MAX_US;
+    budgetRefill = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+ClientBucket* AdmissionControl::findClient(uint32_t ip, unsigned long now) {
+    ClientBucket* oldest = &clients[0];
+    for (int i = 0; i < ADMISSION_CLIENTS; i++) {
+        if (clients[i].ip == ip) {
+            return &clients[i];
+        }
+        if (clients[i].ip == 0) {
+            oldest = &clients[i];
+            break;
+        }
+        if (clients[i].lastRefill < oldest->lastRefill) {
+            oldest = &clients[i];
+        }
+    }
+
+    // 新客户端：占用空位或淘汰最久未访问的记录，令牌桶从满开始
+    if (oldest->ip != 0) {
+        stats.evicted++;
+    }
+    memset(oldest, 0, sizeof(ClientBucket));
+    oldest->ip = ip;
+    oldest->tokens = ADMISSION_CLIENT_BURST * TOKEN_UNIT;
+    oldest->lastRefill = now;
+    return oldest;
+}
+
+void AdmissionControl::refillBudget(unsigned long now) {
+    unsigned long elapsed = now - budgetRefill;
+    budgetRefill = now;
+
+    // 每经过 1ms 恢复 ADMISSION_HTTP_SHARE% 毫秒的预算
+    int32_t refill = elapsed > (unsigned long)ADMISSION_BUDGET_MS * 100
+                     ? BUDGET_MAX_US * 2
+                     : (int32_t)(elapsed * ADMISSION_HTTP_SHARE * 10);
+    budgetUs = min(budgetUs + refill, BUDGET_MAX_US);
+}
+
+AdmissionResult AdmissionControl::admit(uint32_t ip, uint32_t* retryAfter) {
+    unsigned long now = millis();
+    *retryAfter = 0;
+
+    // 先检查全局预算：超出时不论来源都拒绝
+    refillBudget(now);
+    if (budgetUs < 0) {
+        stats.shedBusy++;
+        uint32_t waitMs = (uint32_t)(-budgetUs) / (ADMISSION_HTTP_SHARE * 10) + 1;
+        *retryAfter = (waitMs + 999) / 1000;
+        return SHED_BUSY;
+    }
+
+    ClientBucket* client = findClient(ip, now);
+    uint32_t elapsed = now - client->lastRefill;
+    client->lastRefill = now;
+    uint32_t capacity = ADMISSION_CLIENT_BURST * TOKEN_UNIT;
+    uint32_t refill = elapsed >= capacity / ADMISSION_CLIENT_RATE ? capacity : elapsed * ADMISSION_CLIENT_RATE;
+    client->tokens = min(client->tokens + refill, capacity);
+
+    if (client->tokens < TOKEN_UNIT) {
+        client->shed++;
+        stats.shedClient++;
+        uint32_t waitMs = (TOKEN_UNIT - client->tokens) / ADMISSION_CLIENT_RATE + 1;
+        *retryAfter = (waitMs + 999) / 1000;
+        return SHED_CLIENT;
+    }
+
+    client->tokens -= TOKEN_UNIT;
+    client->admitted++;
+    stats.admitted++;
+    return ADMIT;
+}
+
+void AdmissionControl::charge(unsigned long elapsedUs) {
+    unsigned long elapsedMs = elapsedUs / 1000;
+    stats.busyMs += elapsedMs;
+    if (elapsedMs > stats.maxRequestMs) {
+        stats.maxRequestMs = elapsedMs;
+    }
+
+    // 单个请求（如固件上传）最多扣除一个完整预算，避免之后长时间拒绝服务
+    refillBudget(millis());
+    budgetUs -= (int32_t)min(elapsedUs, (unsigned long)BUDGET_MAX_US);
+}
+
+int32_t AdmissionControl::getBudgetMs() {
+    refillBudget(millis());
+    return budgetUs / 1000;
+}
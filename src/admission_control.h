@@ -0,0 +1,59 @@
+#ifndef ADMISSION_CONTROL_H
+#define ADMISSION_CONTROL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// 准入结果
+enum AdmissionResult {
+    ADMIT,
+    SHED_CLIENT,                    // 单个客户端超出速率，回复 429
+    SHED_BUSY                       // Web 请求占用时间超出预算，回复 503
+};
+
+// 每个客户端的令牌桶
+struct ClientBucket {
+    uint32_t ip;                    // 0 表示空位
+    uint32_t tokens;                // 千分之一个请求为单位
+    unsigned long lastRefill;
+    unsigned long admitted;
+    unsigned long shed;
+};
+
+struct AdmissionStats {
+    unsigned long admitted;
+    unsigned long shedClient;       // 429 次数
+    unsigned long shedBusy;         // 503 次数
+    unsigned long evicted;          // 客户端表满时淘汰的记录数
+    unsigned long busyMs;           // 处理请求累计耗时
+    unsigned long maxRequestMs;     // 单个请求最长耗时
+};
+
+// 准入控制：请求行解析后、读取请求头和请求体之前决定是否处理。
+// 每个客户端（按 IP）一个令牌桶限制请求速率；全局用处理时间作预算，
+// 预算按 ADMISSION_HTTP_SHARE 的比例随时间恢复，保证 Web 请求平均占用的时间不超过该比例，
+// 主循环中的定时器更新总能得到剩余的时间。
+class AdmissionControl {
+private:
+    ClientBucket clients[ADMISSION_CLIENTS];
+    int32_t budgetUs;               // 剩余时间预算（微秒），处理请求后扣除实际耗时
+    unsigned long budgetRefill;
+    AdmissionStats stats;
+
+    ClientBucket* findClient(uint32_t ip, unsigned long now);
+    void refillBudget(unsigned long now);
+
+public:
+    AdmissionControl();
+
+    // retryAfter 返回建议的重试等待秒数
+    AdmissionResult admit(uint32_t ip, uint32_t* retryAfter);
+    // 请求处理完成后按实际耗时扣除预算
+    void charge(unsigned long elapsedUs);
+
+    int32_t getBudgetMs();
+    const AdmissionStats& getStats() const { return stats; }
+    const ClientBucket* getClients() const { return clients; }
+};
+
+#endif
@@ -0,0 +1,349 @@
+#include "archive_manager.h"
+#include "logger.h"
+
+#define ARCHIVE_DIR "/archive"
+#define ARCHIVE_HEADER_SIZE 8
+#define ARCHIVE_MAX_RECORD_SIZE 24
+
+static size_t writeVarint(uint8_t* out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        out[n++] = (v & 0x7F) | 0x80;
+        v >>= 7;
+    }
+    out[n++] = v;
+    return n;
+}
+
+static uint32_t zigzag(int32_t v) {
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+static int32_t unzigzag(uint32_t v) {
+    return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// 按小块缓冲顺序读取块文件，导出时不把整个文件读入内存
+class BlockReader {
+private:
+    File& file;
+    uint8_t buf[64];
+    int len;
+    int pos;
+    
+public:
+    BlockReader(File& f) : file(f), len(0), pos(0) {}
+    
+    int next() {
+        if (pos >= len) {
+            len = file.read(buf, sizeof(buf));
+            pos = 0;
+            if (len <= 0) return -1;
+        }
+        return buf[pos++];
+    }
+    
+    bool readVarint(uint32_t& v) {
+        v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            int b = next();
+            if (b < 0) return false;
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+    
+    bool readUInt32LE(uint32_t& v) {
+        v = 0;
+        for (int i = 0; i < 4; i++) {
+            int b = next();
+            if (b < 0) return false;
+            v |= (uint32_t)b << (8 * i);
+        }
+        return true;
+    }
+};
+
+// 解码后的归档记录
+struct ArchivedRecord {
+    uint32_t epoch;
+    uint32_t timerId;
+    uint32_t actualMs;
+    uint32_t requestedMs;
+    uint32_t pwmValue;
+    uint8_t pin;
+    uint8_t source;
+};
+
+static bool readBlockHeader(BlockReader& reader, uint32_t& baseEpoch) {
+    if (reader.next() != 'P' || reader.next() != 'A' || reader.next() != 1 || reader.next() < 0) {
+        return false;
+    }
+    return reader.readUInt32LE(baseEpoch);
+}
+
+static bool readRecord(BlockReader& reader, uint32_t& prevEpoch, ArchivedRecord& r) {
+    int head = reader.next();
+    if (head < 0) return false;
+    r.pin = head & 0x1F;
+    r.source = (head >> 5) & 0x03;
+    r.epoch = 0;
+    if (!(head & 0x80)) {
+        uint32_t delta;
+        if (!reader.readVarint(delta)) return false;
+        prevEpoch += unzigzag(delta);
+        r.epoch = prevEpoch;
+    }
+    uint32_t diff;
+    if (!reader.readVarint(r.timerId) || !reader.readVarint(r.actualMs) ||
+        !reader.readVarint(diff) || !reader.readVarint(r.pwmValue)) {
+        return false;
+    }
+    r.requestedMs = r.actualMs - unzigzag(diff);
+    return true;
+}
+
+ArchiveManager::ArchiveManager() {
+    history = nullptr;
+    mounted = false;
+    firstBlock = 0;
+    lastBlock = 0;
+    blockCount = 0;
+    lastBlockSize = 0;
+    closedBytes = 0;
+    lastEpoch = 0;
+    archivedSeq = 0;
+    lastFlush = 0;
+    recordsWritten = 0;
+    recordsLost = 0;
+}
+
+bool ArchiveManager::begin(HistoryManager* hm) {
+    history = hm;
+    
+    if (!LittleFS.begin()) {
+        LOG_ERROR("LittleFS 挂载失败，激活归档不可用");
+        return false;
+    }
+    mounted = true;
+    
+    if (!LittleFS.exists(ARCHIVE_DIR)) {
+        LittleFS.mkdir(ARCHIVE_DIR);
+    }
+    
+    // 按文件名（块编号）找出最旧和最新的块
+    Dir dir = LittleFS.openDir(ARCHIVE_DIR);
+    while (dir.next()) {
+        uint32_t block = strtoul(dir.fileName().c_str(), nullptr, 10);
+        if (blockCount == 0 || block < firstBlock) firstBlock = block;
+        if (blockCount == 0 || block > lastBlock) lastBlock = block;
+        blockCount++;
+        closedBytes += dir.fileSize();
+    }
+    
+    if (blockCount > 0) {
+        scanLastBlock();
+        closedBytes -= min(closedBytes, lastBlockSize);
+    }
+    
+    lastFlush = millis();
+    LOG_INFO("激活归档已加载 %lu 个块", (unsigned long)blockCount);
+    return true;
+}
+
+void ArchiveManager::blockPath(uint32_t block, char* path, size_t len) {
+    snprintf(path, len, ARCHIVE_DIR "/%06lu", (unsigned long)block);
+}
+
+void ArchiveManager::scanLastBlock() {
+    // 恢复当前块的大小和最后时间戳，后续记录才能继续差值编码
+    char path[32];
+    blockPath(lastBlock, path, sizeof(path));
+    File f = LittleFS.open(path, "r");
+    if (!f) {
+        lastBlockSize = ARCHIVE_BLOCK_SIZE; // 打不开则下次直接换新块
+        return;
+    }
+    lastBlockSize = f.size();
+    
+    BlockReader reader(f);
+    uint32_t epoch = 0;
+    if (readBlockHeader(reader, epoch)) {
+        ArchivedRecord r;
+        while (readRecord(reader, epoch, r)) {
+        }
+        lastEpoch = epoch;
+    } else {
+        lastBlockSize = ARCHIVE_BLOCK_SIZE;
+    }
+    f.close();
+}
+
+bool ArchiveManager::startBlock(uint32_t baseEpoch) {
+    if (blockCount > 0) {
+        closedBytes += lastBlockSize;
+        lastBlock++;
+    }
+    
+    char path[32];
+    blockPath(lastBlock, path, sizeof(path));
+    File f = LittleFS.open(path, "w");
+    if (!f) return false;
+    
+    uint8_t header[ARCHIVE_HEADER_SIZE] = {'P', 'A', 1, 0,
+                                           (uint8_t)baseEpoch, (uint8_t)(baseEpoch >> 8),
+                                           (uint8_t)(baseEpoch >> 16), (uint8_t)(baseEpoch >> 24)};
+    f.write(header, sizeof(header));
+    f.close();
+    
+    if (blockCount == 0) firstBlock = lastBlock;
+    blockCount++;
+    lastBlockSize = ARCHIVE_HEADER_SIZE;
+    lastEpoch = baseEpoch;
+    
+    // 超出容量时轮转，删除最旧的块
+    while (blockCount > ARCHIVE_MAX_BLOCKS) {
+        blockPath(firstBlock, path, sizeof(path));
+        File old = LittleFS.open(path, "r");
+        if (old) {
+            closedBytes -= min(closedBytes, (size_t)old.size());
+            old.close();
+        }
+        LittleFS.remove(path);
+        firstBlock++;
+        blockCount--;
+    }
+    return true;
+}
+
+size_t ArchiveManager::encodeRecord(const ActivationRecord& r, uint8_t* out) {
+    size_t n = 0;
+    bool hasTime = r.epochStart != 0;
+    out[n++] = (r.pin & 0x1F) | ((r.source & 0x03) << 5) | (hasTime ? 0 : 0x80);
+    if (hasTime) {
+        n += writeVarint(out + n, zigzag((int32_t)(r.epochStart - lastEpoch)));
+        lastEpoch = r.epochStart;
+    }
+    n += writeVarint(out + n, r.timerId);
+    n += writeVarint(out + n, r.actualMs);
+    n += writeVarint(out + n, zigzag((int32_t)(r.actualMs - r.requestedMs)));
+    n += writeVarint(out + n, r.pwmValue);
+    return n;
+}
+
+void ArchiveManager::update() {
+    if (!mounted || !history) return;
+    
+    // 攒够一批或等待超时后才写入，减少闪存写入次数
+    uint32_t pending = getPendingCount();
+    if (pending == 0) {
+        lastFlush = millis();
+        return;
+    }
+    if (pending < ARCHIVE_BATCH_SIZE && millis() - lastFlush < ARCHIVE_FLUSH_INTERVAL) {
+        return;
+    }
+    flush();
+}
+
+void ArchiveManager::flush() {
+    if (!mounted || !history) return;
+    lastFlush = millis();
+    
+    uint32_t latest = history->getLastSeq();
+    uint32_t oldest = history->getOldestSeq();
+    if (oldest > archivedSeq + 1) {
+        recordsLost += oldest - archivedSeq - 1;
+        archivedSeq = oldest - 1;
+    }
+    
+    uint8_t buf[ARCHIVE_BATCH_SIZE * ARCHIVE_MAX_RECORD_SIZE];
+    while (archivedSeq < latest) {
+        File f;
+        size_t len = 0;
+        
+        // 一个批次只写入同一个块
+        while (archivedSeq < latest && len + ARCHIVE_MAX_RECORD_SIZE <= sizeof(buf)) {
+            const ActivationRecord* r = history->get(archivedSeq + 1);
+            if (!r) break;
+            if (blockCount == 0 || lastBlockSize + len >= ARCHIVE_BLOCK_SIZE) {
+                if (len > 0) break;
+                if (!startBlock(r->epochStart)) return;
+            }
+            len += encodeRecord(*r, buf + len);
+            archivedSeq++;
+            recordsWritten++;
+        }
+        if (len == 0) break;
+        
+        char path[32];
+        blockPath(lastBlock, path, sizeof(path));
+        f = LittleFS.open(path, "a");
+        if (!f) return;
+        f.write(buf, len);
+        f.close();
+        lastBlockSize += len;
+    }
+}
+
+size_t ArchiveManager::exportCSV(uint32_t from, uint32_t to, Print& out) {
+    if (!mounted) return 0;
+    
+    size_t rows = 0;
+    char line[96];
+    out.print("epoch,timerId,pin,source,requestedMs,actualMs,pwmValue\n");
+    
+    for (uint32_t block = firstBlock; blockCount > 0 && block <= lastBlock; block++) {
+        char path[32];
+        blockPath(block, path, sizeof(path));
+        File f = LittleFS.open(path, "r");
+        if (!f) continue;
+        
+        BlockReader reader(f);
+        uint32_t epoch = 0;
+        if (readBlockHeader(reader, epoch)) {
+            // 记录按运行结束的顺序追加，但时间戳是开始时间：长时间的运行可能落在基准时间晚于 to 的块中，
+            // 块内和块之间的开始时间都不单调，因此不按块跳过，逐条过滤
+            ArchivedRecord r;
+            while (readRecord(reader, epoch, r)) {
+                if (r.epoch != 0 && (r.epoch < from || (to != 0 && r.epoch > to))) continue;
+                if (r.epoch == 0 && from != 0) continue;
+                snprintf(line, sizeof(line), "%lu,%lu,%u,%s,%lu,%lu,%lu\n",
+                         (unsigned long)r.epoch, (unsigned long)r.timerId, r.pin, triggerSourceName(r.source),
+                         (unsigned long)r.requestedMs, (unsigned long)r.actualMs, (unsigned long)r.pwmValue);
+                out.print(line);
+                rows++;
+            }
+        }
+        f.close();
+        yield();
+    }
+    return rows;
+}
+
+bool ArchiveManager::isMounted() {
+    return mounted;
+}
+
+uint32_t ArchiveManager::getBlockCount() {
+    return blockCount;
+}
+
+size_t ArchiveManager::getTotalBytes() {
+    if (blockCount == 0) return 0;
+    return closedBytes + lastBlockSize;
+}
+
+uint32_t ArchiveManager::getPendingCount() {
+    if (!history) return 0;
+    return history->getLastSeq() - archivedSeq;
+}
+
+unsigned long ArchiveManager::getRecordsWritten() {
+    return recordsWritten;
+}
+
+unsigned long ArchiveManager::getRecordsLost() {
+    return recordsLost;
+}
@@ -0,0 +1,50 @@
+#ifndef ARCHIVE_MANAGER_H
+#define ARCHIVE_MANAGER_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "history_manager.h"
+
+// 激活记录的长期归档（LittleFS）
+//
+// 后台从 HistoryManager 环形缓冲按序号批量取出记录，压缩后追加到块文件：
+//   块头（8字节）: 'P' 'A' 版本 保留 基准时间戳(4字节, 小端)
+//   记录: [引脚|来源<<5|无时间标记<<7] [时间戳差值 zigzag varint] [定时器ID varint]
+//         [实际时长 varint] [实际-预期 zigzag varint] [PWM varint]
+// 每条记录通常 7~9 字节。块写满 ARCHIVE_BLOCK_SIZE 后换新块，超过 ARCHIVE_MAX_BLOCKS 删除最旧的块。
+class ArchiveManager {
+private:
+    HistoryManager* history;
+    bool mounted;
+    uint32_t firstBlock;          // 最旧块编号
+    uint32_t lastBlock;           // 当前写入块编号
+    uint32_t blockCount;
+    size_t lastBlockSize;
+    size_t closedBytes;           // 除当前块以外所有块的字节数
+    uint32_t lastEpoch;           // 当前块最后一条带时间记录的时间戳（差值编码基准）
+    uint32_t archivedSeq;         // 已归档的最新历史序号
+    unsigned long lastFlush;
+    unsigned long recordsWritten;
+    unsigned long recordsLost;    // 归档前已被环形缓冲覆盖的记录
+    
+    void blockPath(uint32_t block, char* path, size_t len);
+    bool startBlock(uint32_t baseEpoch);
+    void scanLastBlock();
+    size_t encodeRecord(const ActivationRecord& r, uint8_t* out);
+    
+public:
+    ArchiveManager();
+    bool begin(HistoryManager* hm);
+    void update();
+    void flush();
+    size_t exportCSV(uint32_t from, uint32_t to, Print& out);
+    bool isMounted();
+    uint32_t getBlockCount();
+    size_t getTotalBytes();
+    uint32_t getPendingCount();
+    unsigned long getRecordsWritten();
+    unsigned long getRecordsLost();
+};
+
+#endif
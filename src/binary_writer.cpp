@@ -0,0 +1,143 @@
+#include "binary_writer.h"
+
+BinaryWriter::BinaryWriter(BinaryFormat format, String& out) : format(format), out(out) {}
+
+void BinaryWriter::put(uint8_t b) {
+    out.concat((char)b);
+}
+
+void BinaryWriter::putBE(uint32_t v, int bytes) {
+    uint8_t buf[4];
+    for (int i = bytes - 1; i >= 0; i--) {
+        buf[i] = v & 0xFF;
+        v >>= 8;
+    }
+    out.concat((const char*)buf, bytes);
+}
+
+void BinaryWriter::writeCBORHead(uint8_t major, uint32_t v) {
+    major <<= 5;
+    if (v < 24) {
+        put(major | v);
+    } else if (v <= 0xFF) {
+        put(major | 24);
+        put(v);
+    } else if (v <= 0xFFFF) {
+        put(major | 25);
+        putBE(v, 2);
+    } else {
+        put(major | 26);
+        putBE(v, 4);
+    }
+}
+
+void BinaryWriter::writeContainer(uint8_t fixBase, uint8_t tag16, uint8_t cborMajor, size_t n) {
+    if (format == FORMAT_CBOR) {
+        writeCBORHead(cborMajor, n);
+    } else if (n < 16) {
+        put(fixBase | n);
+    } else {
+        put(tag16);
+        putBE(n, 2);
+    }
+}
+
+void BinaryWriter::beginArray(size_t n) {
+    writeContainer(0x90, 0xDC, 4, n);
+}
+
+void BinaryWriter::beginMap(size_t n) {
+    writeContainer(0x80, 0xDE, 5, n);
+}
+
+void BinaryWriter::writeNil() {
+    put(format == FORMAT_CBOR ? 0xF6 : 0xC0);
+}
+
+void BinaryWriter::writeBool(bool v) {
+    if (format == FORMAT_CBOR) {
+        put(v ? 0xF5 : 0xF4);
+    } else {
+        put(v ? 0xC3 : 0xC2);
+    }
+}
+
+void BinaryWriter::writeUInt(uint32_t v) {
+    if (format == FORMAT_CBOR) {
+        writeCBORHead(0, v);
+    } else if (v < 128) {
+        put(v);
+    } else if (v <= 0xFF) {
+        put(0xCC);
+        put(v);
+    } else if (v <= 0xFFFF) {
+        put(0xCD);
+        putBE(v, 2);
+    } else {
+        put(0xCE);
+        putBE(v, 4);
+    }
+}
+
+void BinaryWriter::writeInt(int32_t v) {
+    if (v >= 0) {
+        writeUInt(v);
+    } else if (format == FORMAT_CBOR) {
+        writeCBORHead(1, (uint32_t)(-1 - v));
+    } else if (v >= -32) {
+        put((uint8_t)(int8_t)v);
+    } else if (v >= -128) {
+        put(0xD0);
+        put((uint8_t)(int8_t)v);
+    } else if (v >= -32768) {
+        put(0xD1);
+        putBE((uint16_t)(int16_t)v, 2);
+    } else {
+        put(0xD2);
+        putBE((uint32_t)v, 4);
+    }
+}
+
+void BinaryWriter::writeFloat(float v) {
+    union {
+        float f;
+        uint32_t u;
+    } converter;
+    converter.f = v;
+    put(format == FORMAT_CBOR ? 0xFA : 0xCA);
+    putBE(converter.u, 4);
+}
+
+void BinaryWriter::writeString(const char* s, size_t len) {
+    if (format == FORMAT_CBOR) {
+        writeCBORHead(3, len);
+    } else if (len < 32) {
+        put(0xA0 | len);
+    } else if (len <= 0xFF) {
+        put(0xD9);
+        put(len);
+    } else {
+        put(0xDA);
+        putBE(len, 2);
+    }
+    out.concat(s, len);
+}
+
+void BinaryWriter::writeString(const char* s) {
+    writeString(s, strlen(s));
+}
+
+void BinaryWriter::writeString(const String& s) {
+    writeString(s.c_str(), s.length());
+}
+
+const char* formatContentType(BinaryFormat format) {
+    switch (format) {
+    case FORMAT_MSGPACK:
+        return "application/msgpack";
+    case FORMAT_CBOR:
+        return "application/cbor";
+    default:
+        return "application/json";
+    }
+}
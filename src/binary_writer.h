@@ -0,0 +1,41 @@
+#ifndef BINARY_WRITER_H
+#define BINARY_WRITER_H
+
+#include <Arduino.h>
+
+// 响应/请求体编码格式
+enum BinaryFormat {
+    FORMAT_JSON = 0,
+    FORMAT_MSGPACK,
+    FORMAT_CBOR
+};
+
+// 紧凑二进制编码器：直接从内存记录生成 MessagePack 或 CBOR，不经过 JsonDocument。
+// 记录统一编码为定长数组（字段顺序见 README），省去 JSON 中重复的键名。
+class BinaryWriter {
+private:
+    BinaryFormat format;
+    String& out;
+    
+    void put(uint8_t b);
+    void putBE(uint32_t v, int bytes);
+    void writeCBORHead(uint8_t major, uint32_t v);
+    void writeContainer(uint8_t fixBase, uint8_t tag16, uint8_t cborMajor, size_t n);
+    
+public:
+    BinaryWriter(BinaryFormat format, String& out);
+    void beginArray(size_t n);
+    void beginMap(size_t n);
+    void writeNil();
+    void writeBool(bool v);
+    void writeUInt(uint32_t v);
+    void writeInt(int32_t v);
+    void writeFloat(float v);
+    void writeString(const char* s, size_t len);
+    void writeString(const char* s);
+    void writeString(const String& s);
+};
+
+const char* formatContentType(BinaryFormat format);
+
+#endif
@@ -0,0 +1,34 @@
+#include "boot_profile.h"
+#include "logger.h"
+
+BootProfile bootProfile;
+
+BootProfile::BootProfile() {
+    count = 0;
+    lastPhase = 0;
+}
+
+void BootProfile::record(const char* name, uint32_t durationMs, bool background) {
+    if (count >= BOOT_PHASE_MAX) return;
+    BootPhase& p = phases[count++];
+    p.name = name;
+    p.atMs = millis();
+    p.durationMs = durationMs;
+    p.background = background;
+}
+
+void BootProfile::phase(const char* name) {
+    unsigned long now = millis();
+    record(name, now - lastPhase, false);
+    lastPhase = now;
+    LOG_DEBUG("启动阶段 %s 完成: %lums", name, now);
+}
+
+void BootProfile::milestone(const char* name) {
+    if (count >= BOOT_PHASE_MAX) return;
+    for (int i = 0; i < count; i++) {
+        if (strcmp(phases[i].name, name) == 0) return;
+    }
+    record(name, 0, true);
+    LOG_INFO("启动阶段 %s 完成: 启动后 %lums", name, millis());
+}
@@ -0,0 +1,34 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+struct BootPhase {
+    const char* name;
+    uint32_t atMs;              // 完成时距启动的毫秒数
+    uint32_t durationMs;        // setup() 中阶段的耗时，后台阶段为 0
+    bool background;
+};
+
+// 启动阶段计时：setup() 依次完成的阶段记录各自耗时，
+// WiFi 连接、NTP 同步等在主循环中后台完成的阶段记录首次完成的时间
+class BootProfile {
+private:
+    BootPhase phases[BOOT_PHASE_MAX];
+    uint8_t count;
+    unsigned long lastPhase;
+
+    void record(const char* name, uint32_t durationMs, bool background);
+
+public:
+    BootProfile();
+    void phase(const char* name);       // setup() 中的一个阶段完成
+    void milestone(const char* name);   // 后台阶段首次完成，之后重复调用忽略
+    int getCount() const { return count; }
+    const BootPhase& get(int i) const { return phases[i]; }
+};
+
+extern BootProfile bootProfile;
+
+#endif
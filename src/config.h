@@ -9,27 +9,144 @@
 
 // WiFi 配置
 #define DEFAULT_AP_SSID "PetIO_Setup"
-#define WIFI_TIMEOUT 30000 // 30秒
+#define WIFI_TIMEOUT 30000 // 30秒，后台连接超时后切换到 AP 模式
 
 // NTP 时间同步配置
 #define NTP_SERVER "pool.ntp.org"
 #define TIME_ZONE 8                 // UTC+8 中国时区
 #define NTP_UPDATE_INTERVAL 3600000 // 1小时同步一次
+#define NTP_RETRY_INTERVAL 10000    // 同步失败后的重试间隔
+#define NTP_RESPONSE_TIMEOUT 2000   // 等待解析和回复的超时（非阻塞，在主循环中轮询）
+
+// 启动阶段
+#define BOOT_PHASE_MAX 12           // 记录的启动阶段数
+#define TIMER_CHECKPOINT_MS 300000  // 运行中定时器的剩余时间按 5 分钟向上取整写入 EEPROM，限制闪存擦写
+
+// 日志配置
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 3                 // 0 关闭, 1 错误, 2 警告, 3 信息, 4 调试；可用 -D LOG_LEVEL=n 覆盖
+#endif
+#define LOG_BUFFER_SIZE 4096        // 日志环形缓冲大小，同时保留最近的日志供 /api/logs 读取
+#define LOG_LINE_MAX 160            // 单行最大长度（超出截断）
+
+// 主循环任务调度
+#define TASK_MAX 12                 // 最多注册的任务数
+#define TASK_STATS_WINDOW 10000     // CPU 占用统计窗口（毫秒）
+
+// 省电模式（需要时用 -D POWER_SAVE=1 开启）：空闲时浅睡眠到下一个定时器事件，保持 WiFi 连接
+#ifndef POWER_SAVE
+#define POWER_SAVE 0
+#endif
+#define POWER_LISTEN_INTERVAL 3     // 浅睡眠时每隔几个 DTIM 周期醒来接收一次
+#define POWER_MAX_SLEEP_MS 1000     // 单次最长睡眠，限制 Web 请求的响应延迟
+#define POWER_MIN_SLEEP_MS 20       // 空闲时间不足时不睡眠
+#define POWER_WAKE_MARGIN_MS 15     // 提前醒来的余量，保证按时开关输出
+#define POWER_POLL_MS 50            // 睡眠期间检查新请求的间隔
+#define POWER_ACTIVE_MA 70          // 电流估算：唤醒时（WiFi 接收开启）
+#define POWER_SLEEP_MA 2            // 电流估算：浅睡眠（含 DTIM 唤醒）
+
+// OLED 显示（I2C，GPIO4/5，这两个引脚不作为输出使用）；没有接显示屏时可用 -D DISPLAY_ENABLED=0 关闭
+#ifndef DISPLAY_ENABLED
+#define DISPLAY_ENABLED 1
+#endif
+
+// 设备发现：mDNS 服务 _petio._tcp，以及 UDP 组播状态信标
+#define DISCOVERY_SERVICE "petio"
+#define DISCOVERY_BEACON_GROUP 239, 255, 80, 73  // 组播地址
+#define DISCOVERY_BEACON_PORT 4210
+#define DISCOVERY_BEACON_INTERVAL 10000 // 状态未变化时的信标间隔（毫秒）
+#define DISCOVERY_BEACON_MIN_GAP 1000   // 状态变化时立即发送，但两次之间至少间隔（毫秒）
+
+// MQTT 客户端（需要时用 -D MQTT_ENABLED=1 开启，并用 -D MQTT_BROKER=\"192.168.1.10\" 指定服务器）
+#ifndef MQTT_ENABLED
+#define MQTT_ENABLED 0
+#endif
+#ifndef MQTT_BROKER
+#define MQTT_BROKER ""
+#endif
+#ifndef MQTT_PORT
+#define MQTT_PORT 1883
+#endif
+#ifndef MQTT_USER
+#define MQTT_USER ""                // 为空时不发送用户名和密码
+#endif
+#ifndef MQTT_PASSWORD
+#define MQTT_PASSWORD ""
+#endif
+#define MQTT_TOPIC_PREFIX "petio"   // 主题为 petio/<设备ID>/...
+#define MQTT_KEEPALIVE 30           // 心跳间隔（秒）
+#define MQTT_CONNECT_TIMEOUT 300    // TCP 连接超时（毫秒），期间主循环会阻塞：服务器不可达时定时器最多晚这么久，
+                                    // 之后按重连退避，局域网内正常连接只需几毫秒
+#define MQTT_DNS_TIMEOUT 5000       // 主机名解析超时（毫秒），解析是异步的，不阻塞主循环
+#define MQTT_RECONNECT_MIN 2000     // 重连退避（毫秒），每次失败翻倍
+#define MQTT_RECONNECT_MAX 60000
+#define MQTT_ACK_TIMEOUT 10000      // 事件超时未确认时断开重连并重发
+#define MQTT_INFLIGHT 4             // 未确认事件上限（不超过 8）
+#define MQTT_PENDING_ACKS 8         // 发送缓冲不足时暂存的入站命令确认，写满时断开重连
+#define MQTT_STATE_MIN_GAP 1000     // 状态变化时立即发布，但两次之间至少间隔（毫秒）
+#define MQTT_RX_BUFFER 2304         // 入站消息缓冲，容纳一条完整的批量命令（BODY_LIMIT_BATCH）和主题
+#define MQTT_TX_BUFFER 768          // 出站消息缓冲
 
 // Web 服务器端口
 #define WEB_SERVER_PORT 80
 
+// API 路由索引：按 方法 + 路径哈希 分桶，匹配只检查同一个桶中的路由
+#define ROUTE_MAX 48                // 路由表最多条数
+#define ROUTE_BUCKET_BITS 5         // 32 个桶
+
+// HTTP 持久连接：服务器一次只服务一个连接，空闲连接在有新连接等待时立即关闭
+#define KEEPALIVE_IDLE_TIMEOUT 2000 // 持久连接空闲超时（毫秒）
+#define KEEPALIVE_MAX_REQUESTS 100  // 单个连接最多处理的请求数，之后回复 Connection: close
+
+// 准入控制：超出速率或时间预算的请求在读取请求头之前直接回复 429/503
+#define ADMISSION_CLIENTS 8         // 跟踪的客户端数，超出时淘汰最久未访问的
+#define ADMISSION_CLIENT_RATE 10    // 每个客户端每秒请求数
+#define ADMISSION_CLIENT_BURST 20   // 每个客户端允许的突发请求数
+#define ADMISSION_HTTP_SHARE 50     // Web 请求平均最多占用的时间比例（%）
+#define ADMISSION_BUDGET_MS 500     // 时间预算上限，即允许连续处理请求的最长时间
+
+// 请求体大小限制（接收过程中检查，超出返回 413）
+#define BODY_BUFFER_SIZE 2048       // 静态接收缓冲，不小于各路由上限
+#define BODY_LIMIT_TIMER 256        // 添加/更新单个定时器
+#define BODY_LIMIT_BATCH 2048       // 批量操作
+#define BODY_LIMIT_MANUAL 128       // 手动控制
+#define BODY_LIMIT_WIFI 192         // WiFi 配置
+
+// 请求级内存池：处理函数中的 JsonDocument 和响应缓冲从这里分配，请求结束时整体复位
+#define REQUEST_ARENA_SIZE 6144
+
 // EEPROM 地址配置
 #define EEPROM_SIZE 512
 #define WIFI_SSID_ADDR 0
 #define WIFI_PASSWORD_ADDR 64
 #define TIMER_CONFIG_ADDR 128
+#define TIMER_CONFIG_RECORD_SIZE 12                          // 定时器配置部分
+#define TIMER_RECORD_SIZE 25                                 // 配置 12 字节 + 运行时状态 13 字节
+#define TIMER_SLOT_RECORD_SIZE (2 + TIMER_RECORD_SIZE)       // 槽位代数 + 占用标记 + 定时器记录
 
 // 定时器配置
 #define MAX_TIMERS 10
+#define INVALID_TIMER_ID 0      // 定时器 ID = (代数 << 8) | 槽位，代数从 1 开始，因此 0 永远无效
+#define TIMER_STORE_MAGIC 0xA1  // 槽位格式的存储标记；旧格式首字节为定时器数量（<= MAX_TIMERS）
 #define MAX_SSID_LENGTH 32
 #define MAX_PASSWORD_LENGTH 64
 
+// 激活历史（内存环形缓冲）
+#define HISTORY_CAPACITY 64          // 保留最近 64 次激活，每条 24 字节
+#define HISTORY_PAGE_SIZE 32         // /api/history 单页最多返回条数
+
+// 激活归档（LittleFS，压缩块文件）
+#define ARCHIVE_BLOCK_SIZE 4096      // 单个块文件大小上限
+#define ARCHIVE_MAX_BLOCKS 12        // 最多保留 12 块（约 48KB，按每天 10 次激活约可保存一年以上）
+#define ARCHIVE_BATCH_SIZE 8         // 攒够 8 条记录写入一次
+#define ARCHIVE_FLUSH_INTERVAL 600000 // 或最多等待 10 分钟
+
+// 每日引脚统计
+#define STATS_DAYS 7                 // 保留最近 7 天
+#define STATS_FILE "/stats.bin"
+#define STATS_MAGIC 0xD5
+#define STATS_SAVE_INTERVAL 600000   // 有变化时最多 10 分钟写一次闪存
+
 // ESP8266 可用引脚列表
 const int AVAILABLE_PINS[] = {0, 1, 2, 3, 12, 13, 14, 15, 16};
 const int AVAILABLE_PINS_COUNT = sizeof(AVAILABLE_PINS) / sizeof(AVAILABLE_PINS[0]);
@@ -39,9 +156,22 @@ const int AVAILABLE_PINS_COUNT = sizeof(AVAILABLE_PINS) / sizeof(AVAILABLE_PINS[
 #define PWM_RESOLUTION 10       // PWM 分辨率 10位 (0-1023)
 #define PWM_MAX_VALUE 1023      // PWM 最大值
 
+// 引脚共享规则：多个定时器（或手动控制）同时占用同一引脚时如何合并输出
+#define PIN_MERGE_MAX 0         // 取所有占用者中的最大值
+#define PIN_MERGE_LATEST 1      // 以最后开启的占用者为准
+#define PIN_MERGE_SUM 2         // 求和后截断到 PWM_MAX_VALUE
+#ifndef PIN_MERGE_MODE
+#define PIN_MERGE_MODE PIN_MERGE_MAX
+#endif
+
+#define MAX_GPIO 17                        // GPIO0 ~ GPIO16
+#define MANUAL_OWNER MAX_TIMERS            // 手动控制使用的占用者 ID（定时器占用者 ID 即槽位号）
+#define MAX_PIN_OWNERS (MAX_TIMERS + 1)
+
 // 定时器结构体
 struct TimerConfig
 {
+    uint16_t id;                  // 稳定 ID，INVALID_TIMER_ID 表示空槽位
     bool enabled;
     int pin;
     int hour;
@@ -54,6 +184,29 @@ struct TimerConfig
     bool isPWM;                   // 是否为PWM模式
     int pwmValue;                 // PWM值 (0-1023)
     unsigned long realStartTime;  // 真实开始时间（时间戳）
+    uint8_t triggerSource;        // 本次运行的触发来源（仅运行时，不持久化）
+};
+
+// 引脚占用者
+struct PinOwner
+{
+    uint8_t id;                   // 定时器槽位号或 MANUAL_OWNER
+    bool isPWM;
+    uint16_t value;               // PWM值，数字模式为 PWM_MAX_VALUE
+};
+
+// 引脚输出状态表项
+struct PinState
+{
+    int pin;
+    uint8_t ownerCount;                  // 引用计数
+    PinOwner owners[MAX_PIN_OWNERS];     // 按开启先后排列
+    bool level;                          // 当前有效电平
+    int pwmValue;                        // 当前有效PWM值（0 表示数字输出）
+    unsigned long manualUntil;           // 手动占用到期时间（millis），0 表示不自动释放
+    unsigned long manualStart;           // 手动占用开始时间（millis），用于记录历史
+    unsigned long manualEpoch;           // 手动占用开始时间戳
+    unsigned long outputSince;           // 当前输出状态开始时间（millis），用于每日统计
 };
 
 #endif
@@ -0,0 +1,108 @@
+#include "discovery_manager.h"
+#include "logger.h"
+#include <ESP8266mDNS.h>
+
+// mDNS TXT 记录中的功能列表，网关据此决定使用哪些接口
+static const char DISCOVERY_CAPS[] = "timers,pwm,manual,history,archive,stats,logs,msgpack,cbor,ota";
+
+static void putU16(uint8_t* p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void putU32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+DiscoveryManager::DiscoveryManager() {
+    timerManager = nullptr;
+    timeManager = nullptr;
+    hostname[0] = '\0';
+    lastVersion = 0;
+    lastBeacon = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void DiscoveryManager::begin(TimerManager* tm, TimeManager* timeM) {
+    timerManager = tm;
+    timeManager = timeM;
+    snprintf(hostname, sizeof(hostname), "petio-%06x", ESP.getChipId());
+}
+
+void DiscoveryManager::startMDNS() {
+    if (!MDNS.begin(hostname)) {
+        LOG_WARN("mDNS 启动失败");
+        return;
+    }
+
+    MDNS.addService(DISCOVERY_SERVICE, "tcp", WEB_SERVER_PORT);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, "tcp", "version", FIRMWARE_VERSION);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, "tcp", "api", "1");
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, "tcp", "caps", DISCOVERY_CAPS);
+    char id[12];
+    snprintf(id, sizeof(id), "%06x", ESP.getChipId());
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, "tcp", "id", id);
+    MDNS.addServiceTxt(DISCOVERY_SERVICE, "tcp", "beacon", (uint32_t)DISCOVERY_BEACON_PORT);
+
+    stats.mdnsStarted = true;
+    LOG_INFO("mDNS 已启动: %s.local，服务 _%s._tcp", hostname, DISCOVERY_SERVICE);
+}
+
+void DiscoveryManager::update() {
+    if (!timerManager) return;
+
+    // 只在 STA 连接时广播；断开后停止，重新连上时按新地址重新注册
+    if (!WiFi.isConnected()) {
+        if (stats.mdnsStarted) {
+            MDNS.end();
+            stats.mdnsStarted = false;
+        }
+        return;
+    }
+
+    if (!stats.mdnsStarted) {
+        startMDNS();
+        lastBeacon = millis() - DISCOVERY_BEACON_INTERVAL;   // 连接后立即发送一次信标
+    }
+    MDNS.update();
+
+    // 状态变化时尽快发送（限制最小间隔），否则按固定间隔发送
+    unsigned long now = millis();
+    uint32_t version = timerManager->getStateVersion();
+    bool changed = version != lastVersion;
+    if (now - lastBeacon >= DISCOVERY_BEACON_INTERVAL ||
+        (changed && now - lastBeacon >= DISCOVERY_BEACON_MIN_GAP)) {
+        if (changed && now - lastBeacon < DISCOVERY_BEACON_INTERVAL) {
+            stats.changeBeacons++;
+        }
+        sendBeacon();
+        lastVersion = version;
+        lastBeacon = now;
+    }
+}
+
+void DiscoveryManager::sendBeacon() {
+    uint8_t beacon[BEACON_SIZE];
+    memset(beacon, 0, sizeof(beacon));
+    memcpy(beacon, "PIOB", 4);
+    beacon[4] = BEACON_FORMAT;
+    beacon[5] = timeManager && timeManager->isTimeValid() ? 0x01 : 0x00;
+    putU16(beacon + 6, WEB_SERVER_PORT);
+    putU32(beacon + 8, ESP.getChipId());
+    putU32(beacon + 12, timerManager->getStateVersion());
+    putU32(beacon + 16, millis() / 1000);
+    beacon[20] = timerManager->getActiveTimerCount();
+    beacon[21] = timerManager->getTimerCount();
+
+    IPAddress group(DISCOVERY_BEACON_GROUP);
+    if (!udp.beginPacketMulticast(group, DISCOVERY_BEACON_PORT, WiFi.localIP()) ||
+        udp.write(beacon, sizeof(beacon)) != sizeof(beacon) ||
+        !udp.endPacket()) {
+        stats.beaconErrors++;
+        return;
+    }
+    stats.beacons++;
+}
@@ -0,0 +1,58 @@
+#ifndef DISCOVERY_MANAGER_H
+#define DISCOVERY_MANAGER_H
+
+#include <ESP8266WiFi.h>
+#include <WiFiUdp.h>
+#include "config.h"
+#include "timer_manager.h"
+#include "time_manager.h"
+
+// 信标格式（小端，24 字节）：
+//  0  "PIOB"       魔数
+//  4  uint8        格式版本（1）
+//  5  uint8        标志：bit0 时间已同步
+//  6  uint16       HTTP 端口
+//  8  uint32       设备 ID（芯片 ID）
+// 12  uint32       状态版本，定时器配置或输出变化时递增（重启后从 0 开始）
+// 16  uint32       运行时间（秒），变小说明设备重启过
+// 20  uint8        运行中的定时器数
+// 21  uint8        定时器总数
+// 22  uint16       保留
+#define BEACON_SIZE 24
+#define BEACON_FORMAT 1
+
+struct DiscoveryStats {
+    bool mdnsStarted;
+    unsigned long beacons;          // 发送的信标数
+    unsigned long changeBeacons;    // 因状态变化提前发送的信标数
+    unsigned long beaconErrors;
+};
+
+// 设备发现：WiFi 连接后通过 mDNS 广播 _petio._tcp 服务（TXT 记录带版本和功能列表），
+// 并定期向组播地址发送简短的状态信标。收集端只需监听信标，
+// 状态版本变化时再请求 /api/status，无需扫描网段轮询每台设备。
+class DiscoveryManager {
+private:
+    TimerManager* timerManager;
+    TimeManager* timeManager;
+    WiFiUDP udp;
+    char hostname[24];
+    uint32_t lastVersion;
+    unsigned long lastBeacon;
+    DiscoveryStats stats;
+
+    void startMDNS();
+    void sendBeacon();
+
+public:
+    DiscoveryManager();
+    void begin(TimerManager* tm, TimeManager* timeM);
+    void update();
+
+    const char* getHostname() const { return hostname; }
+    const DiscoveryStats& getStats() const { return stats; }
+};
+
+extern DiscoveryManager discoveryManager; // 定义在 main.cpp
+
+#endif
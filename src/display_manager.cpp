@@ -3,7 +3,14 @@
 
 DisplayManager::DisplayManager(WiFiManager *wm, TimerManager *tm, TimeManager *tim)
     : wifi(wm), timers(tm), timeM(tim),
-      u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE) {}
+      u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE)
+{
+    memset(lines, 0, sizeof(lines));
+    memset(&stats, 0, sizeof(stats));
+#if !DISPLAY_PAGE_BUFFER
+    memset(rowHash, 0, sizeof(rowHash));
+#endif
+}
 
 bool DisplayManager::begin()
 {
@@ -15,31 +22,62 @@ bool DisplayManager::begin()
     u8g2.setFont(u8g2_font_6x12_tf); // 默认 ASCII 字体，兼容性更好
 
     // 开机画面
+#if DISPLAY_PAGE_BUFFER
+    u8g2.firstPage();
+    do
+    {
+        u8g2.setFont(u8g2_font_wqy12_t_chinese1);
+        u8g2.drawStr(0, 12, "PetIO Booting...");
+        u8g2.drawStr(0, 28, "OLED init...");
+    } while (u8g2.nextPage());
+#else
     u8g2.clearBuffer();
     u8g2.setFont(u8g2_font_wqy12_t_chinese1);
     u8g2.drawStr(0, 12, "PetIO Booting...");
     u8g2.drawStr(0, 28, "OLED init...");
     u8g2.sendBuffer();
+    // 开机画面之后的第一帧所有行都视为已变化
+    memset(rowHash, 0xFF, sizeof(rowHash));
+#endif
     return true;
 }
 
 void DisplayManager::update()
 {
     unsigned long now = millis();
-    if (now - lastDraw >= drawInterval)
-    {
-        drawScreen();
-        lastDraw = now;
-    }
-
     if (now - lastPageSwitch >= pageInterval)
     {
         pageIndex = (pageIndex + 1) % 3;
         lastPageSwitch = now;
+        lastDraw = now - drawInterval; // 换页立即显示
     }
+
+    // 上一帧还没发送完：继续发送，不绘制新内容
+    if (transferActive)
+    {
+        sendSlice();
+        return;
+    }
+
+    if (now - lastDraw < drawInterval)
+        return;
+    lastDraw = now;
+
+    // 先生成文字，和屏幕上的内容相同就不重绘
+    char next[DISPLAY_LINES][DISPLAY_LINE_LEN];
+    memset(next, 0, sizeof(next));
+    buildPage(next);
+    if (shownPage == pageIndex && memcmp(next, lines, sizeof(lines)) == 0)
+    {
+        stats.unchanged++;
+        return;
+    }
+    memcpy(lines, next, sizeof(lines));
+    shownPage = pageIndex;
+    drawScreen();
 }
 
-String DisplayManager::uptimeStr()
+void DisplayManager::uptimeStr(char *buf, size_t size)
 {
     unsigned long ms = millis();
     unsigned long s = ms / 1000UL;
@@ -47,91 +85,196 @@ String DisplayManager::uptimeStr()
     unsigned int h = (s / 3600UL) % 24;
     unsigned int m = (s / 60UL) % 60;
     unsigned int sec = s % 60;
-    char buf[32];
     if (d > 0)
-        sprintf(buf, "%ud %02u:%02u:%02u", d, h, m, sec);
+        snprintf(buf, size, "%ud %02u:%02u:%02u", d, h, m, sec);
     else
-        sprintf(buf, "%02u:%02u:%02u", h, m, sec);
-    return String(buf);
+        snprintf(buf, size, "%02u:%02u:%02u", h, m, sec);
 }
 
-void DisplayManager::drawScreen()
+void DisplayManager::buildPage(char out[DISPLAY_LINES][DISPLAY_LINE_LEN])
 {
-    u8g2.clearBuffer();
     switch (pageIndex)
     {
     case 0:
-        drawPageNetwork();
+        buildPageNetwork(out);
         break;
     case 1:
-        drawPageTimers();
+        buildPageTimers(out);
         break;
     case 2:
-        drawPageUptime();
+        buildPageUptime(out);
         break;
     }
-    u8g2.sendBuffer();
 }
 
-void DisplayManager::drawPageNetwork()
+void DisplayManager::buildPageNetwork(char out[DISPLAY_LINES][DISPLAY_LINE_LEN])
 {
     // 标题
-    u8g2.setFont(u8g2_font_6x12_tf);
-    u8g2.drawStr(0, 10, "Network");
-    // SSID 或 AP 名
-    String line1 = wifi->isConnected() ? String("SSID ") + WiFi.SSID() : String("AP ") + DEFAULT_AP_SSID;
-    u8g2.drawUTF8(0, 24, line1.c_str());
-    // IP
-    String ip = wifi->isConnected() ? wifi->getLocalIP() : wifi->getAPIP();
-    String ipLine = String("IP  ") + ip;
-    u8g2.drawUTF8(0, 38, ipLine.c_str());
-    // RSSI/Mode
-    String line3;
+    snprintf(out[0], DISPLAY_LINE_LEN, "Network");
     if (wifi->isConnected())
-        line3 = String("RSSI ") + WiFi.RSSI() + " dBm";
+    {
+        // SSID / IP / RSSI
+        snprintf(out[1], DISPLAY_LINE_LEN, "SSID %s", WiFi.SSID().c_str());
+        snprintf(out[2], DISPLAY_LINE_LEN, "IP  %s", wifi->getLocalIP().c_str());
+        snprintf(out[3], DISPLAY_LINE_LEN, "RSSI %d dBm", WiFi.RSSI());
+    }
+    else if (wifi->isConnecting())
+    {
+        // 后台连接中，超时后才切换到 AP 模式
+        snprintf(out[1], DISPLAY_LINE_LEN, "SSID %s", WiFi.SSID().c_str());
+        snprintf(out[2], DISPLAY_LINE_LEN, "Connecting...");
+        snprintf(out[3], DISPLAY_LINE_LEN, "Mode STA");
+    }
     else
-        line3 = "Mode AP";
-    u8g2.drawUTF8(0, 52, line3.c_str());
+    {
+        snprintf(out[1], DISPLAY_LINE_LEN, "AP %s", DEFAULT_AP_SSID);
+        snprintf(out[2], DISPLAY_LINE_LEN, "IP  %s", wifi->getAPIP().c_str());
+        snprintf(out[3], DISPLAY_LINE_LEN, "Mode AP");
+    }
 }
 
-void DisplayManager::drawPageTimers()
+void DisplayManager::buildPageTimers(char out[DISPLAY_LINES][DISPLAY_LINE_LEN])
 {
-    u8g2.setFont(u8g2_font_6x12_tf);
-    u8g2.drawStr(0, 10, "Timers");
-    int total = timers->getTimerCount();
-    int y = 24;
-    for (int i = 0; i < total && i < 3; i++)
+    snprintf(out[0], DISPLAY_LINE_LEN, "Timers");
+    int shown = 0;
+    for (int i = 0; i < MAX_TIMERS && shown < 3; i++)
     { // 最多展示3条
-        TimerConfig t = timers->getTimer(i);
-        char buf[32];
-        snprintf(buf, sizeof(buf), "P%d %02d:%02d %ds %s", t.pin, t.hour, t.minute, t.duration, t.repeatDaily ? "R" : "1");
-        u8g2.drawStr(0, y, buf);
-        y += 12;
+        const TimerConfig *t = timers->getTimerBySlot(i);
+        if (!t)
+            continue;
+        shown++;
+        snprintf(out[shown], DISPLAY_LINE_LEN, "P%d %02d:%02d %ds %s", t->pin, t->hour, t->minute, (int)t->duration, t->repeatDaily ? "R" : "1");
     }
-    char stat[24];
-    int active = 0;
-    for (int i = 0; i < total; i++)
+    snprintf(out[4], DISPLAY_LINE_LEN, "%d active / %d", timers->getActiveTimerCount(), timers->getTimerCount());
+}
+
+void DisplayManager::buildPageUptime(char out[DISPLAY_LINES][DISPLAY_LINE_LEN])
+{
+    snprintf(out[0], DISPLAY_LINE_LEN, "System");
+    snprintf(out[1], DISPLAY_LINE_LEN, "Time %s", timeM->getCurrentTimeString().c_str());
+    snprintf(out[2], DISPLAY_LINE_LEN, "Date %s", timeM->getCurrentDateString().c_str());
+    char up[20];
+    uptimeStr(up, sizeof(up));
+    snprintf(out[3], DISPLAY_LINE_LEN, "Up   %s", up);
+}
+
+void DisplayManager::drawPage()
+{
+    u8g2.setFont(u8g2_font_6x12_tf);
+    u8g2.drawStr(0, 10, lines[0]);
+    if (shownPage == 1)
+    {
+        // 任务页：3 条定时器（行距 12）+ 右下角统计
+        for (int i = 1; i <= 3; i++)
+            u8g2.drawStr(0, 12 + i * 12, lines[i]);
+        int w = u8g2.getStrWidth(lines[4]);
+        u8g2.drawStr(128 - w, 64, lines[4]);
+    }
+    else
     {
-        if (timers->getTimer(i).isActive)
-            active++;
+        for (int i = 1; i <= 3; i++)
+            u8g2.drawUTF8(0, 10 + i * 14, lines[i]);
     }
-    snprintf(stat, sizeof(stat), "%d active / %d", active, total);
-    int w = u8g2.getStrWidth(stat);
-    u8g2.drawStr(128 - w, 64, stat);
 }
 
-void DisplayManager::drawPageUptime()
+void DisplayManager::drawScreen()
 {
-    u8g2.setFont(u8g2_font_6x12_tf);
-    u8g2.drawStr(0, 10, "System");
-
-    String timeStr = timeM->getCurrentTimeString();
-    String dateStr = timeM->getCurrentDateString();
-    String timeLine = String("Time ") + timeStr;
-    String dateLine = String("Date ") + dateStr;
-    String upLine = String("Up   ") + uptimeStr();
-
-    u8g2.drawUTF8(0, 24, timeLine.c_str());
-    u8g2.drawUTF8(0, 38, dateLine.c_str());
-    u8g2.drawUTF8(0, 52, upLine.c_str());
-}
\ No newline at end of file
+    stats.frames++;
+    frameStart = millis();
+#if DISPLAY_PAGE_BUFFER
+    // 页缓冲：每页 8 像素高，每次 sendChunk 绘制并发送一页
+    u8g2.firstPage();
+    transferActive = true;
+#else
+    u8g2.clearBuffer();
+    drawPage();
+    markDirtyRows();
+    transferActive = dirtyRows != 0;
+    sendRow = 0;
+    sendTile = 0;
+#endif
+    if (transferActive)
+        sendSlice();
+}
+
+void DisplayManager::sendSlice()
+{
+    // 在时间预算内发送尽量多的块，至少发送一块保证进度
+    unsigned long start = micros();
+    bool more = true;
+    do
+    {
+        unsigned long chunkStart = micros();
+        more = sendChunk();
+        uint32_t chunkUs = micros() - chunkStart;
+        stats.chunks++;
+        if (chunkUs > stats.maxChunkUs)
+            stats.maxChunkUs = chunkUs;
+    } while (more && micros() - start < DISPLAY_SLICE_US);
+
+    uint32_t sliceUs = micros() - start;
+    stats.slices++;
+    if (sliceUs > stats.maxSliceUs)
+        stats.maxSliceUs = sliceUs;
+
+    if (!more)
+    {
+        // 所有块都已发送，这一帧才算完成
+        transferActive = false;
+        stats.lastFrameMs = millis() - frameStart;
+        if (stats.lastFrameMs > stats.maxFrameMs)
+            stats.maxFrameMs = stats.lastFrameMs;
+    }
+}
+
+#if DISPLAY_PAGE_BUFFER
+bool DisplayManager::sendChunk()
+{
+    // nextPage 发送当前页并准备下一页；返回 0 表示整屏完成
+    drawPage();
+    stats.rowsSent++;
+    return u8g2.nextPage();
+}
+#else
+void DisplayManager::markDirtyRows()
+{
+    // 全缓冲按 tile 行存放（每行 128 字节），只标记内容与屏幕不同的行
+    uint8_t *buf = u8g2.getBufferPtr();
+    size_t rowBytes = u8g2.getBufferTileWidth() * 8;
+    dirtyRows = 0;
+    for (int row = 0; row < DISPLAY_TILE_ROWS; row++)
+    {
+        uint32_t hash = 2166136261u;
+        const uint8_t *p = buf + row * rowBytes;
+        for (size_t i = 0; i < rowBytes; i++)
+            hash = (hash ^ p[i]) * 16777619u;
+        if (hash != rowHash[row])
+        {
+            dirtyRows |= 1 << row;
+            rowHash[row] = hash;
+        }
+    }
+}
+
+bool DisplayManager::sendChunk()
+{
+    // 找到下一个脏行，按 DISPLAY_CHUNK_TILES 分块发送
+    while (sendRow < DISPLAY_TILE_ROWS && !(dirtyRows & (1 << sendRow)))
+        sendRow++;
+    if (sendRow >= DISPLAY_TILE_ROWS)
+        return false;
+
+    uint8_t tileWidth = u8g2.getBufferTileWidth();
+    uint8_t tiles = min((uint8_t)DISPLAY_CHUNK_TILES, (uint8_t)(tileWidth - sendTile));
+    u8g2.updateDisplayArea(sendTile, sendRow, tiles, 1);
+    sendTile += tiles;
+    if (sendTile >= tileWidth)
+    {
+        dirtyRows &= ~(1 << sendRow);
+        stats.rowsSent++;
+        sendRow++;
+        sendTile = 0;
+    }
+    return dirtyRows != 0;
+}
+#endif
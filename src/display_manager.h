@@ -20,28 +20,78 @@
 #define OLED_SCL_PIN 5
 #endif
 
-class DisplayManager {   
+// 1: 页缓冲模式，只占 128 字节 RAM，但内容变化时需要整屏重绘发送
+// 0: 全缓冲模式（1KB），只发送内容变化的 tile 行
+#ifndef DISPLAY_PAGE_BUFFER
+#define DISPLAY_PAGE_BUFFER 0
+#endif
+
+#define DISPLAY_LINES 5                // 每页文字行数（标题 + 4 行）
+#define DISPLAY_LINE_LEN 28
+#define DISPLAY_TILE_ROWS 8            // 64 像素 / 8
+#define DISPLAY_CHUNK_TILES 8          // 每次 I2C 传输的 tile 数（8 tile = 64 字节，约 1.6ms @400kHz）
+#define DISPLAY_SLICE_US 3000          // 每次 update 最多用于传输的时间，至少发送一块
+
+// 显示刷新统计
+struct DisplayStats {
+  unsigned long frames;                // 内容变化后重绘的次数
+  unsigned long unchanged;             // 内容未变化跳过重绘的次数
+  unsigned long rowsSent;              // 发送的 tile 行数（页缓冲模式按整屏 8 行计）
+  unsigned long chunks;                // I2C 传输块数
+  unsigned long slices;                // 分几次 update 发送
+  uint32_t maxSliceUs;                 // 单次 update 中传输的最长耗时（显示对主循环的最长阻塞）
+  uint32_t maxChunkUs;                 // 单块传输的最长耗时
+  uint32_t lastFrameMs;                // 最近一帧从开始到全部发送完的时间
+  uint32_t maxFrameMs;
+};
+
+class DisplayManager {
 public:
   DisplayManager(WiFiManager* wm, TimerManager* tm, TimeManager* tim);
   bool begin();
   void update();
+  const DisplayStats& getStats() const { return stats; }
+  bool isTransferActive() const { return transferActive; } // 一帧尚未发送完
 
 private:
   WiFiManager* wifi;
   TimerManager* timers;
   TimeManager* timeM;
+#if DISPLAY_PAGE_BUFFER
+  U8G2_SSD1315_128X64_NONAME_1_HW_I2C u8g2; // 页缓冲，硬件 I2C
+#else
   U8G2_SSD1315_128X64_NONAME_F_HW_I2C u8g2; // 全缓冲，硬件 I2C
+  uint32_t rowHash[DISPLAY_TILE_ROWS];  // 屏幕上每个 tile 行内容的哈希
+  uint8_t dirtyRows = 0;               // 待发送的 tile 行（位图）
+  uint8_t sendRow = 0;                 // 正在发送的行和行内位置
+  uint8_t sendTile = 0;
+#endif
+  // 一帧分多次 update 发送，发送完之前不绘制下一帧
+  bool transferActive = false;
+  unsigned long frameStart = 0;
   unsigned long lastDraw = 0;
-  const unsigned long drawInterval = 1000; // 1s 刷新
+  const unsigned long drawInterval = 1000; // 1s 检查一次内容
   uint8_t pageIndex = 0;               // 0:网络 1:任务 2:运行
   unsigned long lastPageSwitch = 0;
   const unsigned long pageInterval = 3000; // 3s 轮播
 
+  // 当前屏幕上的文字，内容不变时不重绘
+  char lines[DISPLAY_LINES][DISPLAY_LINE_LEN];
+  int8_t shownPage = -1;
+  DisplayStats stats;
+
+  void buildPage(char out[DISPLAY_LINES][DISPLAY_LINE_LEN]);
+  void buildPageNetwork(char out[DISPLAY_LINES][DISPLAY_LINE_LEN]);
+  void buildPageTimers(char out[DISPLAY_LINES][DISPLAY_LINE_LEN]);
+  void buildPageUptime(char out[DISPLAY_LINES][DISPLAY_LINE_LEN]);
   void drawScreen();
-  void drawPageNetwork();
-  void drawPageTimers();
-  void drawPageUptime();
-  String uptimeStr();
+  void drawPage();
+  void markDirtyRows();
+  bool sendChunk();
+  void sendSlice();
+  void uptimeStr(char* buf, size_t size);
 };
 
+extern DisplayManager display; // 定义在 main.cpp
+
 #endif // DISPLAY_MANAGER_H
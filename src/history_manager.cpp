@@ -0,0 +1,62 @@
+#include "history_manager.h"
+
+HistoryManager::HistoryManager() {
+    lastSeq = 0;
+    bootId = 0;
+}
+
+void HistoryManager::begin() {
+    // 硬件随机数，0 保留给"未知"
+    do {
+        bootId = ESP.random();
+    } while (bootId == 0);
+}
+
+uint32_t HistoryManager::append(uint16_t timerId, uint8_t pin, uint32_t epochStart, uint32_t requestedMs, uint32_t actualMs, uint16_t pwmValue, uint8_t source) {
+    lastSeq++;
+    ActivationRecord& r = records[lastSeq % HISTORY_CAPACITY];
+    r.seq = lastSeq;
+    r.epochStart = epochStart;
+    r.requestedMs = requestedMs;
+    r.actualMs = actualMs;
+    r.timerId = timerId;
+    r.pwmValue = pwmValue;
+    r.pin = pin;
+    r.source = source;
+    return lastSeq;
+}
+
+uint32_t HistoryManager::getBootId() {
+    return bootId;
+}
+
+uint32_t HistoryManager::getLastSeq() {
+    return lastSeq;
+}
+
+uint32_t HistoryManager::getOldestSeq() {
+    if (lastSeq == 0) return 0;
+    return lastSeq > HISTORY_CAPACITY ? lastSeq - HISTORY_CAPACITY + 1 : 1;
+}
+
+int HistoryManager::getCount() {
+    return lastSeq > HISTORY_CAPACITY ? HISTORY_CAPACITY : lastSeq;
+}
+
+const ActivationRecord* HistoryManager::get(uint32_t seq) {
+    if (seq == 0 || seq > lastSeq || seq < getOldestSeq()) {
+        return nullptr;
+    }
+    return &records[seq % HISTORY_CAPACITY];
+}
+
+const char* triggerSourceName(uint8_t source) {
+    switch (source) {
+    case TRIGGER_MANUAL:
+        return "manual";
+    case TRIGGER_RECOVERED:
+        return "recovered";
+    default:
+        return "scheduled";
+    }
+}
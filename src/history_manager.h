@@ -0,0 +1,44 @@
+#ifndef HISTORY_MANAGER_H
+#define HISTORY_MANAGER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// 触发来源
+#define TRIGGER_SCHEDULED 0   // 定时触发
+#define TRIGGER_MANUAL 1      // 手动控制
+#define TRIGGER_RECOVERED 2   // 重启后恢复的运行
+
+// 单次输出激活记录（24 字节）
+struct ActivationRecord {
+    uint32_t seq;             // 单调递增序号，从 1 开始
+    uint32_t epochStart;      // 开始时间戳，时间未同步时为 0
+    uint32_t requestedMs;     // 预期运行时长
+    uint32_t actualMs;        // 实际运行时长
+    uint16_t timerId;         // 定时器 ID，手动控制为 INVALID_TIMER_ID
+    uint16_t pwmValue;        // PWM值，数字模式为 0
+    uint8_t pin;
+    uint8_t source;           // TRIGGER_*
+};
+
+// 激活历史环形缓冲：固定容量、O(1) 追加、不分配堆内存，写满后覆盖最旧的记录
+class HistoryManager {
+private:
+    ActivationRecord records[HISTORY_CAPACITY];
+    uint32_t lastSeq;         // 最新记录的序号，0 表示还没有记录
+    uint32_t bootId;          // 每次启动随机生成；序号只在同一次启动内有效，重启后从 1 重新开始
+    
+public:
+    HistoryManager();
+    void begin();
+    uint32_t append(uint16_t timerId, uint8_t pin, uint32_t epochStart, uint32_t requestedMs, uint32_t actualMs, uint16_t pwmValue, uint8_t source);
+    uint32_t getBootId();
+    uint32_t getLastSeq();
+    uint32_t getOldestSeq();
+    int getCount();
+    const ActivationRecord* get(uint32_t seq);
+};
+
+const char* triggerSourceName(uint8_t source);
+
+#endif
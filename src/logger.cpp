@@ -0,0 +1,97 @@
+#include "logger.h"
+
+Logger logger;
+
+static const char LEVEL_TAGS[] = "-EWID";
+
+Logger::Logger() {
+    head = 0;
+    tail = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void Logger::write(uint8_t level, const char* fmt, ...) {
+    // 先在栈上格式化，确认缓冲有足够空间后整行拷入，不会留下半行
+    char line[LOG_LINE_MAX];
+    int prefix = snprintf(line, sizeof(line), "[%8lu] %c ", millis(), LEVEL_TAGS[level]);
+    
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf_P(line + prefix, sizeof(line) - prefix - 1, fmt, args);
+    va_end(args);
+    
+    size_t len = prefix + (n < 0 ? 0 : n);
+    if (len > sizeof(line) - 2) {
+        len = sizeof(line) - 2;
+        stats.truncated++;
+    }
+    line[len++] = '\n';
+    
+    if (len > LOG_BUFFER_SIZE - (head - tail)) {
+        stats.dropped++;
+        return;
+    }
+    
+    for (size_t i = 0; i < len; i++) {
+        ring[(head + i) % LOG_BUFFER_SIZE] = line[i];
+    }
+    head += len;
+    stats.lines++;
+    if (head - tail > stats.peakPending) {
+        stats.peakPending = head - tail;
+    }
+}
+
+void Logger::drain() {
+    // 只写入串口 FIFO 当前能容纳的字节数，保证不阻塞主循环
+    while (head != tail) {
+        int room = Serial.availableForWrite();
+        if (room <= 0) return;
+        
+        size_t pos = tail % LOG_BUFFER_SIZE;
+        size_t len = min((size_t)(head - tail), (size_t)(LOG_BUFFER_SIZE - pos));
+        len = min(len, (size_t)room);
+        Serial.write((const uint8_t*)ring + pos, len);
+        tail += len;
+    }
+}
+
+void Logger::flush() {
+    // 阻塞输出全部待发送内容，仅用于启动阶段和重启前
+    while (head != tail) {
+        drain();
+        yield();
+    }
+    Serial.flush();
+}
+
+uint32_t Logger::getHead() {
+    return head;
+}
+
+uint32_t Logger::getOldest() {
+    // 缓冲中仍保留的最早偏移
+    return head > LOG_BUFFER_SIZE ? head - LOG_BUFFER_SIZE : 0;
+}
+
+uint32_t Logger::alignToLine(uint32_t offset) {
+    // 跳到下一行开头，避免从被覆盖的半行开始输出
+    if (offset == 0) return 0;
+    while (offset < head && ring[(offset - 1) % LOG_BUFFER_SIZE] != '\n') {
+        offset++;
+    }
+    return offset;
+}
+
+size_t Logger::getSpan(uint32_t offset, const char** data) {
+    // 返回从 offset 开始、在缓冲中连续存放的一段；跨越缓冲末尾时需要再取一次
+    if (offset < getOldest() || offset >= head) return 0;
+    size_t pos = offset % LOG_BUFFER_SIZE;
+    *data = ring + pos;
+    return min((size_t)(head - offset), (size_t)(LOG_BUFFER_SIZE - pos));
+}
+
+const LogStats& Logger::getStats() {
+    stats.pending = head - tail;
+    return stats;
+}
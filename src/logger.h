@@ -0,0 +1,70 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// 日志统计
+struct LogStats {
+    unsigned long lines;        // 已写入缓冲的行数
+    unsigned long dropped;      // 缓冲已满被丢弃的行数
+    unsigned long truncated;    // 超过 LOG_LINE_MAX 被截断的行数
+    size_t pending;             // 尚未输出到串口的字节数
+    size_t peakPending;
+};
+
+// 异步日志：格式化到静态环形缓冲，空闲时再按串口 FIFO 余量输出，不分配堆内存
+// 已输出到串口的内容在被覆盖前继续保留，远程读取按单调递增的字节偏移定位
+class Logger {
+private:
+    char ring[LOG_BUFFER_SIZE];
+    uint32_t head;              // 累计写入字节数（单调递增，取模得到缓冲位置）
+    uint32_t tail;              // 累计已输出到串口的字节数
+    LogStats stats;
+    
+public:
+    Logger();
+    void write(uint8_t level, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+    void drain();
+    void flush();
+    const LogStats& getStats();
+    uint32_t getHead();
+    uint32_t getOldest();
+    uint32_t alignToLine(uint32_t offset);
+    size_t getSpan(uint32_t offset, const char** data);
+};
+
+extern Logger logger;
+
+// 低于 LOG_LEVEL 的日志在编译期移除，参数不会被求值
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(fmt, ...) logger.write(LOG_LEVEL_ERROR, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_ERROR(fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(fmt, ...) logger.write(LOG_LEVEL_WARN, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_WARN(fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(fmt, ...) logger.write(LOG_LEVEL_INFO, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...) logger.write(LOG_LEVEL_DEBUG, PSTR(fmt), ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...) do {} while (0)
+#endif
+
+#endif
@@ -1,130 +1,177 @@
 #include <Arduino.h>
 #include "config.h"
+#include "logger.h"
 #include "wifi_manager.h"
 #include "timer_manager.h"
 #include "time_manager.h"
+#include "archive_manager.h"
 #include "web_server.h"
-// #include "display_manager.h"
+#include "discovery_manager.h"
+#include "task_scheduler.h"
+#include "power_manager.h"
+#include "boot_profile.h"
+#if DISPLAY_ENABLED
+#include "display_manager.h"
+#endif
+#if MQTT_ENABLED
+#include "mqtt_manager.h"
+#endif
 
 // 全局对象
 WiFiManager wifiManager;
 TimerManager timerManager;
 TimeManager timeManager;
-WebServer webServer(&wifiManager, &timerManager, &timeManager);
-// DisplayManager display(&wifiManager, &timerManager, &timeManager);
-
-// 状态变量
-unsigned long lastUpdate = 0;
-unsigned long lastWiFiCheck = 0;
-unsigned long lastTimeUpdate = 0;
+ArchiveManager archiveManager;
+WebServer webServer(&wifiManager, &timerManager, &timeManager, &archiveManager);
+DiscoveryManager discoveryManager;
+#if DISPLAY_ENABLED
+DisplayManager display(&wifiManager, &timerManager, &timeManager);
+#endif
+#if MQTT_ENABLED
+MqttManager mqttManager;
+#endif
+
+// 任务周期
 const unsigned long UPDATE_INTERVAL = 10;         // 10毫秒 - 高精度定时器更新
-const unsigned long WIFI_CHECK_INTERVAL = 30000;  // 30秒
-const unsigned long TIME_UPDATE_INTERVAL = 10000; // 10秒
+const unsigned long WIFI_CHECK_INTERVAL = 250;    // 后台连接 WiFi，连上后即开始 NTP/HTTP
+const unsigned long TIME_UPDATE_INTERVAL = 50;    // 50毫秒 - 轮询 NTP 回复
+const unsigned long ARCHIVE_CHECK_INTERVAL = 1000; // 1秒
+
+// 主循环任务
+void runTimers() { timerManager.update(); }
+void runWebServer() { webServer.handleClient(); }
+void runTimeSync() { timeManager.update(); }
+void runWiFiCheck() { wifiManager.handleWiFiConnection(); }
+void runArchive() { archiveManager.update(); }
+#if DISPLAY_ENABLED
+void runDisplay() { display.update(); }
+#endif
+void runLogDrain() { logger.drain(); }
+void runDiscovery() { discoveryManager.update(); }
+#if MQTT_ENABLED
+void runMqtt() { mqttManager.update(); }
+#endif
+
+// 省电模式下有新请求或显示帧尚未发送完时不睡眠，睡眠期间有新请求时提前醒来
+bool hasPendingWork()
+{
+#if DISPLAY_ENABLED
+  if (display.isTransferActive()) return true;
+#endif
+  return webServer.hasPendingClient();
+}
 
 void setup()
 {
   Serial.begin(115200);
-  delay(1000); // 给串口时间稳定
   Serial.println();
-  Serial.println("=================================");
-  Serial.println("🐾 PetIO 控制系统启动中...");
-  Serial.println("=================================");
+  LOG_INFO("=================================");
+  LOG_INFO("🐾 PetIO 控制系统启动中...");
+  LOG_INFO("=================================");
 
-  // // 初始化 OLED 显示
-  // Serial.println("🖥️ 初始化 OLED 显示屏...");
-  // display.begin();
-  // Serial.println("✅ OLED 初始化完成!");
-
-  // 初始化时间管理器
-  Serial.println("🕐 初始化时间管理器...");
+  // 分阶段启动：先按保存的剩余时间恢复输出，WiFi、NTP 在主循环中后台完成，
+  // 各阶段耗时见 /api/system 的 "boot"
   timeManager.begin();
-  Serial.println("✅ 时间管理器初始化完成!");
-
-  // 初始化定时器管理器
-  Serial.println("⏰ 初始化定时器管理器...");
   timerManager.begin(&timeManager);
-  Serial.println("✅ 定时器管理器初始化完成!");
+  bootProfile.phase("outputs");
+
+#if DISPLAY_ENABLED
+  // 初始化 OLED 显示
+  display.begin();
+  bootProfile.phase("display");
+#endif
 
-  // 初始化 WiFi 管理器
-  Serial.println("📶 初始化 WiFi 管理器...");
-  bool wifiConnected = wifiManager.begin();
-  Serial.println("✅ WiFi 管理器初始化完成!");
+  // 初始化激活归档
+  archiveManager.begin(&timerManager.getHistory());
+  bootProfile.phase("archive");
+  logger.flush();
 
-  // 初始化 Web 服务器
-  Serial.println("🌐 启动 Web 服务器...");
+  // WiFi 在后台连接，超时后切换到 AP 模式
+  wifiManager.begin();
+  bootProfile.phase("wifi_start");
+
+  // Web 服务器不依赖 WiFi 是否已连接，连上后即可访问
   webServer.begin();
-  Serial.println("✅ Web 服务器启动完成!");
+  bootProfile.phase("http");
+
+  // 设备发现（WiFi 连接后自动开始广播）
+  discoveryManager.begin(&timerManager, &timeManager);
+
+#if MQTT_ENABLED
+  // MQTT 客户端（WiFi 连接后自动连接服务器）
+  mqttManager.begin(&timerManager, &timeManager);
+#endif
 
   // 启动信息
-  Serial.println("=================================");
-  Serial.println("✅ 系统启动完成！");
-  Serial.println("=================================");
+  LOG_INFO("=================================");
+  LOG_INFO("✅ 系统启动完成，用时 %lums", millis());
+  LOG_INFO("=================================");
 
-  if (wifiConnected)
+  if (wifiManager.isConnecting())
   {
-    Serial.println("🌍 WiFi 模式 - 可通过以下地址访问:");
-    Serial.println("   http://" + wifiManager.getLocalIP());
-    Serial.println("🕐 NTP 时间同步已启用");
+    LOG_INFO("📶 正在后台连接 WiFi，连接成功后日志中会给出访问地址");
   }
   else
   {
-    Serial.println("📡 AP 模式 - 请连接以下热点:");
-    Serial.println("   SSID: " + String(DEFAULT_AP_SSID));
-    Serial.println("   密码: 无密码");
-    Serial.println("   然后访问: http://" + wifiManager.getAPIP());
-    Serial.println("⚠️  AP 模式下定时器功能受限，请连接 WiFi 以启用完整功能");
+    LOG_INFO("📡 AP 模式 - 请连接以下热点:");
+    LOG_INFO("   SSID: %s", DEFAULT_AP_SSID);
+    LOG_INFO("   密码: 无密码");
+    LOG_INFO("   然后访问: http://%s", wifiManager.getAPIP().c_str());
+    LOG_WARN("⚠️  AP 模式下定时器功能受限，请连接 WiFi 以启用完整功能");
   }
 
-  Serial.println("=================================");
-  Serial.println();
+  LOG_INFO("=================================");
 
   // 显示可用引脚信息
-  Serial.print("🔌 可用引脚: ");
-  for (int i = 0; i < AVAILABLE_PINS_COUNT; i++)
+  char pins[64];
+  size_t len = 0;
+  for (int i = 0; i < AVAILABLE_PINS_COUNT && len < sizeof(pins); i++)
   {
-    Serial.print(AVAILABLE_PINS[i]);
-    if (i < AVAILABLE_PINS_COUNT - 1)
-      Serial.print(", ");
+    len += snprintf(pins + len, sizeof(pins) - len, i < AVAILABLE_PINS_COUNT - 1 ? "%d, " : "%d", AVAILABLE_PINS[i]);
   }
-  Serial.println();
+  LOG_INFO("🔌 可用引脚: %s", pins);
 
   // 显示定时器信息
-  Serial.println("⏰ 已加载定时器数量: " + String(timerManager.getTimerCount()));
-
-  Serial.println();
-  Serial.println("📝 系统日志:");
-  Serial.println("----------------------------------------");
+  LOG_INFO("⏰ 已加载定时器数量: %d", timerManager.getTimerCount());
+
+  LOG_INFO("📝 系统日志:");
+  LOG_INFO("----------------------------------------");
+
+  // 注册主循环任务：名称、周期（0 为每轮运行）、优先级（越小越优先）、单次时间预算（微秒）
+  // 定时器输出优先于 Web 请求；同一轮中每个到期任务只运行一次
+  // 定时器任务只是轮询，省电模式下按 TimerManager 给出的下一次开关时间唤醒
+  scheduler.add("timers", runTimers, UPDATE_INTERVAL, 0, 2000, false);
+  scheduler.add("http", runWebServer, 0, 1, 50000);
+  // WiFi、NTP 任务只是轮询，不为它们唤醒；NTP 请求和回复都不阻塞
+  scheduler.add("ntp", runTimeSync, TIME_UPDATE_INTERVAL, 2, 2000, false);
+  scheduler.add("wifi", runWiFiCheck, WIFI_CHECK_INTERVAL, 2, 1000, false);
+  scheduler.add("archive", runArchive, ARCHIVE_CHECK_INTERVAL, 3, 100000);
+#if DISPLAY_ENABLED
+  // 显示任务不为它唤醒：内容每秒检查一次，不超过最长睡眠时间；分块发送一帧期间由 hasPendingWork() 阻止睡眠
+  scheduler.add("display", runDisplay, 20, 3, DISPLAY_SLICE_US + 2000, false);
+#endif
+  scheduler.add("log", runLogDrain, 0, 4, 2000);
+  // 发现任务需要频繁处理 mDNS 查询，但不为它唤醒；省电模式下最多延迟 POWER_MAX_SLEEP_MS
+  scheduler.add("discovery", runDiscovery, 50, 3, 10000, false);
+#if MQTT_ENABLED
+  // 命令延迟最多一个周期；DNS 解析不阻塞，重连时 TCP 连接最多阻塞 MQTT_CONNECT_TIMEOUT（300ms）
+  scheduler.add("mqtt", runMqtt, 20, 3, 20000, false);
+#endif
+
+  powerManager.begin(&timerManager, hasPendingWork);
+  bootProfile.phase("services");
+
+  // 启动阶段直接输出全部日志，之后只在主循环空闲时输出
+  logger.flush();
 }
 
 void loop()
 {
-  unsigned long currentTime = millis();
-
-  // 处理 Web 请求 (优先级最高)
-  webServer.handleClient();
-
-  // 高频更新定时器 (10ms间隔，确保定时器精度)
-  if (currentTime - lastUpdate >= UPDATE_INTERVAL)
-  {
-    timerManager.update();
-    lastUpdate = currentTime;
-  }
-
-  // 定期更新时间同步
-  if (currentTime - lastTimeUpdate >= TIME_UPDATE_INTERVAL)
-  {
-    timeManager.update();
-    lastTimeUpdate = currentTime;
-  }
-
-  // 定期检查 WiFi 连接
-  if (currentTime - lastWiFiCheck >= WIFI_CHECK_INTERVAL)
-  {
-    wifiManager.handleWiFiConnection();
-    lastWiFiCheck = currentTime;
-  }
+  // 依次运行已到期的任务，最紧急的优先
+  scheduler.run();
 
-  // display.update();
+  // 省电模式下空闲时浅睡眠到下一个事件
+  powerManager.idle();
 
   // 让系统有时间处理其他任务
   yield();
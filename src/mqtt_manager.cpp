@@ -0,0 +1,627 @@
+#include "mqtt_manager.h"
+#include <lwip/dns.h>
+#include "logger.h"
+#include "boot_profile.h"
+
+// 报文前预留固定头的位置（1 字节类型 + 最多 4 字节剩余长度），内容写完后再回填
+static const size_t TX_HEADER_ROOM = 5;
+// 事件的报文 ID 由序号导出（1 ~ 65534），订阅使用 65535
+static const uint16_t SUBSCRIBE_PACKET_ID = 0xFFFF;
+
+// 异步 DNS 解析结果，回调在网络栈中执行，只写这两个变量
+static volatile int8_t dnsResult = 0;     // 0 等待中，1 成功，-1 失败
+static uint32_t dnsAddress = 0;
+
+static void onDnsFound(const char* name, const ip_addr_t* addr, void* arg) {
+    if (addr) {
+        dnsAddress = ip_addr_get_ip4_u32(addr);
+        dnsResult = 1;
+    } else {
+        dnsResult = -1;
+    }
+}
+
+static uint16_t packetIdFor(uint32_t seq) {
+    return seq % 0xFFFE + 1;
+}
+
+static size_t putU16(uint8_t* buf, size_t pos, uint16_t v) {
+    buf[pos] = v >> 8;
+    buf[pos + 1] = v;
+    return pos + 2;
+}
+
+static size_t putString(uint8_t* buf, size_t pos, const char* s) {
+    size_t len = strlen(s);
+    pos = putU16(buf, pos, len);
+    memcpy(buf + pos, s, len);
+    return pos + len;
+}
+
+MqttManager::MqttManager() {
+    timerManager = nullptr;
+    timeManager = nullptr;
+    topicBase[0] = '\0';
+    brokerIsName = false;
+    brokerResolved = false;
+    state = MQTT_DISCONNECTED;
+    stateSince = 0;
+    reconnectDelay = MQTT_RECONNECT_MIN;
+    lastTx = 0;
+    pingSent = 0;
+    pingOutstanding = false;
+    ackedSeq = 0;
+    sentSeq = 0;
+    maxSentSeq = 0;
+    ackedMask = 0;
+    ackWaitSince = 0;
+    subscribed = false;
+    onlineSent = false;
+    pendingAckCount = 0;
+    publishedVersion = 0;
+    statePending = false;
+    lastStatePublish = 0;
+    rxPhase = 0;
+    rxHeader = 0;
+    rxLength = 0;
+    rxShift = 0;
+    rxPos = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void MqttManager::begin(TimerManager* tm, TimeManager* timeM) {
+    timerManager = tm;
+    timeManager = timeM;
+    snprintf(topicBase, sizeof(topicBase), "%s/%06x", MQTT_TOPIC_PREFIX, ESP.getChipId());
+    stateSince = millis() - reconnectDelay;   // WiFi 连接后立即尝试
+    if (MQTT_BROKER[0] == '\0') {
+        LOG_WARN("MQTT 已启用但未配置服务器（MQTT_BROKER）");
+    }
+    brokerResolved = brokerIP.fromString(MQTT_BROKER);
+    brokerIsName = !brokerResolved;
+}
+
+void MqttManager::update() {
+    if (!timerManager || MQTT_BROKER[0] == '\0') return;
+
+    if (!WiFi.isConnected()) {
+        if (state != MQTT_DISCONNECTED) disconnect("WiFi 断开");
+        return;
+    }
+
+    unsigned long now = millis();
+    if (state == MQTT_DISCONNECTED) {
+        if (now - stateSince >= reconnectDelay) connect();
+        return;
+    }
+
+    if (state == MQTT_RESOLVING) {
+        if (dnsResult > 0) {
+            brokerIP = IPAddress(dnsAddress);
+            brokerResolved = true;
+            openConnection();
+        } else if (dnsResult < 0 || now - stateSince >= MQTT_DNS_TIMEOUT) {
+            stats.connectFailures++;
+            disconnect(dnsResult < 0 ? "无法解析服务器地址" : "解析服务器地址超时");
+        }
+        return;
+    }
+
+    if (!client.connected()) {
+        disconnect("服务器关闭了连接");
+        return;
+    }
+
+    readPackets();
+    if (state == MQTT_CONNECTING && now - stateSince >= MQTT_ACK_TIMEOUT) {
+        stats.connectFailures++;
+        disconnect("等待 CONNACK 超时");
+    }
+    if (state != MQTT_CONNECTED) return;
+
+    // 订阅、在线标记和命令确认发出之前不发布其他消息，但仍检查心跳
+    bool controlSent = flushControl();
+    if (state != MQTT_CONNECTED) return;
+
+    // 处理入站报文时可能已发送报文或收到确认，重新取时间
+    now = millis();
+
+    // 心跳：一段时间没有发送任何报文时发送 PINGREQ
+    if (pingOutstanding) {
+        if (now - pingSent >= MQTT_KEEPALIVE * 1000UL / 2) {
+            disconnect("心跳超时");
+            return;
+        }
+    } else if (now - lastTx >= MQTT_KEEPALIVE * 1000UL / 2) {
+        static const uint8_t ping[] = {0xC0, 0x00};
+        if (send(ping, sizeof(ping))) {
+            pingOutstanding = true;
+            pingSent = now;
+        }
+    }
+
+    // 已发送的事件迟迟没有确认，重连后从游标处重发
+    if (sentSeq > ackedSeq && now - ackWaitSince >= MQTT_ACK_TIMEOUT) {
+        disconnect("事件确认超时");
+        return;
+    }
+
+    if (!controlSent) return;
+    publishState();
+    publishEvents();
+}
+
+void MqttManager::connect() {
+    // 主机名解析一次后缓存，连接失败时重新解析；解析是异步的，在 update() 中等待结果
+    if (!brokerResolved) {
+        ip_addr_t addr;
+        dnsResult = 0;
+        err_t err = dns_gethostbyname(MQTT_BROKER, &addr, onDnsFound, nullptr);
+        if (err == ERR_INPROGRESS) {
+            state = MQTT_RESOLVING;
+            stateSince = millis();
+            return;
+        }
+        if (err != ERR_OK) {
+            stats.connectFailures++;
+            disconnect("无法解析服务器地址");
+            return;
+        }
+        brokerIP = IPAddress(ip_addr_get_ip4_u32(&addr));
+        brokerResolved = true;
+    }
+    openConnection();
+}
+
+void MqttManager::openConnection() {
+    // TCP 连接是同步的，最多阻塞 MQTT_CONNECT_TIMEOUT
+    client.setTimeout(MQTT_CONNECT_TIMEOUT);
+    if (!client.connect(brokerIP, MQTT_PORT)) {
+        stats.connectFailures++;
+        if (brokerIsName) brokerResolved = false;
+        disconnect("无法连接服务器");
+        return;
+    }
+    client.setNoDelay(true);
+
+    // CONNECT：清除会话，遗嘱为保留的 online = "0"
+    static const uint8_t protocol[] = {0x00, 0x04, 'M', 'Q', 'T', 'T', 0x04};
+    bool auth = MQTT_USER[0] != '\0';
+    size_t pos = TX_HEADER_ROOM;
+    memcpy(txBuf + pos, protocol, sizeof(protocol));
+    pos += sizeof(protocol);
+    txBuf[pos++] = 0x02 | 0x04 | 0x20 | (auth ? 0xC0 : 0x00);
+    pos = putU16(txBuf, pos, MQTT_KEEPALIVE);
+
+    char clientId[24];
+    snprintf(clientId, sizeof(clientId), "petio-%06x", ESP.getChipId());
+    char willTopic[sizeof(topicBase) + 8];
+    snprintf(willTopic, sizeof(willTopic), "%s/online", topicBase);
+    pos = putString(txBuf, pos, clientId);
+    pos = putString(txBuf, pos, willTopic);
+    pos = putString(txBuf, pos, "0");
+    if (auth) {
+        pos = putString(txBuf, pos, MQTT_USER);
+        pos = putString(txBuf, pos, MQTT_PASSWORD);
+    }
+
+    state = MQTT_CONNECTING;
+    stateSince = millis();
+    rxPhase = 0;
+    if (!finishPacket(0x10, pos)) {
+        stats.connectFailures++;
+        disconnect("CONNECT 发送失败");
+    }
+}
+
+void MqttManager::disconnect(const char* reason) {
+    if (state == MQTT_CONNECTED) {
+        stats.disconnects++;
+        reconnectDelay = MQTT_RECONNECT_MIN;
+        LOG_WARN("MQTT 连接断开: %s", reason);
+    } else {
+        // 连接失败时退避，避免服务器不可用时反复阻塞主循环
+        reconnectDelay = min(reconnectDelay * 2, (unsigned long)MQTT_RECONNECT_MAX);
+        LOG_WARN("MQTT 连接失败: %s，%lu 秒后重试", reason, reconnectDelay / 1000);
+    }
+
+    client.stop();
+    state = MQTT_DISCONNECTED;
+    stateSince = millis();
+    pingOutstanding = false;
+    rxPhase = 0;
+
+    // 清除会话：服务器会丢弃订阅和未确认的命令，重连后重新订阅
+    subscribed = false;
+    onlineSent = false;
+    pendingAckCount = 0;
+
+    // 未确认的事件重连后重发（乱序确认的也一并重发，接收端按 seq 去重）
+    sentSeq = ackedSeq;
+    ackedMask = 0;
+}
+
+void MqttManager::readPackets() {
+    // 每轮最多处理一个缓冲的数据量，消息很多时分多轮处理
+    int budget = MQTT_RX_BUFFER;
+    while (state != MQTT_DISCONNECTED && budget > 0 && client.available() > 0) {
+        if (rxPhase == 2) {
+            uint32_t remaining = rxLength - rxPos;
+            int got;
+            if (rxPos < MQTT_RX_BUFFER) {
+                got = client.read(rxBuf + rxPos, min(remaining, (uint32_t)(MQTT_RX_BUFFER - rxPos)));
+            } else {
+                // 超出缓冲的部分直接丢弃
+                uint8_t skip[64];
+                got = client.read(skip, min(remaining, (uint32_t)sizeof(skip)));
+            }
+            if (got <= 0) break;
+            rxPos += got;
+            budget -= got;
+            if (rxPos == rxLength) {
+                rxPhase = 0;
+                handlePacket(rxHeader, rxBuf, rxLength, rxLength > MQTT_RX_BUFFER);
+            }
+            continue;
+        }
+
+        int c = client.read();
+        if (c < 0) break;
+        budget--;
+        if (rxPhase == 0) {
+            rxHeader = c;
+            rxLength = 0;
+            rxShift = 0;
+            rxPhase = 1;
+        } else {
+            // 剩余长度：变长编码，每字节 7 位，最多 4 字节
+            rxLength |= (uint32_t)(c & 0x7F) << rxShift;
+            rxShift += 7;
+            if (!(c & 0x80)) {
+                rxPos = 0;
+                rxPhase = 2;
+                if (rxLength == 0) {
+                    rxPhase = 0;
+                    handlePacket(rxHeader, rxBuf, 0, false);
+                }
+            } else if (rxShift >= 28) {
+                disconnect("报文长度无效");
+            }
+        }
+    }
+}
+
+void MqttManager::handlePacket(uint8_t header, const uint8_t* data, uint32_t length, bool truncated) {
+    uint32_t stored = min(length, (uint32_t)MQTT_RX_BUFFER);
+
+    switch (header >> 4) {
+    case 2: { // CONNACK
+        if (state != MQTT_CONNECTING || length < 2) break;
+        if (data[1] != 0) {
+            char reason[64];
+            snprintf(reason, sizeof(reason), "服务器拒绝连接（返回码 %d）", data[1]);
+            stats.connectFailures++;
+            disconnect(reason);
+            break;
+        }
+        state = MQTT_CONNECTED;
+        stateSince = millis();
+        stats.connects++;
+        ackWaitSince = millis();
+        bootProfile.milestone("mqtt_connected");
+
+        // 订阅和在线标记由 flushControl 发出，发送缓冲不足时下一轮重试
+        flushControl();
+        if (state != MQTT_CONNECTED) break;
+
+        statePending = true;
+        LOG_INFO("MQTT 已连接: %s:%d，主题 %s/#", MQTT_BROKER, MQTT_PORT, topicBase);
+        break;
+    }
+    case 3: { // PUBLISH
+        uint8_t qos = (header >> 1) & 0x03;
+        if (stored < 2) break;
+        uint16_t topicLen = (data[0] << 8) | data[1];
+        size_t pos = 2 + topicLen;
+        uint16_t packetId = 0;
+        if (qos > 0) {
+            if (pos + 2 > stored) break;
+            packetId = (data[pos] << 8) | data[pos + 1];
+            pos += 2;
+        }
+        if (pos > stored) break;
+
+        // 先确认再执行：服务器重发时不会重复执行非幂等的命令（如添加定时器）
+        if (qos > 0 && !ackPublish(packetId)) break;
+
+        if (truncated) {
+            stats.droppedPackets++;
+            LOG_WARN("MQTT 消息过长（%u 字节），已丢弃", (unsigned)length);
+            break;
+        }
+
+        char topic[64];
+        size_t baseLen = strlen(topicBase);
+        if (topicLen >= sizeof(topic) || topicLen <= baseLen + 5) break;
+        memcpy(topic, data + 2, topicLen);
+        topic[topicLen] = '\0';
+        if (strncmp(topic, topicBase, baseLen) != 0 || strncmp(topic + baseLen, "/cmd/", 5) != 0) break;
+        handleCommand(topic + baseLen + 5, data + pos, stored - pos);
+        break;
+    }
+    case 4: { // PUBACK
+        if (length < 2) break;
+        uint16_t packetId = (data[0] << 8) | data[1];
+        for (uint32_t seq = ackedSeq + 1; seq <= sentSeq; seq++) {
+            if (packetIdFor(seq) == packetId) {
+                ackedMask |= 1 << (seq - ackedSeq - 1);
+                advanceAcked();
+                break;
+            }
+        }
+        break;
+    }
+    case 9: // SUBACK
+        if (length >= 3 && data[2] == 0x80) {
+            LOG_WARN("MQTT 命令主题订阅被拒绝");
+        }
+        break;
+    case 13: // PINGRESP
+        pingOutstanding = false;
+        break;
+    }
+}
+
+bool MqttManager::flushControl() {
+    if (!subscribed) {
+        // 订阅命令主题（QoS 1）
+        size_t pos = putU16(txBuf, TX_HEADER_ROOM, SUBSCRIBE_PACKET_ID);
+        char topic[sizeof(topicBase) + 16];
+        snprintf(topic, sizeof(topic), "%s/cmd/manual", topicBase);
+        pos = putString(txBuf, pos, topic);
+        txBuf[pos++] = 1;
+        snprintf(topic, sizeof(topic), "%s/cmd/timers", topicBase);
+        pos = putString(txBuf, pos, topic);
+        txBuf[pos++] = 1;
+        if (!finishPacket(0x82, pos)) return false;
+        subscribed = true;
+    }
+
+    if (!onlineSent) {
+        // 在线标记（保留），覆盖上次断线留下的遗嘱
+        size_t pos = beginPublish("online", 0);
+        txBuf[pos++] = '1';
+        if (!finishPacket(0x31, pos)) return false;
+        onlineSent = true;
+    }
+
+    // 推迟的命令确认按收到的顺序发出
+    uint8_t sent = 0;
+    while (sent < pendingAckCount) {
+        uint16_t id = pendingAcks[sent];
+        uint8_t ack[4] = {0x40, 0x02, (uint8_t)(id >> 8), (uint8_t)id};
+        if (!send(ack, sizeof(ack))) break;
+        sent++;
+    }
+    if (state != MQTT_CONNECTED) return false;
+    if (sent > 0) {
+        pendingAckCount -= sent;
+        memmove(pendingAcks, pendingAcks + sent, pendingAckCount * sizeof(pendingAcks[0]));
+    }
+    return pendingAckCount == 0;
+}
+
+bool MqttManager::ackPublish(uint16_t packetId) {
+    // 前面还有推迟的确认时排在后面，保证确认按顺序发出
+    if (pendingAckCount == 0) {
+        uint8_t ack[4] = {0x40, 0x02, (uint8_t)(packetId >> 8), (uint8_t)packetId};
+        if (send(ack, sizeof(ack))) return true;
+        if (state != MQTT_CONNECTED) return false;
+    }
+    if (pendingAckCount >= MQTT_PENDING_ACKS) {
+        // 不静默丢弃：断开后命令不执行，由发送方重发
+        disconnect("命令确认积压过多");
+        return false;
+    }
+    pendingAcks[pendingAckCount++] = packetId;
+    stats.acksDeferred++;
+    return true;
+}
+
+void MqttManager::handleCommand(const char* command, const uint8_t* payload, size_t length) {
+    stats.commands++;
+
+    JsonDocument doc;
+    JsonDocument result;
+    result["command"] = command;
+    bool ok = false;
+
+    if (deserializeJson(doc, (const char*)payload, length)) {
+        result["message"] = "JSON 格式错误";
+    } else {
+        if (!doc["ref"].isNull()) result["ref"] = doc["ref"];
+
+        if (strcmp(command, "manual") == 0) {
+            // 与 POST /api/manual 相同
+            int pin = doc["pin"] | -1;
+            float duration = doc["duration"];
+            bool isPWM = doc["isPWM"].as<bool>();
+            int pwmValue = doc["pwmValue"].is<int>() ? doc["pwmValue"].as<int>() : 512; // 默认值50%
+            if (!timerManager->getPinState(pin)) {
+                result["message"] = "引脚无效";
+            } else {
+                timerManager->executeManualControl(pin, duration, isPWM, pwmValue);
+                result["message"] = "手动控制执行成功";
+                ok = true;
+            }
+        } else if (strcmp(command, "timers") == 0) {
+            // 与 POST /api/timers/batch 相同：校验全部通过才应用
+            JsonArray ops = doc["operations"].is<JsonArray>() ? doc["operations"].as<JsonArray>() : doc.as<JsonArray>();
+            if (ops.isNull() || ops.size() == 0) {
+                result["message"] = "缺少操作列表";
+            } else if (timerManager->applyBatch(ops, result["results"].to<JsonArray>())) {
+                result["message"] = "批量操作完成";
+                ok = true;
+            } else {
+                result["message"] = "批量操作校验失败，未做任何修改";
+            }
+        } else {
+            result["message"] = "未知命令";
+        }
+    }
+
+    result["success"] = ok;
+    if (!ok) stats.commandErrors++;
+    LOG_INFO("MQTT 命令 %s: %s", command, result["message"].as<const char*>());
+    if (!publishJson("cmd/result", result, 0x30)) {
+        LOG_WARN("MQTT 命令结果发送失败");
+    }
+}
+
+void MqttManager::publishState() {
+    // 状态用 QoS 0 保留消息：每次都是完整的最新状态，重连后会重新发布
+    uint32_t version = timerManager->getStateVersion();
+    if (!statePending && version == publishedVersion) return;
+    unsigned long now = millis();
+    if (!statePending && now - lastStatePublish < MQTT_STATE_MIN_GAP) return;
+
+    JsonDocument doc;
+    doc["version"] = FIRMWARE_VERSION;
+    doc["stateVersion"] = version;
+    doc["ip"] = WiFi.localIP().toString();
+    doc["uptime"] = now / 1000;
+    doc["timeValid"] = timeManager && timeManager->isTimeValid();
+    doc["activeTimers"] = timerManager->getActiveTimerCount();
+    doc["totalTimers"] = timerManager->getTimerCount();
+    doc["bootId"] = timerManager->getHistory().getBootId();
+    doc["lastSeq"] = timerManager->getHistory().getLastSeq();
+    JsonArray pins = doc["pins"].to<JsonArray>();
+    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        const PinState* ps = timerManager->getPinState(AVAILABLE_PINS[i]);
+        if (!ps) continue;
+        JsonObject p = pins.add<JsonObject>();
+        p["pin"] = ps->pin;
+        p["state"] = ps->level ? 1 : 0;
+        p["pwmValue"] = ps->pwmValue;
+    }
+
+    if (!publishJson("state", doc, 0x31)) return;
+    statePending = false;
+    publishedVersion = version;
+    lastStatePublish = now;
+    stats.statePublished++;
+}
+
+void MqttManager::publishEvents() {
+    skipLostEvents();
+
+    HistoryManager& history = timerManager->getHistory();
+    uint32_t latest = history.getLastSeq();
+    while (sentSeq < latest && sentSeq - ackedSeq < MQTT_INFLIGHT) {
+        const ActivationRecord* r = history.get(sentSeq + 1);
+        if (!r) break;
+
+        // 与 /api/history 的事件格式相同；序号重启后从 1 重新开始，接收端按 (bootId, seq) 去重
+        JsonDocument doc;
+        doc["bootId"] = history.getBootId();
+        doc["seq"] = r->seq;
+        doc["timerId"] = r->timerId;
+        doc["pin"] = r->pin;
+        doc["start"] = r->epochStart;
+        doc["requestedMs"] = r->requestedMs;
+        doc["actualMs"] = r->actualMs;
+        doc["pwmValue"] = r->pwmValue;
+        doc["source"] = triggerSourceName(r->source);
+        if (!publishJson("events", doc, 0x32, packetIdFor(r->seq))) break;
+
+        if (sentSeq == ackedSeq) ackWaitSince = millis();
+        sentSeq++;
+        if (sentSeq <= maxSentSeq) {
+            stats.eventsResent++;
+        } else {
+            maxSentSeq = sentSeq;
+        }
+    }
+}
+
+void MqttManager::skipLostEvents() {
+    // 离线期间历史缓冲写满，最旧的事件已被覆盖，游标跳到仍保留的最旧事件
+    uint32_t oldest = timerManager->getHistory().getOldestSeq();
+    if (oldest <= ackedSeq + 1) return;
+
+    uint32_t lost = oldest - 1 - ackedSeq;
+    stats.eventsLost += lost;
+    ackedMask = lost >= 8 ? 0 : ackedMask >> lost;
+    ackedSeq = oldest - 1;
+    if (sentSeq < ackedSeq) sentSeq = ackedSeq;
+    advanceAcked();
+    LOG_WARN("MQTT 有 %u 条事件未能发布，已被新事件覆盖", (unsigned)lost);
+}
+
+void MqttManager::advanceAcked() {
+    bool progressed = false;
+    while (ackedMask & 1) {
+        ackedMask >>= 1;
+        ackedSeq++;
+        stats.eventsAcked++;
+        progressed = true;
+    }
+    if (progressed) ackWaitSince = millis();
+}
+
+size_t MqttManager::beginPublish(const char* suffix, uint16_t packetId) {
+    // 主题 <base>/<suffix>，QoS 1 时后跟报文 ID
+    size_t baseLen = strlen(topicBase);
+    size_t suffixLen = strlen(suffix);
+    size_t pos = putU16(txBuf, TX_HEADER_ROOM, baseLen + 1 + suffixLen);
+    memcpy(txBuf + pos, topicBase, baseLen);
+    pos += baseLen;
+    txBuf[pos++] = '/';
+    memcpy(txBuf + pos, suffix, suffixLen);
+    pos += suffixLen;
+    if (packetId) pos = putU16(txBuf, pos, packetId);
+    return pos;
+}
+
+bool MqttManager::finishPacket(uint8_t header, size_t end) {
+    // 回填固定头：类型 + 变长编码的剩余长度
+    uint32_t remaining = end - TX_HEADER_ROOM;
+    uint8_t len[4];
+    size_t n = 0;
+    do {
+        uint8_t b = remaining & 0x7F;
+        remaining >>= 7;
+        if (remaining) b |= 0x80;
+        len[n++] = b;
+    } while (remaining);
+
+    size_t start = TX_HEADER_ROOM - 1 - n;
+    txBuf[start] = header;
+    memcpy(txBuf + start + 1, len, n);
+    return send(txBuf + start, end - start);
+}
+
+bool MqttManager::send(const uint8_t* data, size_t length) {
+    // TCP 发送缓冲不足时不等待，调用方下一轮再试
+    if (client.availableForWrite() < (int)length) {
+        stats.sendDeferred++;
+        return false;
+    }
+    if (client.write(data, length) != length) {
+        disconnect("发送失败");
+        return false;
+    }
+    lastTx = millis();
+    return true;
+}
+
+bool MqttManager::publishJson(const char* suffix, JsonDocument& doc, uint8_t header, uint16_t packetId) {
+    size_t pos = beginPublish(suffix, packetId);
+    size_t len = measureJson(doc);
+    if (pos + len >= MQTT_TX_BUFFER) {
+        LOG_WARN("MQTT 消息过长（%u 字节）: %s", (unsigned)len, suffix);
+        return false;
+    }
+    serializeJson(doc, (char*)txBuf + pos, MQTT_TX_BUFFER - pos);
+    return finishPacket(header, pos + len);
+}
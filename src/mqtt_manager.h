@@ -0,0 +1,119 @@
+#ifndef MQTT_MANAGER_H
+#define MQTT_MANAGER_H
+
+#include <ESP8266WiFi.h>
+#include <ArduinoJson.h>
+#include "config.h"
+#include "timer_manager.h"
+#include "time_manager.h"
+
+// 主题（<base> = MQTT_TOPIC_PREFIX/<设备ID>）：
+//   <base>/online       保留，"1" 在线，"0" 离线（遗嘱消息）
+//   <base>/state        保留，设备状态 JSON，状态版本变化时更新
+//   <base>/events       QoS 1，每次输出激活一条，格式与 /api/history 的事件相同，另带 bootId；
+//                       序号重启后从 1 重新开始，接收端按 (bootId, seq) 去重
+//   <base>/cmd/manual   订阅，格式与 POST /api/manual 相同
+//   <base>/cmd/timers   订阅，格式与 POST /api/timers/batch 相同
+//   <base>/cmd/result   命令执行结果，带回命令中的 "ref" 字段
+enum MqttState {
+    MQTT_DISCONNECTED,
+    MQTT_RESOLVING,       // 等待 DNS 解析服务器主机名
+    MQTT_CONNECTING,      // TCP 已连接，等待 CONNACK
+    MQTT_CONNECTED
+};
+
+struct MqttStats {
+    unsigned long connects;
+    unsigned long connectFailures;
+    unsigned long disconnects;
+    unsigned long eventsAcked;      // 已被服务器确认的事件数
+    unsigned long eventsResent;     // 重连后重发的事件数
+    unsigned long eventsLost;       // 离线太久被历史环形缓冲覆盖、未能发布的事件数
+    unsigned long statePublished;
+    unsigned long commands;
+    unsigned long commandErrors;
+    unsigned long droppedPackets;   // 超过 MQTT_RX_BUFFER 的入站消息
+    unsigned long sendDeferred;     // 发送缓冲不足推迟到下一轮的次数
+    unsigned long acksDeferred;     // 推迟发送的入站命令确认
+};
+
+// MQTT 3.1.1 客户端：直接基于 WiFiClient 实现所需的报文，每次 update 只处理已到达的数据，
+// 发送前检查 TCP 发送缓冲，不等待服务器响应。
+// 事件不另外排队：历史环形缓冲就是离线缓冲，ackedSeq 是已确认的游标，
+// 收到 PUBACK 才前进，断线重连后从游标处重发。
+class MqttManager {
+private:
+    TimerManager* timerManager;
+    TimeManager* timeManager;
+    WiFiClient client;
+    char topicBase[32];
+    IPAddress brokerIP;
+    bool brokerIsName;              // MQTT_BROKER 是主机名而不是 IP 地址
+    bool brokerResolved;
+    MqttState state;
+    unsigned long stateSince;
+    unsigned long reconnectDelay;
+    unsigned long lastTx;
+    unsigned long pingSent;
+    bool pingOutstanding;
+
+    // 事件发布游标：ackedSeq 之后最多 MQTT_INFLIGHT 条已发送未确认
+    uint32_t ackedSeq;
+    uint32_t sentSeq;
+    uint32_t maxSentSeq;            // 断线前发送过的最大序号，用于统计重发
+    uint8_t ackedMask;              // bit i：ackedSeq + 1 + i 已乱序确认
+    unsigned long ackWaitSince;
+
+    // 连接后必须发出的控制报文：发送缓冲不足时留到下一轮重试，不会丢弃
+    bool subscribed;
+    bool onlineSent;
+    uint16_t pendingAcks[MQTT_PENDING_ACKS];
+    uint8_t pendingAckCount;
+
+    uint32_t publishedVersion;
+    bool statePending;
+    unsigned long lastStatePublish;
+
+    // 入站报文解析
+    uint8_t rxPhase;                // 0 固定头，1 剩余长度，2 报文内容
+    uint8_t rxHeader;
+    uint32_t rxLength;
+    uint8_t rxShift;
+    uint32_t rxPos;
+    uint8_t rxBuf[MQTT_RX_BUFFER];
+    uint8_t txBuf[MQTT_TX_BUFFER];
+
+    MqttStats stats;
+
+    void connect();
+    void openConnection();
+    void disconnect(const char* reason);
+    void readPackets();
+    bool flushControl();
+    bool ackPublish(uint16_t packetId);
+    void handlePacket(uint8_t header, const uint8_t* data, uint32_t length, bool truncated);
+    void handleCommand(const char* command, const uint8_t* payload, size_t length);
+    void publishState();
+    void publishEvents();
+    void skipLostEvents();
+    void advanceAcked();
+
+    size_t beginPublish(const char* suffix, uint16_t packetId);
+    bool finishPacket(uint8_t header, size_t end);
+    bool send(const uint8_t* data, size_t length);
+    bool publishJson(const char* suffix, JsonDocument& doc, uint8_t header, uint16_t packetId = 0);
+
+public:
+    MqttManager();
+    void begin(TimerManager* tm, TimeManager* timeM);
+    void update();
+
+    bool isConnected() const { return state == MQTT_CONNECTED; }
+    const char* getTopicBase() const { return topicBase; }
+    uint32_t getAckedSeq() const { return ackedSeq; }
+    const MqttStats& getStats() const { return stats; }
+};
+
+extern MqttManager mqttManager; // 定义在 main.cpp
+
+#endif
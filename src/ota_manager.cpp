@@ -0,0 +1,163 @@
+#include "ota_manager.h"
+#include "logger.h"
+
+static bool parseHex(const String& hex, uint8_t* out, size_t len) {
+    if (hex.length() != len * 2) return false;
+    for (size_t i = 0; i < len; i++) {
+        char hi = hex[i * 2];
+        char lo = hex[i * 2 + 1];
+        if (!isxdigit((unsigned char)hi) || !isxdigit((unsigned char)lo)) return false;
+        char byte[3] = {hi, lo, 0};
+        out[i] = strtoul(byte, nullptr, 16);
+    }
+    return true;
+}
+
+OtaManager::OtaManager() {
+    memset(&status, 0, sizeof(status));
+    status.state = OTA_IDLE;
+    verifySha256 = false;
+    expectMD5 = false;
+    memset(trailer, 0, sizeof(trailer));
+}
+
+bool OtaManager::begin(size_t expected, const String& md5, const String& sha256Hex) {
+    memset(&status, 0, sizeof(status));
+    status.state = OTA_RECEIVING;
+    status.expected = expected;
+    status.startTime = millis();
+    verifySha256 = false;
+    expectMD5 = false;
+    memset(trailer, 0, sizeof(trailer));
+    
+    // 始终按剩余空间开始：摘要不匹配时 end(false) 会因数据不足而失败，新固件不会被启用
+    uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
+    if (!Update.begin(maxSketchSpace)) {
+        LOG_ERROR("无法开始固件更新: %s", Update.getErrorString().c_str());
+        fail("无法开始固件更新");
+        return false;
+    }
+    
+    if (md5.length() > 0) {
+        if (md5.length() != 32 || !Update.setMD5(md5.c_str())) {
+            fail("MD5 格式无效");
+            Update.end(false);
+            return false;
+        }
+        expectMD5 = true;
+    }
+    
+    if (sha256Hex.length() > 0) {
+        if (!parseHex(sha256Hex, expectedSha256, sizeof(expectedSha256))) {
+            fail("SHA-256 格式无效");
+            Update.end(false);
+            return false;
+        }
+        verifySha256 = true;
+        br_sha256_init(&sha256);
+    }
+    
+    status.minFreeHeap = ESP.getFreeHeap();
+    LOG_INFO("固件更新已开始，校验: %s%s", expectMD5 ? "MD5 " : "", verifySha256 ? "SHA-256" : "");
+    return true;
+}
+
+bool OtaManager::write(uint8_t* data, size_t len) {
+    if (status.state != OTA_RECEIVING) return false;
+    
+    if (Update.write(data, len) != len) {
+        LOG_ERROR("固件写入失败: %s", Update.getErrorString().c_str());
+        fail("固件写入失败");
+        Update.end(false);
+        return false;
+    }
+    if (verifySha256) {
+        br_sha256_update(&sha256, data, len);
+    }
+    if (status.received == 0 && len >= 2 && data[0] == 0x1F && data[1] == 0x8B) {
+        status.compressed = true;
+    }
+    
+    // 只保留末尾 4 字节，用于读取 gzip 的原始大小
+    for (size_t i = len > 4 ? len - 4 : 0; i < len; i++) {
+        memmove(trailer, trailer + 1, 3);
+        trailer[3] = data[i];
+    }
+    status.received += len;
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (freeHeap < status.minFreeHeap) status.minFreeHeap = freeHeap;
+    return true;
+}
+
+bool OtaManager::end() {
+    if (status.state != OTA_RECEIVING) return false;
+    
+    if (verifySha256) {
+        uint8_t digest[32];
+        br_sha256_out(&sha256, digest);
+        if (memcmp(digest, expectedSha256, sizeof(digest)) != 0) {
+            LOG_ERROR("固件 SHA-256 不匹配，已放弃更新");
+            fail("SHA-256 校验失败");
+            Update.end(false);
+            return false;
+        }
+        status.sha256Checked = true;
+    }
+    
+    // MD5 由 Updater 在提交前校验
+    if (!Update.end(true)) {
+        LOG_ERROR("固件更新完成失败: %s", Update.getErrorString().c_str());
+        fail(Update.getError() == UPDATE_ERROR_MD5 ? "MD5 校验失败" : "固件更新完成失败");
+        return false;
+    }
+    status.md5Checked = expectMD5;
+    status.state = OTA_SUCCESS;
+    status.endTime = millis();
+    status.imageSize = status.compressed
+        ? (uint32_t)trailer[0] | ((uint32_t)trailer[1] << 8) | ((uint32_t)trailer[2] << 16) | ((uint32_t)trailer[3] << 24)
+        : status.received;
+    LOG_INFO("固件更新成功: %u 字节%s，%lu ms，%lu B/s", (unsigned)status.received, status.compressed ? "（gzip）" : "",
+             (unsigned long)getElapsed(), (unsigned long)getBytesPerSecond());
+    return true;
+}
+
+void OtaManager::abort() {
+    if (status.state != OTA_RECEIVING) return;
+    Update.end(false);
+    fail("固件更新被中止");
+    LOG_WARN("固件更新被中止");
+}
+
+void OtaManager::fail(const char* error) {
+    status.state = OTA_FAILED;
+    status.error = error;
+    status.endTime = millis();
+}
+
+bool OtaManager::isRunning() {
+    return status.state == OTA_RECEIVING;
+}
+
+const OtaStatus& OtaManager::getStatus() {
+    return status;
+}
+
+uint32_t OtaManager::getElapsed() {
+    if (status.state == OTA_IDLE) return 0;
+    unsigned long end = status.state == OTA_RECEIVING ? millis() : status.endTime;
+    return end - status.startTime;
+}
+
+uint32_t OtaManager::getBytesPerSecond() {
+    uint32_t elapsed = getElapsed();
+    return elapsed > 0 ? (uint64_t)status.received * 1000 / elapsed : 0;
+}
+
+const char* otaStateName(OtaState state) {
+    switch (state) {
+        case OTA_RECEIVING: return "receiving";
+        case OTA_SUCCESS: return "success";
+        case OTA_FAILED: return "failed";
+        default: return "idle";
+    }
+}
@@ -0,0 +1,58 @@
+#ifndef OTA_MANAGER_H
+#define OTA_MANAGER_H
+
+#include <Arduino.h>
+#include <Updater.h>
+#include <bearssl/bearssl.h>
+#include "config.h"
+
+// 固件更新状态
+enum OtaState {
+    OTA_IDLE,
+    OTA_RECEIVING,
+    OTA_SUCCESS,
+    OTA_FAILED
+};
+
+struct OtaStatus {
+    OtaState state;
+    size_t received;            // 已写入的固件字节数
+    size_t expected;            // 预期大小（客户端提供或按请求长度估算），0 表示未知
+    unsigned long startTime;
+    unsigned long endTime;
+    bool md5Checked;            // 客户端提供了 MD5 并已通过校验
+    bool sha256Checked;
+    bool compressed;            // gzip 压缩镜像，由 eboot 在重启时解压
+    uint32_t imageSize;         // 解压后的固件大小（gzip 尾部 ISIZE），未压缩时等于 received
+    uint32_t minFreeHeap;       // 更新期间空闲堆的最低值（每写入一块采样一次）
+    const char* error;
+};
+
+// 固件更新流水线：边接收边写入闪存，同时流式计算 SHA-256，结束时先校验摘要再提交
+// gzip 镜像按原样写入，Updater 识别 gzip 头后由 eboot 在重启时解压到应用分区，
+// 应用侧不需要解压缓冲；摘要针对上传的（压缩后的）字节计算
+class OtaManager {
+private:
+    OtaStatus status;
+    br_sha256_context sha256;
+    bool verifySha256;
+    uint8_t expectedSha256[32];
+    bool expectMD5;
+    uint8_t trailer[4];         // 最近 4 个字节，gzip 结束时即为 ISIZE
+    
+public:
+    OtaManager();
+    bool begin(size_t expected, const String& md5, const String& sha256Hex);
+    bool write(uint8_t* data, size_t len);
+    bool end();
+    void abort();
+    void fail(const char* error);
+    bool isRunning();
+    const OtaStatus& getStatus();
+    uint32_t getElapsed();
+    uint32_t getBytesPerSecond();
+};
+
+const char* otaStateName(OtaState state);
+
+#endif
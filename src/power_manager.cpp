@@ -0,0 +1,83 @@
+#include "power_manager.h"
+#include "task_scheduler.h"
+#include "logger.h"
+#include <ESP8266WiFi.h>
+
+PowerManager powerManager;
+
+PowerManager::PowerManager() {
+    timerManager = nullptr;
+    hasPendingWork = nullptr;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void PowerManager::begin(TimerManager* tm, bool (*pendingWork)()) {
+    timerManager = tm;
+    hasPendingWork = pendingWork;
+
+#if POWER_SAVE
+    // 浅睡眠只影响 STA 连接；listenInterval 决定睡眠中多久醒来接收一次信标
+    WiFi.setSleepMode(WIFI_LIGHT_SLEEP, POWER_LISTEN_INTERVAL);
+    LOG_INFO("省电模式已启用，最长睡眠 %dms", POWER_MAX_SLEEP_MS);
+#endif
+}
+
+void PowerManager::idle() {
+#if POWER_SAVE
+    if (!timerManager || !WiFi.isConnected()) return;
+
+    uint32_t timerWait = timerManager->getTimeToNextEvent();
+    uint32_t taskWait = scheduler.getTimeToNextDeadline();
+    uint32_t wait = min(min(timerWait, taskWait), (uint32_t)POWER_MAX_SLEEP_MS);
+    if (wait < POWER_WAKE_MARGIN_MS + POWER_MIN_SLEEP_MS) return;
+    if (hasPendingWork && hasPendingWork()) return;
+
+    bool forTimer = timerWait == wait;
+    unsigned long start = millis();
+    unsigned long wakeAt = start + wait - POWER_WAKE_MARGIN_MS;
+    unsigned long deadline = start + wait;
+    bool interrupted = false;
+
+    // 分段 delay：CPU 空闲时 SDK 进入浅睡眠，每段结束检查是否有新请求
+    long remaining;
+    while ((remaining = (long)(wakeAt - millis())) > 0) {
+        delay(min((uint32_t)remaining, (uint32_t)POWER_POLL_MS));
+        if (hasPendingWork && hasPendingWork()) {
+            interrupted = true;
+            break;
+        }
+    }
+
+    unsigned long woke = millis();
+    stats.sleeps++;
+    stats.sleptMs += woke - start;
+
+    if (interrupted) {
+        stats.packetWakes++;
+        return;
+    }
+
+    if (forTimer) {
+        stats.deadlineWakes++;
+    }
+    long lateness = (long)(woke - wakeAt);
+    if (lateness > 0) {
+        stats.lateWakes++;
+        stats.totalLatenessMs += lateness;
+        if ((uint32_t)lateness > stats.maxLatenessMs) {
+            stats.maxLatenessMs = lateness;
+        }
+    }
+    if (forTimer && (long)(woke - deadline) > 0) {
+        stats.missedDeadlines++;
+    }
+#endif
+}
+
+float PowerManager::getEstimatedCurrent() {
+    unsigned long uptime = millis();
+    if (uptime == 0) return POWER_ACTIVE_MA;
+
+    float sleepShare = (float)stats.sleptMs / uptime;
+    return POWER_ACTIVE_MA * (1.0f - sleepShare) + POWER_SLEEP_MA * sleepShare;
+}
@@ -0,0 +1,43 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "timer_manager.h"
+
+// 省电模式统计
+struct PowerStats {
+    unsigned long sleeps;
+    unsigned long sleptMs;          // 累计睡眠时间
+    unsigned long packetWakes;      // 因新请求提前结束睡眠的次数
+    unsigned long deadlineWakes;    // 为定时器事件醒来的次数
+    unsigned long lateWakes;        // 醒来晚于计划时间的次数
+    unsigned long missedDeadlines;  // 醒来时已经过了定时器事件时间
+    uint32_t maxLatenessMs;         // 醒来时间相对计划的最大延迟
+    unsigned long totalLatenessMs;
+};
+
+// 省电模式：主循环空闲时 delay 到下一个定时器事件或任务到期前（提前 POWER_WAKE_MARGIN_MS），
+// WiFi 设为浅睡眠后 SDK 会在 delay 期间自动关闭射频和 CPU 时钟，按 DTIM 醒来接收以保持连接。
+// 睡眠分段进行，每段之间检查是否有新连接，有请求时立即返回主循环处理。
+// 只在 STA 已连接时生效；AP 模式需要射频常开。
+class PowerManager {
+private:
+    TimerManager* timerManager;
+    bool (*hasPendingWork)();
+    PowerStats stats;
+
+public:
+    PowerManager();
+    void begin(TimerManager* tm, bool (*pendingWork)());
+    void idle();
+
+    bool isEnabled() const { return POWER_SAVE; }
+    const PowerStats& getStats() const { return stats; }
+    // 按唤醒/睡眠时间比例估算的平均电流（mA），实际值需用电流表测量
+    float getEstimatedCurrent();
+};
+
+extern PowerManager powerManager;
+
+#endif
@@ -0,0 +1,100 @@
+#include "request_arena.h"
+
+// 每块前保存 4 字节长度，reallocate 需要知道原长度；分配按 4 字节对齐
+#define ARENA_HEADER_SIZE 4
+#define ARENA_ALIGN(n) (((n) + 3) & ~(size_t)3)
+
+RequestArena::RequestArena() {
+    used = 0;
+    requestPeak = 0;
+    heapBlocks = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool RequestArena::owns(void* ptr) {
+    return ptr >= (void*)buffer && ptr < (void*)(buffer + sizeof(buffer));
+}
+
+size_t RequestArena::blockSize(void* ptr) {
+    uint32_t size;
+    memcpy(&size, (uint8_t*)ptr - ARENA_HEADER_SIZE, sizeof(size));
+    return size;
+}
+
+void* RequestArena::allocate(size_t size) {
+    size_t need = ARENA_HEADER_SIZE + ARENA_ALIGN(size);
+    if (need > sizeof(buffer) - used) {
+        stats.fallbacks++;
+        void* ptr = malloc(size);
+        if (ptr) heapBlocks++;
+        return ptr;
+    }
+    
+    uint8_t* block = buffer + used;
+    uint32_t stored = ARENA_ALIGN(size);
+    memcpy(block, &stored, sizeof(stored));
+    used += need;
+    if (used > requestPeak) requestPeak = used;
+    stats.allocations++;
+    return block + ARENA_HEADER_SIZE;
+}
+
+void RequestArena::deallocate(void* ptr) {
+    if (!ptr) return;
+    if (!owns(ptr)) {
+        free(ptr);
+        heapBlocks--;
+        return;
+    }
+    
+    // 只回收最后一块，其余空间在请求结束时统一复位
+    uint8_t* end = (uint8_t*)ptr + blockSize(ptr);
+    if (end == buffer + used) {
+        used = (uint8_t*)ptr - ARENA_HEADER_SIZE - buffer;
+    }
+}
+
+void* RequestArena::reallocate(void* ptr, size_t newSize) {
+    if (!ptr) return allocate(newSize);
+    if (!owns(ptr)) return realloc(ptr, newSize);
+    
+    size_t oldSize = blockSize(ptr);
+    uint8_t* end = (uint8_t*)ptr + oldSize;
+    
+    // 最后一块原地扩展或收缩（ArduinoJson 构造字符串时常见）
+    if (end == buffer + used) {
+        size_t start = (uint8_t*)ptr - buffer;
+        if (ARENA_ALIGN(newSize) <= sizeof(buffer) - start) {
+            uint32_t stored = ARENA_ALIGN(newSize);
+            memcpy((uint8_t*)ptr - ARENA_HEADER_SIZE, &stored, sizeof(stored));
+            used = start + stored;
+            if (used > requestPeak) requestPeak = used;
+            return ptr;
+        }
+    } else if (ARENA_ALIGN(newSize) <= oldSize) {
+        return ptr;
+    }
+    
+    void* moved = allocate(newSize);
+    if (!moved) return nullptr;
+    memcpy(moved, ptr, min(oldSize, newSize));
+    deallocate(ptr);
+    return moved;
+}
+
+void RequestArena::reset() {
+    // 请求结束后所有 JsonDocument 都已析构，整体复位即可
+    stats.lastUsed = requestPeak;
+    if (requestPeak > stats.peakUsed) stats.peakUsed = requestPeak;
+    if (requestPeak > 0) stats.resets++;
+    used = 0;
+    requestPeak = 0;
+}
+
+size_t RequestArena::getUsed() {
+    return used;
+}
+
+const ArenaStats& RequestArena::getStats() {
+    return stats;
+}
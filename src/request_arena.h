@@ -0,0 +1,41 @@
+#ifndef REQUEST_ARENA_H
+#define REQUEST_ARENA_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "config.h"
+
+// 请求内存池统计
+struct ArenaStats {
+    unsigned long allocations;      // 从内存池分配的次数
+    unsigned long fallbacks;        // 内存池不足改用堆分配的次数
+    unsigned long resets;           // 请求结束后的复位次数
+    size_t lastUsed;                // 最近一次请求的最大占用
+    size_t peakUsed;                // 历史最大占用
+};
+
+// 请求级内存池：静态缓冲上顺序分配，请求结束时整体复位
+// 作为 ArduinoJson 的 Allocator 使用，处理函数中的 JsonDocument 和响应缓冲都不再占用堆，
+// 也就不会在长时间轮询后留下堆碎片。空间不足时退回 malloc，并计入 fallbacks。
+class RequestArena : public ArduinoJson::Allocator {
+private:
+    uint8_t buffer[REQUEST_ARENA_SIZE];
+    size_t used;
+    size_t requestPeak;
+    int heapBlocks;                 // 尚未释放的回退堆块数
+    ArenaStats stats;
+    
+    bool owns(void* ptr);
+    size_t blockSize(void* ptr);
+    
+public:
+    RequestArena();
+    void* allocate(size_t size) override;
+    void deallocate(void* ptr) override;
+    void* reallocate(void* ptr, size_t newSize) override;
+    void reset();
+    size_t getUsed();
+    const ArenaStats& getStats();
+};
+
+#endif
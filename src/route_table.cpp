@@ -0,0 +1,103 @@
+#include "route_table.h"
+#include "web_server.h"
+
+RouteTable::RouteTable(WebServer* owner, const Route* routes, size_t count) {
+    this->owner = owner;
+    this->routes = routes;
+    this->count = count > ROUTE_MAX ? ROUTE_MAX : count;
+    current = nullptr;
+    param = 0;
+    memset(&stats, 0, sizeof(stats));
+    
+    // 倒序插入，使同一个桶中的路由保持路由表中的顺序
+    memset(buckets, -1, sizeof(buckets));
+    for (int i = (int)this->count - 1; i >= 0; i--) {
+        uint32_t b = bucketOf(routes[i].method, routes[i].hash);
+        chain[i] = buckets[b];
+        buckets[b] = i;
+    }
+}
+
+uint32_t RouteTable::bucketOf(HTTPMethod method, uint32_t hash) {
+    // 乘法散列取高位
+    return ((hash ^ (uint32_t)method) * 2654435761u) >> (32 - ROUTE_BUCKET_BITS);
+}
+
+const Route* RouteTable::match(HTTPMethod method, const char* uri) {
+    // 一次遍历同时计算整条路径的哈希和最后一个 / 之前（含 /）的前缀哈希
+    uint32_t hash = 2166136261u;
+    uint32_t prefixHash = hash;
+    const char* tail = uri;
+    for (const char* p = uri; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+        if (*p == '/') {
+            prefixHash = hash;
+            tail = p + 1;
+        }
+    }
+    size_t prefixLen = tail - uri;
+
+    // 无参数路由：整条路径所在的桶
+    for (int i = buckets[bucketOf(method, hash)]; i >= 0; i = chain[i]) {
+        const Route& route = routes[i];
+        stats.probes++;
+        if (route.param == PARAM_NONE && route.method == method && route.hash == hash &&
+            strcmp(route.path, uri) == 0) {
+            param = 0;
+            return &route;
+        }
+    }
+
+    // 带参数路由：参数前缀所在的桶
+    for (int i = buckets[bucketOf(method, prefixHash)]; i >= 0; i = chain[i]) {
+        const Route& route = routes[i];
+        stats.probes++;
+        if (route.param == PARAM_NONE || route.method != method || route.hash != prefixHash ||
+            strncmp(route.path, uri, prefixLen) != 0 || route.path[prefixLen]) {
+            continue;
+        }
+
+        // PARAM_UINT：非空、全部为数字且不溢出
+        uint32_t value = 0;
+        const char* p = tail;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (value > (UINT32_MAX - (*p - '0')) / 10) break;
+            value = value * 10 + (*p - '0');
+        }
+        if (p == tail || *p) {
+            stats.badParam++;
+            continue;
+        }
+        param = value;
+        return &route;
+    }
+    return nullptr;
+}
+
+bool RouteTable::canHandle(HTTPMethod method, const String& uri) {
+    current = match(method, uri.c_str());
+    if (current) {
+        stats.matched++;
+    } else {
+        stats.missed++;
+    }
+    return current != nullptr;
+}
+
+bool RouteTable::canRaw(const String& uri) {
+    return current && current->body >= 0;
+}
+
+bool RouteTable::handle(ESP8266WebServer& server, HTTPMethod method, const String& uri) {
+    if (!current) {
+        return false;
+    }
+    (owner->*current->handler)();
+    return true;
+}
+
+void RouteTable::raw(ESP8266WebServer& server, const String& uri, HTTPRaw& raw) {
+    if (current && current->body >= 0) {
+        owner->receiveBody((BodyRoute)current->body);
+    }
+}
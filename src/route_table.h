@@ -0,0 +1,76 @@
+#ifndef ROUTE_TABLE_H
+#define ROUTE_TABLE_H
+
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include "config.h"
+
+class WebServer;
+
+// 路径参数类型
+enum RouteParam : uint8_t {
+    PARAM_NONE,
+    PARAM_UINT                      // 末段为无符号整数，如 /api/timers/12
+};
+
+// 路径哈希（FNV-1a），路由表中的哈希在编译期计算
+constexpr uint32_t routeHash(const char* s, uint32_t h = 2166136261u) {
+    return *s ? routeHash(s + 1, (h ^ (uint8_t)*s) * 16777619u) : h;
+}
+
+// 一条路由；带参数的路由 path 为参数前的前缀（以 / 结尾）
+struct Route {
+    HTTPMethod method;
+    const char* path;
+    uint32_t hash;
+    RouteParam param;
+    int8_t body;                    // 请求体路由（BodyRoute），-1 表示没有请求体
+    void (WebServer::*handler)();
+};
+
+#define ROUTE(method, path, handler) {method, path, routeHash(path), PARAM_NONE, -1, handler}
+#define ROUTE_BODY(method, path, body, handler) {method, path, routeHash(path), PARAM_NONE, body, handler}
+#define ROUTE_PARAM(method, prefix, param, body, handler) {method, prefix, routeHash(prefix), param, body, handler}
+
+// 路由匹配统计
+struct RouteStats {
+    unsigned long matched;
+    unsigned long missed;           // 未匹配（交给后续处理器或 404）
+    unsigned long badParam;         // 前缀匹配但参数类型不符
+    unsigned long probes;           // 累计比较过的路由数（每次匹配最多查两个桶）
+};
+
+// 静态路由表：按 方法 + 路径哈希 匹配，一次遍历 URI 同时得到整条路径和参数前缀的哈希，
+// 匹配过程不分配 String。启动时按 方法 + 哈希 建立分桶索引（无参数路由按整条路径，
+// 带参数路由按前缀），匹配只查整条路径和前缀两个桶，未知路径通常不需要比较任何路由。作为 ESP8266WebServer 的 RequestHandler 注册，
+// 服务器一次只处理一个请求，canHandle 的匹配结果直接留给 handle / raw 使用。
+class RouteTable : public RequestHandler {
+private:
+    WebServer* owner;
+    const Route* routes;
+    size_t count;
+    int8_t buckets[1 << ROUTE_BUCKET_BITS];  // 每个桶第一条路由的下标，-1 为空
+    int8_t chain[ROUTE_MAX];                 // 同一个桶中的下一条路由
+
+    const Route* current;
+    uint32_t param;
+    RouteStats stats;
+
+    static uint32_t bucketOf(HTTPMethod method, uint32_t hash);
+    const Route* match(HTTPMethod method, const char* uri);
+
+public:
+    RouteTable(WebServer* owner, const Route* routes, size_t count);
+
+    bool canHandle(HTTPMethod method, const String& uri) override;
+    bool canRaw(const String& uri) override;
+    bool handle(ESP8266WebServer& server, HTTPMethod method, const String& uri) override;
+    void raw(ESP8266WebServer& server, const String& uri, HTTPRaw& raw) override;
+
+    // 当前请求的路径参数
+    uint32_t getParam() const { return param; }
+    size_t getCount() const { return count; }
+    const RouteStats& getStats() const { return stats; }
+};
+
+#endif
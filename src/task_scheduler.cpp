@@ -0,0 +1,113 @@
+#include "task_scheduler.h"
+
+TaskScheduler scheduler;
+
+TaskScheduler::TaskScheduler() {
+    memset(tasks, 0, sizeof(tasks));
+    count = 0;
+    windowStart = 0;
+    idleShare = 1000;
+}
+
+int TaskScheduler::add(const char* name, TaskFunction fn, uint32_t periodMs, uint8_t priority, uint32_t budgetUs, bool wakes) {
+    if (count >= TASK_MAX) {
+        return -1;
+    }
+
+    Task& task = tasks[count];
+    memset(&task, 0, sizeof(Task));
+    task.name = name;
+    task.fn = fn;
+    task.periodMs = periodMs;
+    task.priority = priority;
+    task.budgetUs = budgetUs;
+    task.wakes = wakes;
+    task.nextRun = millis();
+    return count++;
+}
+
+Task* TaskScheduler::pickNext(unsigned long now) {
+    Task* best = nullptr;
+    for (int i = 0; i < count; i++) {
+        Task& task = tasks[i];
+        if (task.ranThisPass || (long)(now - task.nextRun) < 0) continue;
+
+        if (!best || task.priority < best->priority ||
+            (task.priority == best->priority && (long)(task.nextRun - best->nextRun) < 0)) {
+            best = &task;
+        }
+    }
+    return best;
+}
+
+void TaskScheduler::run() {
+    for (int i = 0; i < count; i++) {
+        tasks[i].ranThisPass = false;
+    }
+
+    Task* task;
+    while ((task = pickNext(millis())) != nullptr) {
+        unsigned long now = millis();
+        uint32_t lateness = now - task->nextRun;
+        if (task->periodMs > 0 && lateness > task->stats.maxLatenessMs) {
+            task->stats.maxLatenessMs = lateness;
+        }
+
+        unsigned long start = micros();
+        task->fn();
+        uint32_t elapsed = micros() - start;
+
+        task->ranThisPass = true;
+        task->stats.runs++;
+        task->stats.windowUs += elapsed;
+        if (elapsed > task->stats.maxRunUs) {
+            task->stats.maxRunUs = elapsed;
+        }
+        if (elapsed > task->budgetUs) {
+            task->stats.overruns++;
+        }
+
+        // 按计划时间推进，保持周期稳定；落后超过一个周期时不补跑，从现在重新计时
+        if (task->periodMs == 0) {
+            task->nextRun = now;
+        } else {
+            task->nextRun += task->periodMs;
+            if ((long)(millis() - task->nextRun) >= (long)task->periodMs) {
+                task->stats.skipped++;
+                task->nextRun = millis() + task->periodMs;
+            }
+        }
+    }
+
+    rollWindow(millis());
+}
+
+void TaskScheduler::rollWindow(unsigned long now) {
+    uint32_t window = now - windowStart;
+    if (window < TASK_STATS_WINDOW) {
+        return;
+    }
+
+    // 统计窗口结束：把累计耗时换算成占用比例
+    uint32_t busy = 0;
+    for (int i = 0; i < count; i++) {
+        TaskStats& stats = tasks[i].stats;
+        stats.utilization = (uint64_t)stats.windowUs / window;   // 微秒 / 毫秒 = 千分比
+        busy += stats.utilization;
+        stats.windowUs = 0;
+    }
+    idleShare = busy < 1000 ? 1000 - busy : 0;
+    windowStart = now;
+}
+
+uint32_t TaskScheduler::getTimeToNextDeadline() {
+    unsigned long now = millis();
+    uint32_t nearest = UINT32_MAX;
+    for (int i = 0; i < count; i++) {
+        if (tasks[i].periodMs == 0 || !tasks[i].wakes) continue;
+        long remaining = (long)(tasks[i].nextRun - now);
+        if (remaining <= 0) return 0;
+        if ((uint32_t)remaining < nearest) nearest = remaining;
+    }
+    return nearest;
+}
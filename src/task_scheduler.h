@@ -0,0 +1,64 @@
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+typedef void (*TaskFunction)();
+
+// 单个任务的运行统计
+struct TaskStats {
+    unsigned long runs;
+    unsigned long overruns;         // 单次运行超出时间预算
+    unsigned long skipped;          // 落后超过一个周期被跳过的次数
+    uint32_t maxRunUs;              // 单次运行最长耗时
+    uint32_t maxLatenessMs;         // 实际开始时间晚于计划的最大值
+    uint32_t windowUs;              // 当前统计窗口内的累计耗时
+    uint16_t utilization;           // 上一个统计窗口的 CPU 占用（千分比）
+};
+
+struct Task {
+    const char* name;
+    TaskFunction fn;
+    uint32_t periodMs;              // 0 表示每轮都运行（后台任务）
+    uint8_t priority;               // 数值越小越优先
+    uint32_t budgetUs;              // 单次运行的时间预算
+    bool wakes;                     // 省电模式下是否需要按周期唤醒
+    unsigned long nextRun;
+    bool ranThisPass;
+    TaskStats stats;
+};
+
+// 协作式任务调度器：各子系统按周期、优先级和时间预算注册，
+// 每轮依次运行已到期任务中最紧急的一个（优先级最高，其次计划时间最早），
+// 运行后重新挑选，直到本轮所有到期任务都运行过一次。
+// 任务不可抢占，预算只用于统计超时；长任务需要自己分段。
+class TaskScheduler {
+private:
+    Task tasks[TASK_MAX];
+    int count;
+    unsigned long windowStart;
+    uint16_t idleShare;             // 上一个统计窗口中没有任务运行的时间（千分比）
+
+    Task* pickNext(unsigned long now);
+    void rollWindow(unsigned long now);
+
+public:
+    TaskScheduler();
+
+    // 返回任务编号，任务表已满时返回 -1
+    // wakes 为 false 的任务只做轮询，省电模式下不会为它唤醒（到期时间由任务自己的数据源给出）
+    int add(const char* name, TaskFunction fn, uint32_t periodMs, uint8_t priority, uint32_t budgetUs, bool wakes = true);
+    void run();
+
+    // 距离下一个需要唤醒的周期任务到期的毫秒数（不含后台任务）
+    uint32_t getTimeToNextDeadline();
+
+    int getCount() const { return count; }
+    const Task& getTask(int index) const { return tasks[index]; }
+    uint16_t getIdleShare() const { return idleShare; }
+};
+
+extern TaskScheduler scheduler;
+
+#endif
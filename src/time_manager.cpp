@@ -1,50 +1,172 @@
 #include "time_manager.h"
 #include <ESP8266WiFi.h>
+#include <lwip/dns.h>
+#include "logger.h"
+#include "boot_profile.h"
 
-TimeManager::TimeManager() : timeClient(ntpUDP, NTP_SERVER, TIME_ZONE * 3600) {
+static const uint16_t NTP_PORT = 123;
+static const uint16_t NTP_LOCAL_PORT = 2390;
+static const int NTP_PACKET_SIZE = 48;
+static const uint32_t NTP_UNIX_OFFSET = 2208988800UL; // 1900-01-01 到 1970-01-01 的秒数
+
+// 异步 DNS 解析结果，回调在网络栈中执行，只写这两个变量
+static volatile int8_t dnsResult = 0;     // 0 等待中，1 成功，-1 失败
+static uint32_t dnsAddress = 0;
+
+static void onDnsFound(const char* name, const ip_addr_t* addr, void* arg) {
+    if (addr) {
+        dnsAddress = ip_addr_get_ip4_u32(addr);
+        dnsResult = 1;
+    } else {
+        dnsResult = -1;
+    }
+}
+
+TimeManager::TimeManager() {
     timeInitialized = false;
     lastNTPUpdate = 0;
+    syncEpoch = 0;
+    syncMillis = 0;
+    ntpState = NTP_IDLE;
+    requestStart = 0;
+    lastAttempt = 0;
+    attempted = false;
+    syncRequested = false;
 }
 
 void TimeManager::begin() {
-    timeClient.begin();
-    timeClient.setUpdateInterval(NTP_UPDATE_INTERVAL);
-    
-    Serial.println("时间管理器初始化完成");
-    
-    // 如果 WiFi 已连接，立即尝试同步时间
-    if (WiFi.status() == WL_CONNECTED) {
-        forceSync();
-    }
+    ntpUDP.begin(NTP_LOCAL_PORT);
+    LOG_INFO("时间管理器初始化完成");
+}
+
+void TimeManager::markSynced() {
+    timeInitialized = true;
+    lastNTPUpdate = millis();
+    bootProfile.milestone("ntp_synced");
 }
 
+// 由主循环频繁调用：到期时发出请求，之后每次只检查回复是否到达
 void TimeManager::update() {
     // 只有在 WiFi 连接时才更新 NTP 时间
-    if (WiFi.status() == WL_CONNECTED) {
-        timeClient.update();
-        
-        // 检查是否成功获取到时间
-        if (!timeInitialized && timeClient.getEpochTime() > 0) {
-            timeInitialized = true;
-            lastNTPUpdate = millis();
-            Serial.println("NTP 时间同步成功: " + getCurrentTimeString());
+    if (WiFi.status() != WL_CONNECTED) {
+        ntpState = NTP_IDLE;
+        return;
+    }
+    
+    unsigned long now = millis();
+    switch (ntpState) {
+    case NTP_IDLE: {
+        // 未同步时 WiFi 连上后立即尝试，失败每 NTP_RETRY_INTERVAL 重试；同步后每 NTP_UPDATE_INTERVAL 校准一次
+        bool retryDue = !attempted || now - lastAttempt >= NTP_RETRY_INTERVAL;
+        bool due = !timeInitialized ? retryDue
+                                    : retryDue && (syncRequested || now - lastNTPUpdate >= NTP_UPDATE_INTERVAL);
+        if (due) startRequest();
+        break;
+    }
+    case NTP_RESOLVING:
+        if (dnsResult > 0) {
+            serverIP = IPAddress(dnsAddress);
+            sendRequest();
+        } else if (dnsResult < 0) {
+            failRequest("无法解析服务器地址");
+        } else if (now - requestStart >= NTP_RESPONSE_TIMEOUT) {
+            failRequest("解析服务器地址超时");
         }
-        
-        // 定期强制同步
-        if (timeInitialized && millis() - lastNTPUpdate > NTP_UPDATE_INTERVAL) {
-            forceSync();
+        break;
+    case NTP_WAITING:
+        if (readResponse()) {
+            ntpState = NTP_IDLE;
+        } else if (now - requestStart >= NTP_RESPONSE_TIMEOUT) {
+            failRequest("等待回复超时");
         }
+        break;
+    }
+}
+
+void TimeManager::startRequest() {
+    attempted = true;
+    syncRequested = false;
+    lastAttempt = millis();
+    requestStart = lastAttempt;
+    
+    // 每次重新解析，服务器池轮换时可以换到其他服务器；结果已缓存时立即返回
+    ip_addr_t addr;
+    dnsResult = 0;
+    err_t err = dns_gethostbyname(NTP_SERVER, &addr, onDnsFound, nullptr);
+    if (err == ERR_OK) {
+        serverIP = IPAddress(ip_addr_get_ip4_u32(&addr));
+        sendRequest();
+    } else if (err == ERR_INPROGRESS) {
+        ntpState = NTP_RESOLVING;
+    } else {
+        failRequest("无法解析服务器地址");
+    }
+}
+
+void TimeManager::sendRequest() {
+    // 丢弃之前超时的请求迟到的回复
+    while (ntpUDP.parsePacket() > 0) {
+        ntpUDP.flush();
+    }
+    
+    uint8_t packet[NTP_PACKET_SIZE];
+    memset(packet, 0, sizeof(packet));
+    packet[0] = 0xE3;   // LI 未同步，版本 4，客户端模式
+    packet[2] = 6;      // 轮询间隔
+    packet[3] = 0xEC;   // 精度
+    
+    if (!ntpUDP.beginPacket(serverIP, NTP_PORT) ||
+        ntpUDP.write(packet, sizeof(packet)) != sizeof(packet) ||
+        !ntpUDP.endPacket()) {
+        failRequest("请求发送失败");
+        return;
+    }
+    ntpState = NTP_WAITING;
+}
+
+bool TimeManager::readResponse() {
+    int size = ntpUDP.parsePacket();
+    if (size <= 0) return false;
+    
+    uint8_t packet[NTP_PACKET_SIZE];
+    bool valid = size >= NTP_PACKET_SIZE && ntpUDP.remoteIP() == serverIP &&
+                 ntpUDP.read(packet, sizeof(packet)) == NTP_PACKET_SIZE;
+    ntpUDP.flush();
+    // 服务器模式且层级有效（层级 0 为拒绝服务的 KoD 回复）
+    if (!valid || (packet[0] & 0x07) != 4 || packet[1] == 0) return false;
+    
+    uint32_t seconds = ((uint32_t)packet[40] << 24) | ((uint32_t)packet[41] << 16) |
+                       ((uint32_t)packet[42] << 8) | packet[43];
+    uint32_t fraction = ((uint32_t)packet[44] << 24) | ((uint32_t)packet[45] << 16) |
+                        ((uint32_t)packet[46] << 8) | packet[47];
+    if (seconds < NTP_UNIX_OFFSET) return false;
+    
+    // 秒的小数部分折算到 syncMillis，使本地秒与服务器同时跳变
+    unsigned long now = millis();
+    syncEpoch = seconds - NTP_UNIX_OFFSET;
+    syncMillis = now - (uint32_t)(((uint64_t)fraction * 1000) >> 32);
+    markSynced();
+    LOG_INFO("NTP 时间同步成功: %02d:%02d，用时 %lums", getCurrentHour(), getCurrentMinute(), now - requestStart);
+    return true;
+}
+
+void TimeManager::failRequest(const char* reason) {
+    ntpState = NTP_IDLE;
+    if (timeInitialized) {
+        LOG_WARN("NTP 同步失败: %s", reason);
+    } else {
+        LOG_DEBUG("NTP 同步失败: %s，%d 秒后重试", reason, NTP_RETRY_INTERVAL / 1000);
     }
 }
 
 bool TimeManager::isTimeValid() {
     // WiFi 连接且时间已初始化
-    return (WiFi.status() == WL_CONNECTED) && timeInitialized && (timeClient.getEpochTime() > 0);
+    return (WiFi.status() == WL_CONNECTED) && timeInitialized;
 }
 
 int TimeManager::getCurrentHour() {
     if (isTimeValid()) {
-        return timeClient.getHours();
+        return (getEpochTime() % 86400) / 3600;
     }
     
     // 如果没有有效时间，返回基于运行时间的模拟时间（仅用于测试）
@@ -54,7 +176,7 @@ int TimeManager::getCurrentHour() {
 
 int TimeManager::getCurrentMinute() {
     if (isTimeValid()) {
-        return timeClient.getMinutes();
+        return (getEpochTime() % 3600) / 60;
     }
     
     // 如果没有有效时间，返回基于运行时间的模拟时间（仅用于测试）
@@ -62,10 +184,19 @@ int TimeManager::getCurrentMinute() {
     return (seconds / 60) % 60;
 }
 
+long TimeManager::getSecondsOfDay() {
+    if (isTimeValid()) {
+        return getEpochTime() % 86400;
+    }
+    
+    // 与 getCurrentHour/getCurrentMinute 一致的模拟时间
+    return (millis() / 1000) % 86400;
+}
+
 int TimeManager::getCurrentDay() {
     if (isTimeValid()) {
         // 返回自 Unix epoch 以来的天数
-        return timeClient.getEpochTime() / 86400;
+        return getEpochTime() / 86400;
     }
     
     // 如果没有有效时间，返回基于运行时间的模拟天数
@@ -76,10 +207,11 @@ String TimeManager::getCurrentTimeString() {
     char timeStr[10];
     
     if (isTimeValid()) {
+        unsigned long epochTime = getEpochTime();
         sprintf(timeStr, "%02d:%02d:%02d", 
-                timeClient.getHours(), 
-                timeClient.getMinutes(), 
-                timeClient.getSeconds());
+                (int)((epochTime % 86400) / 3600), 
+                (int)((epochTime % 3600) / 60), 
+                (int)(epochTime % 60));
     } else {
         sprintf(timeStr, "%02d:%02d:%02d*", 
                 getCurrentHour(), 
@@ -92,7 +224,7 @@ String TimeManager::getCurrentTimeString() {
 
 String TimeManager::getCurrentDateString() {
     if (isTimeValid()) {
-        unsigned long epochTime = timeClient.getEpochTime();
+        unsigned long epochTime = getEpochTime();
         
         // 简单的日期计算
         int days = epochTime / 86400;
@@ -108,19 +240,10 @@ String TimeManager::getCurrentDateString() {
     return "未同步";
 }
 
+// 在下一次 update() 中发起同步（受 NTP_RETRY_INTERVAL 限制），结果异步到达
 void TimeManager::forceSync() {
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("强制同步 NTP 时间...");
-        timeClient.forceUpdate();
-        
-        if (timeClient.getEpochTime() > 0) {
-            timeInitialized = true;
-            lastNTPUpdate = millis();
-            Serial.println("NTP 同步成功: " + getCurrentTimeString());
-        } else {
-            Serial.println("NTP 同步失败");
-        }
-    }
+    LOG_DEBUG("请求同步 NTP 时间...");
+    syncRequested = true;
 }
 
 bool TimeManager::isWiFiTimeAvailable() {
@@ -129,7 +252,8 @@ bool TimeManager::isWiFiTimeAvailable() {
 
 unsigned long TimeManager::getEpochTime() {
     if (isTimeValid()) {
-        return timeClient.getEpochTime();
+        // 本地时区的时间戳（与其余接口的时间一致）
+        return syncEpoch + (millis() - syncMillis) / 1000 + TIME_ZONE * 3600L;
     }
     return 0; // 无效时间返回0
 }
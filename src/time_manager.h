@@ -2,17 +2,39 @@
 #define TIME_MANAGER_H
 
 #include <WiFiUdp.h>
-#include <NTPClient.h>
 #include <TimeLib.h>
 #include "config.h"
 
+// NTP 同步状态
+enum NtpState {
+    NTP_IDLE,
+    NTP_RESOLVING,      // 等待 DNS 解析
+    NTP_WAITING         // 请求已发送，等待回复
+};
+
+// 时间管理：NTP 请求和回复都在 update() 中轮询处理，不阻塞主循环；
+// 同步后本地按 millis() 计时
 class TimeManager {
 private:
     WiFiUDP ntpUDP;
-    NTPClient timeClient;
     bool timeInitialized;
-    unsigned long lastNTPUpdate;
-    
+    unsigned long lastNTPUpdate;   // 上次同步成功的时间
+    uint32_t syncEpoch;            // 同步时的 UTC 秒数
+    unsigned long syncMillis;      // syncEpoch 对应的 millis()
+
+    NtpState ntpState;
+    unsigned long requestStart;    // 本次同步开始的时间
+    unsigned long lastAttempt;
+    bool attempted;
+    bool syncRequested;
+    IPAddress serverIP;
+
+    void markSynced();
+    void startRequest();
+    void sendRequest();
+    bool readResponse();
+    void failRequest(const char* reason);
+
 public:
     TimeManager();
     void begin();
@@ -20,6 +42,7 @@ public:
     bool isTimeValid();
     int getCurrentHour();
     int getCurrentMinute();
+    long getSecondsOfDay(); // 当天已过的秒数
     int getCurrentDay(); // 获取当前日期（用于每天重复检查）
     unsigned long getEpochTime(); // 获取当前时间戳
     String getCurrentTimeString();
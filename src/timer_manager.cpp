@@ -1,9 +1,58 @@
 #include "timer_manager.h"
+#include <core_esp8266_waveform.h>
+#include <LittleFS.h>
+#include "logger.h"
+#include "boot_profile.h"
+
+// 日志用的输出模式描述，写入调用方的栈缓冲
+static const char* modeText(char* buf, size_t len, bool isPWM, int pwmValue) {
+    if (isPWM) {
+        snprintf(buf, len, " PWM(%d)", pwmValue);
+    } else {
+        buf[0] = '\0';
+    }
+    return buf;
+}
 
 TimerManager::TimerManager() {
     timerCount = 0;
     timeManager = nullptr;
     lastStateSave = 0;
+    stateVersion = 0;
+    batchDepth = 0;
+    saveDeferred = false;
+    restoredCount = 0;
+    reconcileMask = 0;
+    actuationDepth = 0;
+    pendingSet = 0;
+    pendingClear = 0;
+    pending16 = -1;
+    pendingPWM = 0;
+    pendingStopPWM = 0;
+    memset(&actuationStats, 0, sizeof(actuationStats));
+    memset(dailyStats, 0, sizeof(dailyStats));
+    statsHead = 0;
+    statsDirty = false;
+    lastStatsSave = 0;
+    resetSlots();
+}
+
+void TimerManager::resetSlots() {
+    freeCount = 0;
+    for (int i = MAX_TIMERS - 1; i >= 0; i--) {
+        timers[i].id = INVALID_TIMER_ID;
+        slotGeneration[i] = 1;
+        freeSlots[freeCount++] = i;
+    }
+    timerCount = 0;
+}
+
+int TimerManager::slotOf(uint16_t id) {
+    int slot = id & 0xFF;
+    if (id == INVALID_TIMER_ID || slot >= MAX_TIMERS || timers[slot].id != id) {
+        return -1;
+    }
+    return slot;
 }
 
 void TimerManager::begin(TimeManager* tm) {
@@ -12,28 +61,20 @@ void TimerManager::begin(TimeManager* tm) {
     // 初始化EEPROM
     EEPROM.begin(EEPROM_SIZE);
     
-    // 初始化所有可用引脚为输出模式
-    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
-        pinMode(AVAILABLE_PINS[i], OUTPUT);
-        digitalWrite(AVAILABLE_PINS[i], LOW);
-        // 为PWM引脚设置频率
-        analogWriteFreq(PWM_FREQUENCY);
-        analogWriteResolution(PWM_RESOLUTION);
-    }
+    // 初始化所有可用引脚为输出模式，并建立引脚状态表
+    initPinStates();
+    history.begin();
     
+    // 先恢复输出，挂载 LittleFS 较慢，放在之后
+    beginActuation();
     loadTimers();
-    Serial.println("Timer Manager 初始化完成，已加载 " + String(timerCount) + " 个定时器");
-    
-    // 输出恢复的状态信息
-    int activeCount = 0;
-    for (int i = 0; i < timerCount; i++) {
-        if (timers[i].isActive) {
-            activeCount++;
-        }
-    }
-    if (activeCount > 0) {
-        Serial.println("已恢复 " + String(activeCount) + " 个活跃定时器状态");
+    commitActuation();
+    LOG_INFO("Timer Manager 初始化完成，已加载 %d 个定时器", timerCount);
+    if (restoredCount > 0) {
+        LOG_INFO("已恢复 %d 个活跃定时器状态", restoredCount);
     }
+    
+    loadDailyStats();
 }
 
 void TimerManager::update() {
@@ -46,8 +87,24 @@ void TimerManager::update() {
     
     bool stateChanged = false;
     
-    for (int i = 0; i < timerCount; i++) {
-        if (!timers[i].enabled) continue;
+    // 本次 tick 内的所有引脚变化在末尾一次性提交
+    beginActuation();
+    
+    if (reconcileMask != 0 && timeManager->isTimeValid()) {
+        reconcileRestored(currentTime);
+    }
+    
+    // 释放到期的手动占用
+    for (int p = 0; p < AVAILABLE_PINS_COUNT; p++) {
+        if (pinStates[p].manualUntil != 0 && (long)(currentTime - pinStates[p].manualUntil) >= 0) {
+            recordManualRun(pinStates[p], currentTime);
+            releasePin(pinStates[p].pin, MANUAL_OWNER);
+            LOG_INFO("手动控制：引脚 %d 关闭", pinStates[p].pin);
+        }
+    }
+    
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id == INVALID_TIMER_ID || !timers[i].enabled) continue;
         
         // 检查是否到达触发时间
         bool shouldTrigger = false;
@@ -71,18 +128,20 @@ void TimerManager::update() {
         if (shouldTrigger) {
             timers[i].isActive = true;
             timers[i].startTime = currentTime;
+            timers[i].triggerSource = TRIGGER_SCHEDULED;
             // 保存真实时间戳（如果可用）
             if (timeManager->isTimeValid()) {
                 timers[i].realStartTime = timeManager->getEpochTime();
             } else {
                 timers[i].realStartTime = 0;
             }
-            setPin(timers[i].pin, HIGH, timers[i].isPWM ? timers[i].pwmValue : 0);
+            acquirePin(timers[i].pin, i, timers[i].isPWM, timers[i].pwmValue);
             
-            String modeStr = timers[i].isPWM ? " PWM(" + String(timers[i].pwmValue) + ")" : "";
-            Serial.println("定时器 " + String(i) + " 激活，引脚 " + String(timers[i].pin) + " 开启" + modeStr +
-                          (timers[i].repeatDaily ? " (每天重复)" : " (单次)") + 
-                          ", 预期运行时间: " + String(timers[i].duration * 1000.0) + "ms");
+            char mode[16];
+            LOG_INFO("定时器 %u 激活，引脚 %d 开启%s%s, 预期运行时间: %lums",
+                     timers[i].id, timers[i].pin, modeText(mode, sizeof(mode), timers[i].isPWM, timers[i].pwmValue),
+                     timers[i].repeatDaily ? " (每天重复)" : " (单次)",
+                     (unsigned long)(timers[i].duration * 1000.0 + 0.5));
             
             stateChanged = true;
             
@@ -97,107 +156,189 @@ void TimerManager::update() {
         if (timers[i].isActive && 
             currentTime - timers[i].startTime >= (unsigned long)(timers[i].duration * 1000.0 + 0.5)) {
             
+            recordTimerRun(i, currentTime);
             timers[i].isActive = false;
             timers[i].realStartTime = 0; // 清理真实时间戳
-            setPin(timers[i].pin, LOW, 0);
+            releasePin(timers[i].pin, i);
             
-            Serial.println("定时器 " + String(i) + " 完成，引脚 " + String(timers[i].pin) + " 关闭，实际运行时间: " + String(currentTime - timers[i].startTime) + "ms");
+            LOG_INFO("定时器 %u 完成，引脚 %d 关闭，实际运行时间: %lums",
+                     timers[i].id, timers[i].pin, currentTime - timers[i].startTime);
             stateChanged = true;
         }
     }
     
+    commitActuation();
+    
     // 定期保存状态，或者有状态变化时立即保存
     if (stateChanged || (currentTime - lastStateSave >= STATE_SAVE_INTERVAL)) {
         saveTimerStates();
         lastStateSave = currentTime;
     }
+    
+    // 午夜及时切换到新的一天，使跨天仍在开启的输出按午夜拆分
+    if (hasValidTime() && dailyStats[statsHead].day != 0 && dailyStats[statsHead].day < currentDay) {
+        currentRollup();
+    }
+    
+    // 每日统计写入闪存的频率远低于状态保存
+    if (statsDirty && currentTime - lastStatsSave >= STATS_SAVE_INTERVAL) {
+        saveDailyStats();
+    }
 }
 
-bool TimerManager::addTimer(int pin, int hour, int minute, float duration, bool repeatDaily, bool isPWM, int pwmValue) {
-    if (timerCount >= MAX_TIMERS) {
-        return false;
+uint32_t TimerManager::getTimeToNextEvent() {
+    if (!timeManager) return UINT32_MAX;
+    
+    unsigned long currentTime = millis();
+    uint32_t nearest = UINT32_MAX;
+    
+    // 手动控制到期
+    for (int p = 0; p < AVAILABLE_PINS_COUNT; p++) {
+        if (pinStates[p].manualUntil == 0) continue;
+        long remaining = (long)(pinStates[p].manualUntil - currentTime);
+        if (remaining <= 0) return 0;
+        nearest = min(nearest, (uint32_t)remaining);
     }
     
-    // 验证引脚是否可用
-    bool pinValid = false;
-    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
-        if (AVAILABLE_PINS[i] == pin) {
-            pinValid = true;
-            break;
+    long secondsOfDay = timeManager->getSecondsOfDay();
+    unsigned long currentDay = timeManager->getCurrentDay();
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id == INVALID_TIMER_ID || !timers[i].enabled) continue;
+        
+        if (timers[i].isActive) {
+            // 运行中的定时器到期关闭
+            unsigned long durationMs = (unsigned long)(timers[i].duration * 1000.0 + 0.5);
+            unsigned long elapsed = currentTime - timers[i].startTime;
+            if (elapsed >= durationMs) return 0;
+            nearest = min(nearest, (uint32_t)(durationMs - elapsed));
+            continue;
+        }
+        
+        // 下一次触发：触发按分钟匹配，只精确到秒，提前醒来的部分由正常轮询补上
+        long wait = timers[i].hour * 3600L + timers[i].minute * 60L - secondsOfDay;
+        if (wait <= 0 && wait > -60) {
+            bool triggeredToday = timers[i].repeatDaily && timers[i].lastTriggerDay == currentDay;
+            if (!triggeredToday) return 0;
+            wait += 86400;
+        } else if (wait <= -60) {
+            wait += 86400;
         }
+        nearest = min(nearest, (uint32_t)wait * 1000);
     }
-    if (!pinValid) return false;
     
-    // 验证时间
-    if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || duration <= 0.0) {
-        return false;
+    return nearest;
+}
+
+uint16_t TimerManager::addTimer(int pin, int hour, int minute, float duration, bool repeatDaily, bool isPWM, int pwmValue) {
+    if (freeCount == 0) {
+        return INVALID_TIMER_ID;
     }
     
-    // 验证PWM值
-    if (isPWM && (pwmValue < 0 || pwmValue > PWM_MAX_VALUE)) {
-        return false;
+    if (!validateTimer(pin, hour, minute, duration, isPWM, pwmValue)) {
+        return INVALID_TIMER_ID;
     }
     
-    timers[timerCount].enabled = true;
-    timers[timerCount].pin = pin;
-    timers[timerCount].hour = hour;
-    timers[timerCount].minute = minute;
-    timers[timerCount].duration = duration;
-    timers[timerCount].repeatDaily = repeatDaily;
-    timers[timerCount].isActive = false;
-    timers[timerCount].startTime = 0;
-    timers[timerCount].lastTriggerDay = 0; // 初始化为0
-    timers[timerCount].isPWM = isPWM;
-    timers[timerCount].pwmValue = isPWM ? pwmValue : 0;
-    timers[timerCount].realStartTime = 0; // 初始化真实时间戳
+    // 从空闲栈取槽位，O(1)
+    int slot = freeSlots[--freeCount];
+    TimerConfig& t = timers[slot];
+    t.id = ((uint16_t)slotGeneration[slot] << 8) | slot;
+    t.enabled = true;
+    t.pin = pin;
+    t.hour = hour;
+    t.minute = minute;
+    t.duration = duration;
+    t.repeatDaily = repeatDaily;
+    t.isActive = false;
+    t.startTime = 0;
+    t.lastTriggerDay = 0; // 初始化为0
+    t.isPWM = isPWM;
+    t.pwmValue = isPWM ? pwmValue : 0;
+    t.realStartTime = 0; // 初始化真实时间戳
+    t.triggerSource = TRIGGER_SCHEDULED;
     
     timerCount++;
     saveTimers();
     
-    String modeStr = isPWM ? " PWM模式, 值=" + String(pwmValue) : " 数字模式";
-    Serial.println("添加定时器：引脚 " + String(pin) + ", 时间 " + String(hour) + ":" + String(minute) + 
-                  ", 持续 " + String(duration) + "秒" + modeStr + (repeatDaily ? " (每天重复)" : " (单次)"));
+    char mode[16];
+    LOG_INFO("添加定时器 %u：引脚 %d, 时间 %d:%02d, 持续 %.1f秒%s%s", t.id, pin, hour, minute, duration,
+             isPWM ? modeText(mode, sizeof(mode), true, pwmValue) : " 数字模式", repeatDaily ? " (每天重复)" : " (单次)");
     
-    return true;
+    return t.id;
 }
 
-bool TimerManager::removeTimer(int index) {
-    if (index < 0 || index >= timerCount) {
+bool TimerManager::removeTimer(uint16_t id) {
+    int slot = slotOf(id);
+    if (slot < 0) {
         return false;
     }
     
-    // 如果定时器正在运行，先关闭引脚
-    if (timers[index].isActive) {
-        setPin(timers[index].pin, LOW, 0);
+    // 如果定时器正在运行，先记录本次运行并释放引脚
+    if (timers[slot].isActive) {
+        recordTimerRun(slot, millis());
+        releasePin(timers[slot].pin, slot);
     }
     
-    // 移动数组元素
-    for (int i = index; i < timerCount - 1; i++) {
-        timers[i] = timers[i + 1];
-    }
+    // 释放槽位并递增代数，旧 ID 随即失效；其他记录不移动
+    timers[slot].id = INVALID_TIMER_ID;
+    slotGeneration[slot] = slotGeneration[slot] >= 0xFF ? 1 : slotGeneration[slot] + 1;
+    freeSlots[freeCount++] = slot;
     
     timerCount--;
     saveTimers();
     
-    Serial.println("删除定时器 " + String(index));
+    LOG_INFO("删除定时器 %u", id);
     
     return true;
 }
 
-bool TimerManager::updateTimer(int index, int pin, int hour, int minute, float duration, bool enabled, bool repeatDaily, bool isPWM, int pwmValue) {
-    if (index < 0 || index >= timerCount) {
+bool TimerManager::updateTimer(uint16_t id, int pin, int hour, int minute, float duration, bool enabled, bool repeatDaily, bool isPWM, int pwmValue) {
+    int slot = slotOf(id);
+    if (slot < 0) {
         return false;
     }
     
-    // 验证引脚
-    bool pinValid = false;
-    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
-        if (AVAILABLE_PINS[i] == pin) {
-            pinValid = true;
-            break;
-        }
+    if (!validateTimer(pin, hour, minute, duration, isPWM, pwmValue)) {
+        return false;
+    }
+    
+    TimerConfig& t = timers[slot];
+    
+    // 如果定时器正在运行且引脚发生变化，先释放旧引脚
+    if (t.isActive && t.pin != pin) {
+        recordTimerRun(slot, millis());
+        releasePin(t.pin, slot);
+        t.isActive = false;
+    }
+    
+    t.enabled = enabled;
+    t.pin = pin;
+    t.hour = hour;
+    t.minute = minute;
+    t.duration = duration;
+    t.repeatDaily = repeatDaily;
+    t.isPWM = isPWM;
+    t.pwmValue = isPWM ? pwmValue : 0;
+    
+    // 正在运行的定时器立即应用新的输出值
+    if (t.isActive) {
+        acquirePin(pin, slot, isPWM, pwmValue);
+    }
+    
+    // 如果修改了重复设置，重置触发状态
+    t.lastTriggerDay = 0;
+    
+    saveTimers();
+    
+    LOG_INFO("更新定时器 %u", id);
+    
+    return true;
+}
+
+bool TimerManager::validateTimer(int pin, int hour, int minute, float duration, bool isPWM, int pwmValue) {
+    // 验证引脚是否可用
+    if (pin < 0 || pin >= MAX_GPIO || pinSlot[pin] < 0) {
+        return false;
     }
-    if (!pinValid) return false;
     
     // 验证时间
     if (hour < 0 || hour > 23 || minute < 0 || minute > 59 || duration <= 0.0) {
@@ -209,28 +350,114 @@ bool TimerManager::updateTimer(int index, int pin, int hour, int minute, float d
         return false;
     }
     
-    // 如果定时器正在运行且引脚发生变化，先关闭旧引脚
-    if (timers[index].isActive && timers[index].pin != pin) {
-        setPin(timers[index].pin, LOW, 0);
-        timers[index].isActive = false;
+    return true;
+}
+
+void TimerManager::beginBatch() {
+    batchDepth++;
+}
+
+void TimerManager::endBatch() {
+    if (batchDepth > 0) batchDepth--;
+    if (batchDepth == 0 && saveDeferred) {
+        saveDeferred = false;
+        saveTimers();
+    }
+}
+
+// 批量操作中的定时器 ID：与 REST 接口一致按 uint32_t 读取，超出 16 位的视为无效，避免截断后命中其他定时器
+static uint16_t batchTimerId(JsonObjectConst op) {
+    uint32_t id = op["id"] | (uint32_t)INVALID_TIMER_ID;
+    return id > UINT16_MAX ? INVALID_TIMER_ID : (uint16_t)id;
+}
+
+// 批量操作：先按顺序模拟执行校验全部操作，全部有效才应用，最后只提交一次 EEPROM
+// results 中每个操作对应一项；校验失败时返回 false 且不做任何修改
+bool TimerManager::applyBatch(JsonArrayConst ops, JsonArray results) {
+    // 第一遍：校验（同一批次中已删除的 ID 不能再引用）
+    int simulatedCount = timerCount;
+    uint16_t deletedIds[MAX_TIMERS];
+    int deletedCount = 0;
+    bool allValid = true;
+    for (JsonObjectConst op : ops) {
+        String type = op["op"] | "";
+        uint16_t id = batchTimerId(op);
+        bool exists = findTimer(id) != nullptr;
+        for (int d = 0; d < deletedCount && exists; d++) {
+            if (deletedIds[d] == id) exists = false;
+        }
+        bool valid = false;
+        const char* error = "未知操作";
+        
+        if (type == "add" || type == "update") {
+            int pwmValue = op["pwmValue"].is<int>() ? op["pwmValue"].as<int>() : 512;
+            if (!validateTimer(op["pin"] | -1, op["hour"] | -1, op["minute"] | -1, op["duration"] | 0.0f,
+                               op["isPWM"].as<bool>(), pwmValue)) {
+                error = "参数无效";
+            } else if (type == "add" && simulatedCount >= MAX_TIMERS) {
+                error = "定时器数量已达上限";
+            } else if (type == "update" && !exists) {
+                error = "定时器不存在";
+            } else {
+                valid = true;
+                if (type == "add") simulatedCount++;
+            }
+        } else if (type == "delete") {
+            if (!exists) {
+                error = "定时器不存在";
+            } else {
+                valid = true;
+                deletedIds[deletedCount++] = id;
+                simulatedCount--;
+            }
+        }
+        
+        JsonObject r = results.add<JsonObject>();
+        r["op"] = type;
+        r["success"] = valid;
+        if (!valid) {
+            r["message"] = error;
+            allValid = false;
+        }
     }
     
-    timers[index].enabled = enabled;
-    timers[index].pin = pin;
-    timers[index].hour = hour;
-    timers[index].minute = minute;
-    timers[index].duration = duration;
-    timers[index].repeatDaily = repeatDaily;
-    timers[index].isPWM = isPWM;
-    timers[index].pwmValue = isPWM ? pwmValue : 0;
-    
-    // 如果修改了重复设置，重置触发状态
-    timers[index].lastTriggerDay = 0;
-    
-    saveTimers();
-    
-    Serial.println("更新定时器 " + String(index));
+    if (!allValid) return false;
     
+    // 第二遍：依次应用
+    beginBatch();
+    int i = 0;
+    for (JsonObjectConst op : ops) {
+        String type = op["op"] | "";
+        JsonObject r = results[i++];
+        bool ok = false;
+        
+        if (type == "delete") {
+            uint16_t id = batchTimerId(op);
+            ok = removeTimer(id);
+            r["id"] = id;
+        } else {
+            int pin = op["pin"];
+            int hour = op["hour"];
+            int minute = op["minute"];
+            float duration = op["duration"];
+            bool repeatDaily = op["repeatDaily"].as<bool>();
+            bool isPWM = op["isPWM"].as<bool>();
+            int pwmValue = op["pwmValue"].is<int>() ? op["pwmValue"].as<int>() : 512; // 默认值50%
+            
+            if (type == "add") {
+                uint16_t id = addTimer(pin, hour, minute, duration, repeatDaily, isPWM, pwmValue);
+                ok = id != INVALID_TIMER_ID;
+                r["id"] = id;
+            } else {
+                uint16_t id = batchTimerId(op);
+                bool enabled = op["enabled"] | true;
+                ok = updateTimer(id, pin, hour, minute, duration, enabled, repeatDaily, isPWM, pwmValue);
+                r["id"] = id;
+            }
+        }
+        r["success"] = ok;
+    }
+    endBatch();
     return true;
 }
 
@@ -238,9 +465,10 @@ String TimerManager::getTimersJSON() {
     JsonDocument doc;
     JsonArray array = doc.to<JsonArray>();
     
-    for (int i = 0; i < timerCount; i++) {
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id == INVALID_TIMER_ID) continue;
         JsonObject timer = array.add<JsonObject>();
-        timer["index"] = i;
+        timer["id"] = timers[i].id;
         timer["enabled"] = timers[i].enabled;
         timer["pin"] = timers[i].pin;
         timer["hour"] = timers[i].hour;
@@ -262,19 +490,14 @@ String TimerManager::getAvailablePinsJSON() {
     JsonArray array = doc.to<JsonArray>();
     
     for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        const PinState& ps = pinStates[i];
         JsonObject pin = array.add<JsonObject>();
-        pin["pin"] = AVAILABLE_PINS[i];
-        pin["state"] = digitalRead(AVAILABLE_PINS[i]);
-        
-        // 检查是否被定时器占用
-        bool inUse = false;
-        for (int j = 0; j < timerCount; j++) {
-            if (timers[j].pin == AVAILABLE_PINS[i] && timers[j].isActive) {
-                inUse = true;
-                break;
-            }
-        }
-        pin["inUse"] = inUse;
+        pin["pin"] = ps.pin;
+        pin["state"] = ps.level ? 1 : 0;
+        pin["pwmValue"] = ps.pwmValue;
+        pin["owners"] = ps.ownerCount;
+        pin["inUse"] = ps.ownerCount > 0;
+        pin["timerId"] = getPinTimerOwner(ps.pin);
     }
     
     String result;
@@ -282,6 +505,39 @@ String TimerManager::getAvailablePinsJSON() {
     return result;
 }
 
+// 二进制格式的定时器记录：[id, enabled, pin, hour, minute, duration, repeatDaily, isActive, isPWM, pwmValue]
+void TimerManager::writeTimers(BinaryWriter& writer) {
+    writer.beginArray(timerCount);
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        const TimerConfig& t = timers[i];
+        if (t.id == INVALID_TIMER_ID) continue;
+        writer.beginArray(10);
+        writer.writeUInt(t.id);
+        writer.writeBool(t.enabled);
+        writer.writeUInt(t.pin);
+        writer.writeUInt(t.hour);
+        writer.writeUInt(t.minute);
+        writer.writeFloat(t.duration);
+        writer.writeBool(t.repeatDaily);
+        writer.writeBool(t.isActive);
+        writer.writeBool(t.isPWM);
+        writer.writeUInt(t.pwmValue);
+    }
+}
+
+// 二进制格式的引脚记录：[pin, state, pwmValue, owners]
+void TimerManager::writePins(BinaryWriter& writer) {
+    writer.beginArray(AVAILABLE_PINS_COUNT);
+    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        const PinState& ps = pinStates[i];
+        writer.beginArray(4);
+        writer.writeUInt(ps.pin);
+        writer.writeUInt(ps.level ? 1 : 0);
+        writer.writeUInt(ps.pwmValue);
+        writer.writeUInt(ps.ownerCount);
+    }
+}
+
 void TimerManager::executeManualControl(int pin, float duration, bool isPWM, int pwmValue) {
     // 验证引脚
     bool pinValid = false;
@@ -298,208 +554,274 @@ void TimerManager::executeManualControl(int pin, float duration, bool isPWM, int
         return;
     }
     
+    PinState& ps = pinStates[pinSlot[pin]];
+    bool manualHeld = false;
+    for (int i = 0; i < ps.ownerCount; i++) {
+        if (ps.owners[i].id == MANUAL_OWNER) {
+            manualHeld = true;
+            break;
+        }
+    }
+    
+    // 新的手动占用从此刻开始计时（已占用时沿用原开始时间）
+    if (!manualHeld) {
+        ps.manualStart = millis();
+        ps.manualEpoch = (timeManager && timeManager->isTimeValid()) ? timeManager->getEpochTime() : 0;
+    }
+    
     if (duration > 0.0) {
-        // 开启引脚指定时间
-        setPin(pin, HIGH, isPWM ? pwmValue : 0);
-        String modeStr = isPWM ? " PWM模式, 值=" + String(pwmValue) : " 数字模式";
-        Serial.println("手动控制：引脚 " + String(pin) + " 开启 " + String(duration) + " 秒" + modeStr);
-        
-        // 这里应该使用定时器来关闭，简化处理
-        delay((unsigned long)(duration * 1000.0));
-        setPin(pin, LOW, 0);
-        Serial.println("手动控制：引脚 " + String(pin) + " 关闭");
+        // 以手动占用者身份开启引脚，由 update() 在到期后释放（不阻塞主循环）
+        acquirePin(pin, MANUAL_OWNER, isPWM, pwmValue);
+        ps.manualUntil = millis() + (unsigned long)(duration * 1000.0);
+        if (ps.manualUntil == 0) ps.manualUntil = 1;
+        char mode[16];
+        LOG_INFO("手动控制：引脚 %d 开启 %.1f 秒%s", pin, duration,
+                 isPWM ? modeText(mode, sizeof(mode), true, pwmValue) : " 数字模式");
     } else {
-        // 切换状态
-        bool currentState = digitalRead(pin);
-        if (isPWM) {
-            // PWM模式切换
-            if (currentState) {
-                setPin(pin, LOW, 0);
-                Serial.println("手动控制：引脚 " + String(pin) + " PWM关闭");
+        // 切换手动占用；定时器的占用不受影响
+        if (manualHeld) {
+            recordManualRun(ps, millis());
+            releasePin(pin, MANUAL_OWNER);
+            LOG_INFO("手动控制：引脚 %d%s", pin, isPWM ? " PWM关闭" : " 数字切换到 0");
+        } else {
+            acquirePin(pin, MANUAL_OWNER, isPWM, pwmValue);
+            if (isPWM) {
+                LOG_INFO("手动控制：引脚 %d PWM开启, 值=%d", pin, pwmValue);
             } else {
-                setPin(pin, HIGH, pwmValue);
-                Serial.println("手动控制：引脚 " + String(pin) + " PWM开启, 值=" + String(pwmValue));
+                LOG_INFO("手动控制：引脚 %d 数字切换到 1", pin);
             }
-        } else {
-            // 数字模式切换
-            setPin(pin, !currentState, 0);
-            Serial.println("手动控制：引脚 " + String(pin) + " 数字切换到 " + String(!currentState));
         }
     }
 }
 
+// EEPROM 中 32 位整数按大端序存放
+static void writeUInt32(int addr, unsigned long value) {
+    EEPROM.write(addr, (value >> 24) & 0xFF);
+    EEPROM.write(addr + 1, (value >> 16) & 0xFF);
+    EEPROM.write(addr + 2, (value >> 8) & 0xFF);
+    EEPROM.write(addr + 3, value & 0xFF);
+}
+
+static unsigned long readUInt32(int addr) {
+    unsigned long value = 0;
+    value |= ((unsigned long)EEPROM.read(addr)) << 24;
+    value |= ((unsigned long)EEPROM.read(addr + 1)) << 16;
+    value |= ((unsigned long)EEPROM.read(addr + 2)) << 8;
+    value |= (unsigned long)EEPROM.read(addr + 3);
+    return value;
+}
+
+// 定时器记录（25字节）：配置 12 字节 + 运行时状态 13 字节，新旧存储格式共用
+static void writeTimerConfig(int addr, const TimerConfig& t) {
+    EEPROM.write(addr++, t.enabled ? 1 : 0);
+    EEPROM.write(addr++, t.pin);
+    EEPROM.write(addr++, t.hour);
+    EEPROM.write(addr++, t.minute);
+    
+    // 保存float类型的duration（4字节）
+    union {
+        float f;
+        uint8_t bytes[4];
+    } durationConverter;
+    durationConverter.f = t.duration;
+    EEPROM.write(addr++, durationConverter.bytes[0]);
+    EEPROM.write(addr++, durationConverter.bytes[1]);
+    EEPROM.write(addr++, durationConverter.bytes[2]);
+    EEPROM.write(addr++, durationConverter.bytes[3]);
+    
+    EEPROM.write(addr++, t.repeatDaily ? 1 : 0);
+    EEPROM.write(addr++, t.isPWM ? 1 : 0);
+    EEPROM.write(addr++, (t.pwmValue >> 8) & 0xFF);
+    EEPROM.write(addr++, t.pwmValue & 0xFF);
+}
+
+// 运行中定时器的剩余时间，按 TIMER_CHECKPOINT_MS 向上取整，不超过持续时间。
+// 取整后的值只在跨过整点时变化，定期保存状态时 EEPROM 内容不变就不会擦写闪存
+static uint32_t checkpointRemaining(const TimerConfig& t, unsigned long now) {
+    if (!t.isActive) return 0;
+    unsigned long durationMs = (unsigned long)(t.duration * 1000.0 + 0.5);
+    unsigned long elapsed = now - t.startTime;
+    if (elapsed >= durationMs) return 0;
+    
+    unsigned long remaining = durationMs - elapsed;
+    unsigned long rounded = remaining - remaining % TIMER_CHECKPOINT_MS;
+    if (rounded < remaining) rounded += TIMER_CHECKPOINT_MS;
+    if (rounded < remaining || rounded > durationMs) rounded = durationMs;
+    return rounded;
+}
+
+// 运行时状态：激活标记、剩余时间（毫秒）、上次触发日、真实开始时间
+static void writeTimerRuntime(int addr, const TimerConfig& t, unsigned long now) {
+    EEPROM.write(addr, t.isActive ? 1 : 0);
+    writeUInt32(addr + 1, checkpointRemaining(t, now));
+    writeUInt32(addr + 5, t.lastTriggerDay);
+    writeUInt32(addr + 9, t.realStartTime);
+}
+
+static void readTimerRecord(int addr, TimerConfig& t) {
+    t.enabled = EEPROM.read(addr++) == 1;
+    t.pin = EEPROM.read(addr++);
+    t.hour = EEPROM.read(addr++);
+    t.minute = EEPROM.read(addr++);
+    
+    // 读取float类型的duration（4字节）
+    union {
+        float f;
+        uint8_t bytes[4];
+    } durationConverter;
+    durationConverter.bytes[0] = EEPROM.read(addr++);
+    durationConverter.bytes[1] = EEPROM.read(addr++);
+    durationConverter.bytes[2] = EEPROM.read(addr++);
+    durationConverter.bytes[3] = EEPROM.read(addr++);
+    t.duration = durationConverter.f;
+    
+    t.repeatDaily = EEPROM.read(addr++) == 1;
+    t.isPWM = EEPROM.read(addr++) == 1;
+    int pwmHigh = EEPROM.read(addr++);
+    int pwmLow = EEPROM.read(addr++);
+    t.pwmValue = (pwmHigh << 8) | pwmLow;
+    
+    // 读取运行时状态（startTime 暂存保存时的剩余时间，由 loadTimers() 换算）
+    t.isActive = EEPROM.read(addr++) == 1;
+    t.startTime = readUInt32(addr);
+    t.lastTriggerDay = readUInt32(addr + 4);
+    t.realStartTime = readUInt32(addr + 8);
+    t.triggerSource = TRIGGER_SCHEDULED;
+}
+
+// 槽位格式：标记字节 + MAX_TIMERS 条定长记录 [代数(1) 占用(1) 定时器记录(25)]
+static int slotRecordAddr(int slot) {
+    return TIMER_CONFIG_ADDR + 1 + slot * TIMER_SLOT_RECORD_SIZE;
+}
+
 void TimerManager::saveTimers() {
-    int addr = TIMER_CONFIG_ADDR;
+    stateVersion++;
     
-    // 保存定时器数量
-    EEPROM.write(addr++, timerCount);
+    // 批量操作期间只标记，结束时统一提交一次
+    if (batchDepth > 0) {
+        saveDeferred = true;
+        return;
+    }
     
-    // 保存每个定时器
-    for (int i = 0; i < timerCount; i++) {
-        EEPROM.write(addr++, timers[i].enabled ? 1 : 0);
-        EEPROM.write(addr++, timers[i].pin);
-        EEPROM.write(addr++, timers[i].hour);
-        EEPROM.write(addr++, timers[i].minute);
-        
-        // 保存float类型的duration（4字节）
-        union {
-            float f;
-            uint8_t bytes[4];
-        } durationConverter;
-        durationConverter.f = timers[i].duration;
-        EEPROM.write(addr++, durationConverter.bytes[0]);
-        EEPROM.write(addr++, durationConverter.bytes[1]);
-        EEPROM.write(addr++, durationConverter.bytes[2]);
-        EEPROM.write(addr++, durationConverter.bytes[3]);
-        
-        EEPROM.write(addr++, timers[i].repeatDaily ? 1 : 0);
-        EEPROM.write(addr++, timers[i].isPWM ? 1 : 0);
-        EEPROM.write(addr++, (timers[i].pwmValue >> 8) & 0xFF);
-        EEPROM.write(addr++, timers[i].pwmValue & 0xFF);
-        
-        // 保存运行时状态
-        EEPROM.write(addr++, timers[i].isActive ? 1 : 0);
-        
-        // 保存开始时间（4字节）
-        unsigned long startTime = timers[i].startTime;
-        EEPROM.write(addr++, (startTime >> 24) & 0xFF);
-        EEPROM.write(addr++, (startTime >> 16) & 0xFF);
-        EEPROM.write(addr++, (startTime >> 8) & 0xFF);
-        EEPROM.write(addr++, startTime & 0xFF);
-        
-        // 保存上次触发天数（4字节）
-        unsigned long lastTriggerDay = timers[i].lastTriggerDay;
-        EEPROM.write(addr++, (lastTriggerDay >> 24) & 0xFF);
-        EEPROM.write(addr++, (lastTriggerDay >> 16) & 0xFF);
-        EEPROM.write(addr++, (lastTriggerDay >> 8) & 0xFF);
-        EEPROM.write(addr++, lastTriggerDay & 0xFF);
-        
-        // 保存真实开始时间（4字节）
-        unsigned long realStartTime = timers[i].realStartTime;
-        EEPROM.write(addr++, (realStartTime >> 24) & 0xFF);
-        EEPROM.write(addr++, (realStartTime >> 16) & 0xFF);
-        EEPROM.write(addr++, (realStartTime >> 8) & 0xFF);
-        EEPROM.write(addr++, realStartTime & 0xFF);
+    EEPROM.write(TIMER_CONFIG_ADDR, TIMER_STORE_MAGIC);
+    
+    unsigned long now = millis();
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        int addr = slotRecordAddr(i);
+        bool used = timers[i].id != INVALID_TIMER_ID;
+        EEPROM.write(addr, slotGeneration[i]);
+        EEPROM.write(addr + 1, used ? 1 : 0);
+        if (used) {
+            writeTimerConfig(addr + 2, timers[i]);
+            writeTimerRuntime(addr + 2 + TIMER_CONFIG_RECORD_SIZE, timers[i], now);
+        }
     }
     
     EEPROM.commit();
 }
 
+void TimerManager::loadLegacyTimers(int count) {
+    // 旧格式：数量字节 + 连续的定时器记录，依次放入槽位 0..count-1
+    for (int i = 0; i < count; i++) {
+        readTimerRecord(TIMER_CONFIG_ADDR + 1 + i * TIMER_RECORD_SIZE, timers[i]);
+        timers[i].id = ((uint16_t)slotGeneration[i] << 8) | i;
+    }
+}
+
 void TimerManager::loadTimers() {
-    int addr = TIMER_CONFIG_ADDR;
-    
-    // 读取定时器数量
-    timerCount = EEPROM.read(addr++);
-    if (timerCount > MAX_TIMERS) timerCount = 0;
-    
-    // 读取每个定时器
-    for (int i = 0; i < timerCount; i++) {
-        timers[i].enabled = EEPROM.read(addr++) == 1;
-        timers[i].pin = EEPROM.read(addr++);
-        timers[i].hour = EEPROM.read(addr++);
-        timers[i].minute = EEPROM.read(addr++);
-        
-        // 读取float类型的duration（4字节）
-        union {
-            float f;
-            uint8_t bytes[4];
-        } durationConverter;
-        durationConverter.bytes[0] = EEPROM.read(addr++);
-        durationConverter.bytes[1] = EEPROM.read(addr++);
-        durationConverter.bytes[2] = EEPROM.read(addr++);
-        durationConverter.bytes[3] = EEPROM.read(addr++);
-        timers[i].duration = durationConverter.f;
+    resetSlots();
+    
+    int marker = EEPROM.read(TIMER_CONFIG_ADDR);
+    if (marker == TIMER_STORE_MAGIC) {
+        for (int i = 0; i < MAX_TIMERS; i++) {
+            int addr = slotRecordAddr(i);
+            uint8_t generation = EEPROM.read(addr);
+            slotGeneration[i] = generation == 0 ? 1 : generation;
+            if (EEPROM.read(addr + 1) == 1) {
+                readTimerRecord(addr + 2, timers[i]);
+                timers[i].id = ((uint16_t)slotGeneration[i] << 8) | i;
+            }
+        }
+    } else if (marker <= MAX_TIMERS) {
+        loadLegacyTimers(marker);
+        LOG_INFO("已将 %d 个定时器迁移到槽位存储格式", marker);
+    }
+    
+    // 重建空闲槽位栈
+    freeCount = 0;
+    timerCount = 0;
+    for (int i = MAX_TIMERS - 1; i >= 0; i--) {
+        if (timers[i].id == INVALID_TIMER_ID) {
+            freeSlots[freeCount++] = i;
+        } else {
+            timerCount++;
+        }
+    }
+    
+    // 恢复活跃定时器的引脚状态：按保存的剩余时间立即开启，不等待网络和时间同步。
+    // 剩余时间按 TIMER_CHECKPOINT_MS 向上取整保存，最多多运行一个取整间隔；
+    // 记录了真实开始时间的，时间同步后由 reconcileRestored() 按绝对截止时间校正
+    unsigned long currentTime = millis();
+    restoredCount = 0;
+    reconcileMask = 0;
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id == INVALID_TIMER_ID || !timers[i].isActive) continue;
         
-        timers[i].repeatDaily = EEPROM.read(addr++) == 1;
+        unsigned long durationMs = (unsigned long)(timers[i].duration * 1000.0 + 0.5);
+        unsigned long remaining = timers[i].startTime;
+        if (remaining > durationMs) {
+            remaining = durationMs; // 旧版本保存的是 millis 时间戳，按重新计时处理
+        }
         
-        // 检查是否有PWM数据（向后兼容）
-        if (addr < EEPROM_SIZE - 20) { // 更新了字节数计算：duration现在是4字节而不是2字节
-            timers[i].isPWM = EEPROM.read(addr++) == 1;
-            int pwmHigh = EEPROM.read(addr++);
-            int pwmLow = EEPROM.read(addr++);
-            timers[i].pwmValue = (pwmHigh << 8) | pwmLow;
-            
-            // 读取运行时状态
-            timers[i].isActive = EEPROM.read(addr++) == 1;
-            
-            // 读取开始时间（4字节）
-            unsigned long startTime = 0;
-            startTime |= ((unsigned long)EEPROM.read(addr++)) << 24;
-            startTime |= ((unsigned long)EEPROM.read(addr++)) << 16;
-            startTime |= ((unsigned long)EEPROM.read(addr++)) << 8;
-            startTime |= (unsigned long)EEPROM.read(addr++);
-            timers[i].startTime = startTime;
-            
-            // 读取上次触发天数（4字节）
-            unsigned long lastTriggerDay = 0;
-            lastTriggerDay |= ((unsigned long)EEPROM.read(addr++)) << 24;
-            lastTriggerDay |= ((unsigned long)EEPROM.read(addr++)) << 16;
-            lastTriggerDay |= ((unsigned long)EEPROM.read(addr++)) << 8;
-            lastTriggerDay |= (unsigned long)EEPROM.read(addr++);
-            timers[i].lastTriggerDay = lastTriggerDay;
-            
-            // 读取真实开始时间（4字节）
-            unsigned long realStartTime = 0;
-            realStartTime |= ((unsigned long)EEPROM.read(addr++)) << 24;
-            realStartTime |= ((unsigned long)EEPROM.read(addr++)) << 16;
-            realStartTime |= ((unsigned long)EEPROM.read(addr++)) << 8;
-            realStartTime |= (unsigned long)EEPROM.read(addr++);
-            timers[i].realStartTime = realStartTime;
-            
-        } else {
-            // 旧数据没有PWM和运行时状态信息，设为默认值
-            timers[i].isPWM = false;
-            timers[i].pwmValue = 0;
+        if (remaining == 0) {
             timers[i].isActive = false;
-            timers[i].startTime = 0;
-            timers[i].lastTriggerDay = 0;
             timers[i].realStartTime = 0;
+            LOG_INFO("重启后发现定时器 %u 已超时，关闭引脚 %d", timers[i].id, timers[i].pin);
+            continue;
         }
         
-        // 恢复活跃定时器的引脚状态
-        if (timers[i].isActive) {
-            // 使用真实时间检查定时器是否应该仍然活跃
-            if (timeManager && timeManager->isTimeValid() && timers[i].realStartTime > 0) {
-                // 需要添加获取当前时间戳的方法到TimeManager
-                // 暂时使用millis()逻辑，但添加更好的时间处理
-                unsigned long currentTime = millis();
-                
-                // 重置开始时间为当前时间减去已经运行的时间
-                // 这样可以在重启后继续正确计时
-                if (timers[i].startTime > currentTime) {
-                    // millis() 已重置，重新计算开始时间
-                    timers[i].startTime = currentTime;
-                    Serial.println("重启后调整定时器 " + String(i) + " 开始时间");
-                }
-                
-                unsigned long elapsedTime = currentTime - timers[i].startTime;
-                
-                // 检查定时器是否已经超时
-                if (elapsedTime >= (unsigned long)(timers[i].duration * 1000.0)) {
-                    // 定时器已经超时，关闭它
-                    timers[i].isActive = false;
-                    timers[i].realStartTime = 0;
-                    setPin(timers[i].pin, LOW, 0);
-                    Serial.println("重启后发现定时器 " + String(i) + " 已超时，关闭引脚 " + String(timers[i].pin));
-                } else {
-                    // 定时器仍然有效，恢复引脚状态
-                    setPin(timers[i].pin, HIGH, timers[i].isPWM ? timers[i].pwmValue : 0);
-                    String modeStr = timers[i].isPWM ? " PWM(" + String(timers[i].pwmValue) + ")" : "";
-                    unsigned long remainingTime = (unsigned long)(timers[i].duration * 1000.0) - elapsedTime;
-                    Serial.println("恢复定时器 " + String(i) + " 状态，引脚 " + String(timers[i].pin) + " 开启" + modeStr + 
-                                  "，剩余时间: " + String(remainingTime / 1000) + "秒");
-                }
-            } else {
-                // 没有有效的时间或者是旧格式数据，保守处理
-                unsigned long currentTime = millis();
-                timers[i].startTime = currentTime;
-                setPin(timers[i].pin, HIGH, timers[i].isPWM ? timers[i].pwmValue : 0);
-                String modeStr = timers[i].isPWM ? " PWM(" + String(timers[i].pwmValue) + ")" : "";
-                Serial.println("恢复定时器 " + String(i) + " 状态，引脚 " + String(timers[i].pin) + " 开启" + modeStr + 
-                              "（重启后重新计时）");
-            }
+        timers[i].startTime = currentTime - (durationMs - remaining);
+        timers[i].triggerSource = TRIGGER_RECOVERED;
+        acquirePin(timers[i].pin, i, timers[i].isPWM, timers[i].pwmValue);
+        restoredCount++;
+        if (timers[i].realStartTime > 0) {
+            reconcileMask |= 1U << i;
+        }
+        
+        char mode[16];
+        LOG_INFO("恢复定时器 %u 状态，引脚 %d 开启%s，剩余时间: %lu秒", timers[i].id, timers[i].pin,
+                 modeText(mode, sizeof(mode), timers[i].isPWM, timers[i].pwmValue), remaining / 1000);
+    }
+    
+    if (marker != TIMER_STORE_MAGIC && timerCount > 0) {
+        saveTimers();
+    }
+}
+
+// 时间同步后，用真实开始时间校正恢复的定时器：断电期间的时间也计入已运行时间，
+// 已超过持续时间的在本次 update() 中随即关闭
+void TimerManager::reconcileRestored(unsigned long now) {
+    unsigned long epoch = timeManager->getEpochTime();
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (!(reconcileMask & (1U << i))) continue;
+        TimerConfig& t = timers[i];
+        // 期间已结束或槽位被重新使用的跳过
+        if (t.id == INVALID_TIMER_ID || !t.isActive || t.triggerSource != TRIGGER_RECOVERED ||
+            t.realStartTime == 0 || epoch < t.realStartTime) {
+            continue;
         }
+        
+        unsigned long durationMs = (unsigned long)(t.duration * 1000.0 + 0.5);
+        unsigned long elapsedSec = epoch - t.realStartTime;
+        unsigned long elapsed = elapsedSec >= durationMs / 1000 + 1 ? durationMs : elapsedSec * 1000;
+        if (elapsed > durationMs) elapsed = durationMs;
+        
+        t.startTime = now - elapsed;
+        LOG_INFO("按真实时间校正定时器 %u：已运行 %lu秒，剩余 %lu秒", t.id, elapsed / 1000,
+                 (durationMs - elapsed) / 1000);
     }
+    reconcileMask = 0;
+    bootProfile.milestone("timers_reconciled");
 }
 
 bool TimerManager::hasValidTime() {
@@ -509,64 +831,62 @@ bool TimerManager::hasValidTime() {
 void TimerManager::saveTimerStates() {
     // 只保存运行时状态，不保存完整配置
     // 这样可以减少EEPROM写入次数，延长寿命
-    int addr = TIMER_CONFIG_ADDR + 1; // 跳过定时器数量
-    
-    for (int i = 0; i < timerCount; i++) {
-        // 跳过基本配置部分 (12字节: enabled(1) + pin(1) + hour(1) + minute(1) + duration(4) + repeatDaily(1) + isPWM(1) + pwmValue(2))
-        addr += 12;
-        
-        // 更新运行时状态部分 (13字节)
-        EEPROM.write(addr++, timers[i].isActive ? 1 : 0);
-        
-        // 更新开始时间（4字节）
-        unsigned long startTime = timers[i].startTime;
-        EEPROM.write(addr++, (startTime >> 24) & 0xFF);
-        EEPROM.write(addr++, (startTime >> 16) & 0xFF);
-        EEPROM.write(addr++, (startTime >> 8) & 0xFF);
-        EEPROM.write(addr++, startTime & 0xFF);
-        
-        // 更新上次触发天数（4字节）
-        unsigned long lastTriggerDay = timers[i].lastTriggerDay;
-        EEPROM.write(addr++, (lastTriggerDay >> 24) & 0xFF);
-        EEPROM.write(addr++, (lastTriggerDay >> 16) & 0xFF);
-        EEPROM.write(addr++, (lastTriggerDay >> 8) & 0xFF);
-        EEPROM.write(addr++, lastTriggerDay & 0xFF);
-        
-        // 更新真实开始时间（4字节）
-        unsigned long realStartTime = timers[i].realStartTime;
-        EEPROM.write(addr++, (realStartTime >> 24) & 0xFF);
-        EEPROM.write(addr++, (realStartTime >> 16) & 0xFF);
-        EEPROM.write(addr++, (realStartTime >> 8) & 0xFF);
-        EEPROM.write(addr++, realStartTime & 0xFF);
+    unsigned long now = millis();
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id == INVALID_TIMER_ID) continue;
+        writeTimerRuntime(slotRecordAddr(i) + 2 + TIMER_CONFIG_RECORD_SIZE, timers[i], now);
     }
     
     EEPROM.commit();
 }
 
 void TimerManager::clearAllTimers() {
-    // 关闭所有激活的引脚
-    for (int i = 0; i < timerCount; i++) {
-        if (timers[i].isActive) {
-            setPin(timers[i].pin, LOW, 0);
+    // 释放所有激活定时器占用的引脚（手动占用保留）
+    unsigned long now = millis();
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id != INVALID_TIMER_ID && timers[i].isActive) {
+            recordTimerRun(i, now);
+            releasePin(timers[i].pin, i);
         }
     }
     
-    timerCount = 0;
+    // 递增所有已用槽位的代数，旧 ID 全部失效
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id != INVALID_TIMER_ID) {
+            slotGeneration[i] = slotGeneration[i] >= 0xFF ? 1 : slotGeneration[i] + 1;
+        }
+    }
+    uint8_t generations[MAX_TIMERS];
+    memcpy(generations, slotGeneration, sizeof(generations));
+    resetSlots();
+    memcpy(slotGeneration, generations, sizeof(generations));
+    
     saveTimers();
-    Serial.println("所有定时器已清除");
+    LOG_INFO("所有定时器已清除");
 }
 
 int TimerManager::getTimerCount() {
     return timerCount;
 }
 
-TimerConfig TimerManager::getTimer(int index) {
-    if (index >= 0 && index < timerCount) {
-        return timers[index];
+int TimerManager::getActiveTimerCount() {
+    int activeCount = 0;
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        if (timers[i].id != INVALID_TIMER_ID && timers[i].isActive) activeCount++;
     }
-    
-    TimerConfig empty = {false, 0, 0, 0, 0.0, false, false, 0, 0UL, false, 0, 0UL};
-    return empty;
+    return activeCount;
+}
+
+const TimerConfig* TimerManager::findTimer(uint16_t id) {
+    int slot = slotOf(id);
+    return slot < 0 ? nullptr : &timers[slot];
+}
+
+const TimerConfig* TimerManager::getTimerBySlot(int slot) {
+    if (slot < 0 || slot >= MAX_TIMERS || timers[slot].id == INVALID_TIMER_ID) {
+        return nullptr;
+    }
+    return &timers[slot];
 }
 
 void TimerManager::setPin(int pin, bool state, int pwmValue) {
@@ -578,3 +898,334 @@ void TimerManager::setPin(int pin, bool state, int pwmValue) {
         digitalWrite(pin, state ? HIGH : LOW);
     }
 }
+
+
+void TimerManager::initPinStates() {
+    for (int g = 0; g < MAX_GPIO; g++) {
+        pinSlot[g] = -1;
+    }
+    
+    // 为PWM引脚设置频率
+    analogWriteFreq(PWM_FREQUENCY);
+    analogWriteResolution(PWM_RESOLUTION);
+    
+    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        int pin = AVAILABLE_PINS[i];
+        pinMode(pin, OUTPUT);
+        digitalWrite(pin, LOW);
+        
+        pinSlot[pin] = i;
+        pinStates[i].pin = pin;
+        pinStates[i].ownerCount = 0;
+        pinStates[i].level = false;
+        pinStates[i].pwmValue = 0;
+        pinStates[i].manualUntil = 0;
+        pinStates[i].manualStart = 0;
+        pinStates[i].manualEpoch = 0;
+        pinStates[i].outputSince = 0;
+    }
+}
+
+void TimerManager::acquirePin(int pin, uint8_t owner, bool isPWM, int pwmValue) {
+    if (pin < 0 || pin >= MAX_GPIO || pinSlot[pin] < 0) return;
+    PinState& ps = pinStates[pinSlot[pin]];
+    
+    // 已占用则移除旧记录，重新追加到末尾（更新"最后开启"顺序和输出值）
+    int n = 0;
+    for (int i = 0; i < ps.ownerCount; i++) {
+        if (ps.owners[i].id != owner) {
+            ps.owners[n++] = ps.owners[i];
+        }
+    }
+    if (n >= MAX_PIN_OWNERS) return;
+    
+    ps.owners[n].id = owner;
+    ps.owners[n].isPWM = isPWM;
+    ps.owners[n].value = isPWM ? constrain(pwmValue, 0, PWM_MAX_VALUE) : PWM_MAX_VALUE;
+    ps.ownerCount = n + 1;
+    if (owner == MANUAL_OWNER) ps.manualUntil = 0;
+    
+    applyPinState(ps);
+}
+
+void TimerManager::releasePin(int pin, uint8_t owner) {
+    if (pin < 0 || pin >= MAX_GPIO || pinSlot[pin] < 0) return;
+    PinState& ps = pinStates[pinSlot[pin]];
+    
+    int n = 0;
+    for (int i = 0; i < ps.ownerCount; i++) {
+        if (ps.owners[i].id != owner) {
+            ps.owners[n++] = ps.owners[i];
+        }
+    }
+    ps.ownerCount = n;
+    if (owner == MANUAL_OWNER) ps.manualUntil = 0;
+    
+    applyPinState(ps);
+}
+
+void TimerManager::applyPinState(PinState& ps) {
+    // 按合并规则计算有效输出；全部为数字占用者时保持数字输出
+    bool anyPWM = false;
+    int value = 0;
+    for (int i = 0; i < ps.ownerCount; i++) {
+        const PinOwner& o = ps.owners[i];
+        if (o.isPWM) anyPWM = true;
+#if PIN_MERGE_MODE == PIN_MERGE_SUM
+        value += o.value;
+#elif PIN_MERGE_MODE == PIN_MERGE_LATEST
+        value = o.value;
+        anyPWM = o.isPWM;
+#else
+        if (o.value > value) value = o.value;
+#endif
+    }
+    if (value > PWM_MAX_VALUE) value = PWM_MAX_VALUE;
+    
+    bool level = ps.ownerCount > 0 && value > 0;
+    int pwmValue = (level && anyPWM && value < PWM_MAX_VALUE) ? value : 0;
+    
+    if (level == ps.level && pwmValue == ps.pwmValue) return;
+    
+    accumulateOutput(ps, ps.level && !level, millis());
+    
+    bool wasPWM = ps.pwmValue > 0;
+    ps.level = level;
+    ps.pwmValue = pwmValue;
+    stagePin(&ps - pinStates, wasPWM);
+}
+
+void TimerManager::stagePin(int slot, bool wasPWM) {
+    const PinState& ps = pinStates[slot];
+    uint32_t bit = (ps.pin < 16) ? (1UL << ps.pin) : 0;
+    
+    pendingSet &= ~bit;
+    pendingClear &= ~bit;
+    if (ps.pin == 16) pending16 = -1;
+    pendingPWM &= ~(1U << slot);
+    
+    if (ps.pwmValue > 0) {
+        pendingPWM |= (1U << slot);
+    } else {
+        if (wasPWM) pendingStopPWM |= (1U << slot);
+        if (ps.pin == 16) {
+            pending16 = ps.level ? 1 : 0;
+        } else if (ps.level) {
+            pendingSet |= bit;
+        } else {
+            pendingClear |= bit;
+        }
+    }
+    
+    // 不在批量区间内（如 Web 请求触发的手动控制）则立即提交
+    if (actuationDepth == 0) {
+        commitActuation();
+    }
+}
+
+void TimerManager::beginActuation() {
+    actuationDepth++;
+}
+
+void TimerManager::commitActuation() {
+    if (actuationDepth > 0) actuationDepth--;
+    if (actuationDepth > 0) return;
+    if (!pendingSet && !pendingClear && pending16 < 0 && !pendingPWM) return;
+    
+    // 从PWM切回数字输出的引脚需要先停止波形发生器
+    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        if (pendingStopPWM & (1U << i)) {
+            _stopPWM(pinStates[i].pin);
+            stopWaveform(pinStates[i].pin);
+        }
+    }
+    
+    // 数字输出：通过置位/清零寄存器写入，不读回 GPO，波形发生器在 NMI 中翻转的其他引脚不受影响；
+    // 置高和置低各一次寄存器写入。GPIO16 位于 RTC 寄存器，紧随其后写入
+    uint32_t t0 = ESP.getCycleCount();
+    uint32_t savedPS = xt_rsil(15);
+    if (pendingSet) GPOS = pendingSet;
+    if (pendingClear) GPOC = pendingClear;
+    if (pending16 >= 0) {
+        GP16O = pending16 ? (GP16O | 1) : (GP16O & ~1);
+    }
+    xt_wsr_ps(savedPS);
+    uint32_t t1 = ESP.getCycleCount();
+    
+    // PWM 输出紧接着批量更新
+    int pwmCount = 0;
+    for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+        if (pendingPWM & (1U << i)) {
+            analogWrite(pinStates[i].pin, pinStates[i].pwmValue);
+            pwmCount++;
+        }
+    }
+    uint32_t t2 = ESP.getCycleCount();
+    
+    int edges = __builtin_popcount(pendingSet | pendingClear) + (pending16 >= 0 ? 1 : 0) + pwmCount;
+    stateVersion++;
+    actuationStats.commits++;
+    actuationStats.edges += edges;
+    if (edges > actuationStats.maxBatch) actuationStats.maxBatch = edges;
+    actuationStats.lastDigitalCycles = t1 - t0;
+    if (actuationStats.lastDigitalCycles > actuationStats.maxDigitalCycles) {
+        actuationStats.maxDigitalCycles = actuationStats.lastDigitalCycles;
+    }
+    actuationStats.lastPWMUpdateUs = pwmCount > 0 ? (t2 - t1) / ESP.getCpuFreqMHz() : 0;
+    if (actuationStats.lastPWMUpdateUs > actuationStats.maxPWMUpdateUs) {
+        actuationStats.maxPWMUpdateUs = actuationStats.lastPWMUpdateUs;
+    }
+    
+    pendingSet = 0;
+    pendingClear = 0;
+    pending16 = -1;
+    pendingPWM = 0;
+    pendingStopPWM = 0;
+}
+
+const ActuationStats& TimerManager::getActuationStats() {
+    return actuationStats;
+}
+
+void TimerManager::recordTimerRun(int slot, unsigned long now) {
+    const TimerConfig& t = timers[slot];
+    history.append(t.id, t.pin, t.realStartTime, (uint32_t)(t.duration * 1000.0 + 0.5), now - t.startTime,
+                   t.isPWM ? t.pwmValue : 0, t.triggerSource);
+}
+
+void TimerManager::recordManualRun(PinState& ps, unsigned long now) {
+    for (int i = 0; i < ps.ownerCount; i++) {
+        const PinOwner& o = ps.owners[i];
+        if (o.id != MANUAL_OWNER) continue;
+        uint32_t requestedMs = ps.manualUntil ? ps.manualUntil - ps.manualStart : 0;
+        history.append(INVALID_TIMER_ID, ps.pin, ps.manualEpoch, requestedMs, now - ps.manualStart,
+                       o.isPWM ? o.value : 0, TRIGGER_MANUAL);
+        return;
+    }
+}
+
+HistoryManager& TimerManager::getHistory() {
+    return history;
+}
+
+void TimerManager::creditOnTime(DailyRollup* r, int slot, int pwmValue, unsigned long ms) {
+    int duty = pwmValue > 0 ? pwmValue : PWM_MAX_VALUE;
+    r->onMs[slot] += ms;
+    r->dutyMs[slot] += (uint32_t)((uint64_t)ms * duty / PWM_MAX_VALUE);
+    statsDirty = true;
+}
+
+void TimerManager::accumulateOutput(PinState& ps, bool turningOff, unsigned long now) {
+    // 输出状态变化时把上一段开启时间计入当天统计
+    if (!ps.level) {
+        ps.outputSince = now;
+        return;
+    }
+    
+    // 先处理跨天，午夜前的部分会计入前一天并把 outputSince 移到午夜
+    DailyRollup* r = currentRollup();
+    unsigned long elapsed = now - ps.outputSince;
+    ps.outputSince = now;
+    if (!r) return;
+    int slot = &ps - pinStates;
+    creditOnTime(r, slot, ps.pwmValue, elapsed);
+    if (turningOff) {
+        r->activations[slot]++;
+    }
+}
+
+DailyRollup* TimerManager::currentRollup() {
+    // 没有有效时间时无法确定日期，计入最近一天（若存在）
+    if (!hasValidTime()) {
+        return dailyStats[statsHead].day != 0 ? &dailyStats[statsHead] : nullptr;
+    }
+    
+    uint32_t day = timeManager->getCurrentDay();
+    if (dailyStats[statsHead].day == day) {
+        return &dailyStats[statsHead];
+    }
+    if (dailyStats[statsHead].day > day) {
+        return nullptr; // 时钟回拨，忽略
+    }
+    
+    // 跨天：仍在开启的输出把午夜前的时间计入结束的一天（只拆分相邻的一天）
+    DailyRollup* ended = &dailyStats[statsHead];
+    if (ended->day + 1 == day) {
+        unsigned long now = millis();
+        unsigned long midnight = now - (unsigned long)timeManager->getSecondsOfDay() * 1000UL;
+        for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+            PinState& ps = pinStates[i];
+            if (!ps.level || (long)(midnight - ps.outputSince) <= 0) continue;
+            creditOnTime(ended, i, ps.pwmValue, midnight - ps.outputSince);
+            ps.outputSince = midnight;
+        }
+    }
+    
+    // 覆盖最旧的一天，并把已结束的一天立即落盘
+    bool hadDay = ended->day != 0;
+    if (hadDay) {
+        statsHead = (statsHead + 1) % STATS_DAYS;
+    }
+    memset(&dailyStats[statsHead], 0, sizeof(DailyRollup));
+    dailyStats[statsHead].day = day;
+    if (hadDay) {
+        saveDailyStats();
+    }
+    return &dailyStats[statsHead];
+}
+
+const DailyRollup* TimerManager::getDailyStats(int daysAgo) {
+    if (daysAgo < 0 || daysAgo >= STATS_DAYS) return nullptr;
+    const DailyRollup* r = &dailyStats[(statsHead - daysAgo + STATS_DAYS) % STATS_DAYS];
+    return r->day != 0 ? r : nullptr;
+}
+
+void TimerManager::loadDailyStats() {
+    // EEPROM 已被定时器占满，统计数据保存在 LittleFS
+    if (!LittleFS.begin()) return;
+    
+    File f = LittleFS.open(STATS_FILE, "r");
+    if (!f) return;
+    
+    uint8_t header[4];
+    if (f.read(header, sizeof(header)) == sizeof(header) &&
+        header[0] == STATS_MAGIC && header[1] == STATS_DAYS && header[2] == AVAILABLE_PINS_COUNT &&
+        header[3] < STATS_DAYS &&
+        f.read((uint8_t*)dailyStats, sizeof(dailyStats)) == sizeof(dailyStats)) {
+        statsHead = header[3];
+        LOG_INFO("已加载每日统计");
+    } else {
+        memset(dailyStats, 0, sizeof(dailyStats));
+        statsHead = 0;
+    }
+    f.close();
+}
+
+void TimerManager::saveDailyStats() {
+    lastStatsSave = millis();
+    statsDirty = false;
+    
+    File f = LittleFS.open(STATS_FILE, "w");
+    if (!f) return;
+    
+    uint8_t header[4] = {STATS_MAGIC, STATS_DAYS, (uint8_t)AVAILABLE_PINS_COUNT, (uint8_t)statsHead};
+    f.write(header, sizeof(header));
+    f.write((const uint8_t*)dailyStats, sizeof(dailyStats));
+    f.close();
+}
+
+const PinState* TimerManager::getPinState(int pin) {
+    if (pin < 0 || pin >= MAX_GPIO || pinSlot[pin] < 0) return nullptr;
+    return &pinStates[pinSlot[pin]];
+}
+
+int TimerManager::getPinTimerOwner(int pin) {
+    const PinState* ps = getPinState(pin);
+    if (!ps) return -1;
+    
+    // 返回最后开启的定时器占用者的 ID
+    for (int i = ps->ownerCount - 1; i >= 0; i--) {
+        if (ps->owners[i].id != MANUAL_OWNER) return timers[ps->owners[i].id].id;
+    }
+    return -1;
+}
\ No newline at end of file
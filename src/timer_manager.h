@@ -6,33 +6,116 @@
 #include <ArduinoJson.h>
 #include "config.h"
 #include "time_manager.h"
+#include "binary_writer.h"
+#include "history_manager.h"
+
+// 执行层统计：每个 tick 的引脚变化合并后一次提交
+struct ActuationStats {
+    unsigned long commits;          // 批量提交次数
+    unsigned long edges;            // 累计输出变化数
+    uint8_t maxBatch;               // 单次提交的最大变化数
+    uint32_t lastDigitalCycles;     // 最近一次数字输出写入耗时（CPU 周期）
+    uint32_t maxDigitalCycles;
+    uint32_t lastPWMUpdateUs;       // 最近一次批量更新 PWM 引脚的耗时
+    uint32_t maxPWMUpdateUs;
+};
+
+// 单日按引脚汇总（下标与 AVAILABLE_PINS 一致）
+struct DailyRollup {
+    uint32_t day;                                 // 自 Unix epoch 起的天数，0 表示空
+    uint32_t onMs[AVAILABLE_PINS_COUNT];          // 累计开启时间
+    uint32_t dutyMs[AVAILABLE_PINS_COUNT];        // 按占空比加权的开启时间（onMs × duty / PWM_MAX_VALUE）
+    uint16_t activations[AVAILABLE_PINS_COUNT];   // 开启次数（按关闭时计数）
+};
 
 class TimerManager {
 private:
+    // 槽位表：定时器记录原地存放，删除只释放槽位，不移动其他记录
     TimerConfig timers[MAX_TIMERS];
+    uint8_t slotGeneration[MAX_TIMERS];  // 每次释放槽位后递增，使旧 ID 失效
+    uint8_t freeSlots[MAX_TIMERS];       // 空闲槽位栈
+    int freeCount;
     int timerCount;
+    PinState pinStates[AVAILABLE_PINS_COUNT];
+    int8_t pinSlot[MAX_GPIO];            // GPIO -> pinStates 下标，-1 表示不可用
+    
+    // 待提交的输出变化
+    int actuationDepth;
+    uint32_t pendingSet;                 // GPIO0~15 置高掩码
+    uint32_t pendingClear;               // GPIO0~15 置低掩码
+    int8_t pending16;                    // GPIO16：-1 无变化，0/1 目标电平
+    uint16_t pendingPWM;                 // 需要更新PWM的引脚（pinStates 下标位图）
+    uint16_t pendingStopPWM;             // 从PWM切回数字输出的引脚
+    ActuationStats actuationStats;
+    
+    HistoryManager history;
+    DailyRollup dailyStats[STATS_DAYS];  // 环形保存，statsHead 为最新一天
+    int statsHead;
+    bool statsDirty;
+    unsigned long lastStatsSave;
     TimeManager* timeManager;
     unsigned long lastStateSave;
+    uint32_t stateVersion;               // 配置或输出变化时递增，供发现信标使用
+    int batchDepth;                      // >0 时 saveTimers() 延迟到 endBatch() 统一提交
+    bool saveDeferred;
+    uint8_t restoredCount;               // 启动时恢复的运行中定时器数
+    uint16_t reconcileMask;              // 恢复后等待按真实时间校正的槽位
     const unsigned long STATE_SAVE_INTERVAL = 30000; // 30秒保存一次状态
     
+    void initPinStates();
+    void applyPinState(PinState& ps);
+    void stagePin(int slot, bool wasPWM);
+    void resetSlots();
+    int slotOf(uint16_t id);
+    void loadLegacyTimers(int count);
+    void reconcileRestored(unsigned long now);
+    void recordTimerRun(int slot, unsigned long now);
+    void recordManualRun(PinState& ps, unsigned long now);
+    void accumulateOutput(PinState& ps, bool turningOff, unsigned long now);
+    void creditOnTime(DailyRollup* r, int slot, int pwmValue, unsigned long ms);
+    DailyRollup* currentRollup();
+    void loadDailyStats();
+    void saveDailyStats();
+    
 public:
     TimerManager();
     void begin(TimeManager* tm);
     void update();
-    bool addTimer(int pin, int hour, int minute, float duration, bool repeatDaily = false, bool isPWM = false, int pwmValue = 512);
-    bool removeTimer(int index);
-    bool updateTimer(int index, int pin, int hour, int minute, float duration, bool enabled, bool repeatDaily = false, bool isPWM = false, int pwmValue = 512);
+    uint32_t getTimeToNextEvent(); // 距下一次开启/关闭的毫秒数
+    uint32_t getStateVersion() { return stateVersion; }
+    uint16_t addTimer(int pin, int hour, int minute, float duration, bool repeatDaily = false, bool isPWM = false, int pwmValue = 512);
+    bool removeTimer(uint16_t id);
+    bool updateTimer(uint16_t id, int pin, int hour, int minute, float duration, bool enabled, bool repeatDaily = false, bool isPWM = false, int pwmValue = 512);
+    bool validateTimer(int pin, int hour, int minute, float duration, bool isPWM, int pwmValue);
+    void beginBatch();
+    void endBatch();
+    bool applyBatch(JsonArrayConst ops, JsonArray results);
     String getTimersJSON();
+    void writeTimers(BinaryWriter& writer);
     void saveTimers();
     void saveTimerStates(); // 新增：仅保存运行时状态
     void loadTimers();
     void clearAllTimers();
     int getTimerCount();
-    TimerConfig getTimer(int index);
+    int getActiveTimerCount();
+    const TimerConfig* findTimer(uint16_t id);
+    const TimerConfig* getTimerBySlot(int slot);
     void setPin(int pin, bool state, int pwmValue = 0);
+    void acquirePin(int pin, uint8_t owner, bool isPWM = false, int pwmValue = 0);
+    void releasePin(int pin, uint8_t owner);
+    const PinState* getPinState(int pin);
+    void beginActuation();
+    void commitActuation();
+    const ActuationStats& getActuationStats();
+    HistoryManager& getHistory();
+    const DailyRollup* getDailyStats(int daysAgo);
+    int getPinTimerOwner(int pin);
     String getAvailablePinsJSON();
+    void writePins(BinaryWriter& writer);
     void executeManualControl(int pin, float duration, bool isPWM = false, int pwmValue = 512);
     bool hasValidTime();
+    int getRestoredCount() { return restoredCount; }
+    bool hasPendingReconcile() { return reconcileMask != 0; }
 };
 
 #endif
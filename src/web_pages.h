@@ -1,1494 +1,832 @@
 #ifndef WEB_PAGES_H
 #define WEB_PAGES_H
 
-// AP模式专用页面 - 无需外部CSS，仅WiFi设置
-const char AP_MODE_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="zh-CN">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>PetIO WiFi设置</title>
-    <style>
-        * {
-            margin: 0;
-            padding: 0;
-            box-sizing: border-box;
-        }
-        body {
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background-color: #f3f4f6;
-            color: #374151;
-            line-height: 1.6;
-            min-height: 100vh;
-            display: flex;
-            align-items: center;
-            justify-content: center;
-            padding: 20px;
-        }
-        .container {
-            max-width: 400px;
-            width: 100%;
-            background: white;
-            border-radius: 12px;
-            box-shadow: 0 4px 6px -1px rgba(0, 0, 0, 0.1);
-            overflow: hidden;
-        }
-        .header {
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            color: white;
-            padding: 24px;
-            text-align: center;
-        }
-        .header h1 {
-            font-size: 24px;
-            font-weight: bold;
-            margin-bottom: 8px;
-        }
-        .header p {
-            opacity: 0.9;
-            font-size: 14px;
-        }
-        .content {
-            padding: 32px 24px;
-        }
-        .form-group {
-            margin-bottom: 24px;
-        }
-        .form-group label {
-            display: block;
-            font-weight: 600;
-            margin-bottom: 8px;
-            color: #374151;
-        }
-        .form-group input {
-            width: 100%;
-            padding: 12px 16px;
-            border: 2px solid #e5e7eb;
-            border-radius: 8px;
-            font-size: 16px;
-            transition: border-color 0.2s;
-        }
-        .form-group input:focus {
-            outline: none;
-            border-color: #667eea;
-            box-shadow: 0 0 0 3px rgba(102, 126, 234, 0.1);
-        }
-        .btn {
-            width: 100%;
-            padding: 14px 20px;
-            border: none;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: 600;
-            cursor: pointer;
-            transition: all 0.2s;
-            text-align: center;
-            display: inline-block;
-            text-decoration: none;
-        }
-        .btn-primary {
-            background: #667eea;
-            color: white;
-            margin-bottom: 12px;
-        }
-        .btn-primary:hover {
-            background: #5a6fd8;
-            transform: translateY(-1px);
-        }
-        .btn-secondary {
-            background: #f59e0b;
-            color: white;
-        }
-        .btn-secondary:hover {
-            background: #d97706;
-            transform: translateY(-1px);
-        }
-        .alert {
-            padding: 16px;
-            border-radius: 8px;
-            margin-bottom: 24px;
-            font-size: 14px;
-        }
-        .alert-info {
-            background: #dbeafe;
-            color: #1e40af;
-            border: 1px solid #93c5fd;
-        }
-        .alert-success {
-            background: #d1fae5;
-            color: #065f46;
-            border: 1px solid #6ee7b7;
-        }
-        .alert-error {
-            background: #fee2e2;
-            color: #991b1b;
-            border: 1px solid #fca5a5;
-        }
-        .hidden {
-            display: none !important;
-        }
-        .status-badge {
-            display: inline-flex;
-            align-items: center;
-            padding: 6px 12px;
-            background: #fbbf24;
-            color: #92400e;
-            border-radius: 20px;
-            font-size: 12px;
-            font-weight: 600;
-            margin-bottom: 16px;
-        }
-        .footer {
-            text-align: center;
-            padding: 16px 24px;
-            background: #f9fafb;
-            border-top: 1px solid #e5e7eb;
-            color: #6b7280;
-            font-size: 12px;
-        }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <div class="header">
-            <h1>🐾 PetIO</h1>
-            <p>WiFi网络配置</p>
-        </div>
-        
-        <div class="content">
-            <div class="status-badge">
-                📶 AP模式 - 需要连接WiFi
-            </div>
-            
-            <div id="wifi-message" class="hidden"></div>
-            
-            <div class="alert alert-info">
-                💡 设备当前处于热点模式。请连接到您的WiFi网络以启用完整功能，包括定时器和时间同步。
-            </div>
-            
-            <form id="wifi-form" onsubmit="saveWiFi(event)">
-                <div class="form-group">
-                    <label for="wifi-ssid">网络名称 (SSID)</label>
-                    <input type="text" id="wifi-ssid" name="ssid" placeholder="输入WiFi网络名称" maxlength="31" required>
-                </div>
-                
-                <div class="form-group">
-                    <label for="wifi-password">网络密码</label>
-                    <input type="password" id="wifi-password" name="password" placeholder="输入WiFi密码 (可选)" maxlength="63">
-                </div>
-                
-                <button type="submit" class="btn btn-primary">
-                    💾 保存并连接WiFi
-                </button>
-                
-                <button type="button" class="btn btn-secondary" onclick="restartAP()">
-                    🔄 重启热点模式
-                </button>
-            </form>
-        </div>
-        
-        <div class="footer">
-            连接WiFi后将自动跳转到完整控制面板
-        </div>
-    </div>
-
-    <script>
-        function showMessage(message, type = 'info') {
-            const messageDiv = document.getElementById('wifi-message');
-            messageDiv.className = `alert alert-${type}`;
-            messageDiv.textContent = message;
-            messageDiv.classList.remove('hidden');
-            
-            if (type === 'success') {
-                setTimeout(() => {
-                    messageDiv.classList.add('hidden');
-                }, 3000);
-            }
-        }
-
-        async function saveWiFi(event) {
-            event.preventDefault();
-            
-            const ssid = document.getElementById('wifi-ssid').value.trim();
-            const password = document.getElementById('wifi-password').value;
-            
-            if (!ssid) {
-                showMessage('请输入WiFi网络名称', 'error');
-                return;
-            }
-            
-            try {
-                showMessage('正在连接WiFi，请稍候...', 'info');
-                
-                const response = await fetch('/api/wifi', {
-                    method: 'POST',
-                    headers: {
-                        'Content-Type': 'application/json',
-                    },
-                    body: JSON.stringify({ ssid, password })
-                });
-                
-                const result = await response.json();
-                
-                if (result.success) {
-                    showMessage('WiFi配置已保存！设备正在重启并连接网络...', 'success');
-                    // 15秒后尝试重定向到设备的新IP
-                    setTimeout(() => {
-                        if (result.ip) {
-                            window.location.href = `http://${result.ip}`;
-                        } else {
-                            window.location.reload();
-                        }
-                    }, 15000);
-                } else {
-                    showMessage(result.message || 'WiFi配置失败，请检查网络名称和密码', 'error');
-                }
-            } catch (error) {
-                console.error('WiFi配置错误:', error);
-                showMessage('网络错误，请重试', 'error');
-            }
-        }
-
-        async function restartAP() {
-            try {
-                showMessage('正在重启为热点模式...', 'info');
-                
-                const response = await fetch('/api/restart-ap', {
-                    method: 'POST'
-                });
-                
-                if (response.ok) {
-                    showMessage('设备正在重启为热点模式...', 'success');
-                    setTimeout(() => {
-                        window.location.reload();
-                    }, 5000);
-                } else {
-                    showMessage('重启失败，请重试', 'error');
-                }
-            } catch (error) {
-                console.error('重启错误:', error);
-                showMessage('网络错误，请重试', 'error');
-            }
-        }
-
-        // 页面加载时检查连接状态
-        document.addEventListener('DOMContentLoaded', function() {
-            // 定期检查是否已连接WiFi
-            const checkConnection = async () => {
-                try {
-                    const response = await fetch('/api/status');
-                    const status = await response.json();
-                    
-                    if (status.wifiConnected) {
-                        showMessage('WiFi连接成功！正在跳转到完整界面...', 'success');
-                        setTimeout(() => {
-                            window.location.href = '/';
-                        }, 2000);
-                    }
-                } catch (error) {
-                    // 忽略错误，继续检查
-                }
-            };
-            
-            // 每5秒检查一次连接状态
-            setInterval(checkConnection, 5000);
-        });
-    </script>
-</body>
-</html>
-)rawliteral";
-
-const char INDEX_HTML[] PROGMEM = R"rawliteral(
-<!DOCTYPE html>
-<html lang="zh-CN">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>PetIO 控制面板</title>
-    <script src="https://cdn.tailwindcss.com"></script>
-    <style>
-        /* 保持字体平滑 */
-        body {
-            -webkit-font-smoothing: antialiased;
-            -moz-osx-font-smoothing: grayscale;
-        }
-        /* 自定义活动标签下划线动画 */
-        .tab.active {
-            position: relative;
-        }
-        .tab.active::after {
-            content: '';
-            position: absolute;
-            bottom: -1px;
-            left: 0;
-            right: 0;
-            height: 2px;
-            background-color: #4f46e5; /* indigo-600 */
-            animation: underline 0.3s ease-out;
-        }
-        @keyframes underline {
-            from { width: 0; }
-            to { width: 100%; }
-        }
-        /* 简单的淡入动画 */
-        .fade-in {
-            animation: fadeIn 0.5s ease-in-out;
-        }
-        @keyframes fadeIn {
-            from { opacity: 0; transform: translateY(10px); }
-            to { opacity: 1; transform: translateY(0); }
-        }
-        .hidden {
-            display: none;
-        }
-    </style>
-</head>
-<body class="bg-gray-100 text-gray-800 font-sans">
-
-    <div class="container mx-auto max-w-7xl p-4">
-        
-        <header class="bg-white rounded-xl shadow-sm p-6 mb-6">
-            <div class="flex justify-between items-center">
-                <div>
-                    <h1 class="text-2xl font-bold text-gray-900">🐾 PetIO 控制面板</h1>
-                    <p class="text-sm text-gray-500 mt-1">一个智能宠物喂养定时器</p>
-                </div>
-                <div id="connection-status" class="text-sm font-medium text-right">
-                    <span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-gray-100 text-gray-800">
-                        检测中...
-                    </span>
-                </div>
-            </div>
-            <div id="device-info" class="text-xs text-gray-500 mt-4 border-t border-gray-200 pt-2"></div>
-        </header>
-
-        <main>
-            <div class="bg-white rounded-xl shadow-sm">
-                <div class="border-b border-gray-200">
-                    <nav class="flex space-x-2 px-4" aria-label="Tabs">
-                        <button class="tab active" onclick="switchTab('timers', this)" id="timers-tab">定时器</button>
-                        <button class="tab" onclick="switchTab('manual', this)">手动控制</button>
-                        <button class="tab" onclick="switchTab('system', this)">系统状态</button>
-                        <button class="tab" onclick="switchTab('wifi', this)">WiFi设置</button>
-                        <button class="tab" onclick="switchTab('firmware', this)">固件更新</button>
-                    </nav>
-                </div>
-
-                <div class="p-6">
-                    <!-- 定时器管理 -->
-                    <div id="timers-content" class="tab-content fade-in">
-                        <div id="ap-mode-notice" class="hidden p-4 mb-4 text-sm text-yellow-800 rounded-lg bg-yellow-50 border border-yellow-200" role="alert">
-                            <span class="font-medium">⚠️ AP 模式提醒：</span> 当前设备处于 AP 模式，无法同步网络时间。请先连接到 WiFi 网络以启用定时器功能。
-                        </div>
-                        
-                        <div class="grid grid-cols-1 lg:grid-cols-3 gap-6">
-                            <div class="lg:col-span-1 space-y-6">
-                                <div id="timer-form" class="p-5 border rounded-lg bg-gray-50">
-                                    <h3 class="text-lg font-semibold mb-4 text-gray-800">添加新定时器</h3>
-                                    <div id="timer-message" class="hidden mb-4"></div>
-                                    <div class="space-y-4">
-                                        <div>
-                                            <label for="timer-pin" class="block text-sm font-medium text-gray-700 mb-1">选择引脚</label>
-                                            <select id="timer-pin" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500"></select>
-                                        </div>
-                                        <div>
-                                            <label for="timer-time" class="block text-sm font-medium text-gray-700 mb-1">触发时间</label>
-                                            <input type="time" id="timer-time" value="12:00" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                        </div>
-                                        <div>
-                                            <label for="timer-duration" class="block text-sm font-medium text-gray-700 mb-1">持续时间 (秒)</label>
-                                            <input type="number" id="timer-duration" max="86400" value="0.3" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                        </div>
-                                        <div class="flex items-center">
-                                            <input type="checkbox" id="timer-repeat" checked class="h-4 w-4 text-indigo-600 border-gray-300 rounded focus:ring-indigo-500">
-                                            <label for="timer-repeat" class="ml-2 block text-sm text-gray-900">每天重复执行</label>
-                                        </div>
-                                        <div>
-                                            <label class="flex items-center space-x-2">
-                                                <input type="checkbox" id="timer-pwm-mode" onchange="toggleTimerPWMMode()" class="h-4 w-4 text-indigo-600 focus:ring-indigo-500 border-gray-300 rounded">
-                                                <span class="text-sm font-medium text-gray-700">PWM 模式</span>
-                                            </label>
-                                        </div>
-                                        <div id="timer-pwm-controls" class="hidden">
-                                            <label for="timer-pwm-value" class="block text-sm font-medium text-gray-700 mb-1">PWM 强度: <span id="timer-pwm-percentage">50%</span></label>
-                                            <input type="range" id="timer-pwm-value" min="0" max="1023" value="512" 
-                                                   oninput="updateTimerPWMPercentage(this.value)" 
-                                                   class="w-full h-2 bg-gray-200 rounded-lg appearance-none cursor-pointer">
-                                            <div class="flex justify-between text-xs text-gray-500 mt-1">
-                                                <span>0%</span>
-                                                <span>25%</span>
-                                                <span>50%</span>
-                                                <span>75%</span>
-                                                <span>100%</span>
-                                            </div>
-                                        </div>
-                                        <button class="w-full bg-indigo-600 text-white font-semibold py-2 px-4 rounded-md hover:bg-indigo-700 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-indigo-500 transition-colors" onclick="addTimer()">
-                                            🕐 添加定时器
-                                        </button>
-                                    </div>
-                                </div>
-                                <button class="w-full bg-red-50 text-red-700 font-semibold py-2 px-4 rounded-md hover:bg-red-100 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-red-500 transition-colors" onclick="clearAllTimers()">
-                                    清除所有定时器
-                                </button>
-                            </div>
-                            <div id="timer-list-container" class="lg:col-span-2">
-                                <h3 class="text-lg font-semibold mb-4 text-gray-800">现有定时器</h3>
-                                <div class="timer-list space-y-3 h-full overflow-y-auto pr-2" id="timer-list">
-                                    <div class="loading-placeholder text-center p-10 text-gray-500">加载中...</div>
-                                </div>
-                            </div>
-                        </div>
-                    </div>
-
-                    <!-- 手动控制 -->
-                    <div id="manual-content" class="tab-content hidden fade-in">
-                        <div class="grid grid-cols-1 md:grid-cols-2 gap-6">
-                            <div>
-                                <h3 class="text-lg font-semibold mb-4 text-gray-800">🔌 引脚快速控制</h3>
-                                <div id="pins-grid" class="grid grid-cols-3 sm:grid-cols-4 md:grid-cols-5 gap-3">
-                                    <div class="loading-placeholder text-center p-10 text-gray-500">加载中...</div>
-                                </div>
-                                <p class="text-xs text-gray-500 text-center mt-3">点击引脚卡片可快速切换状态</p>
-                            </div>
-                            <div class="p-5 border rounded-lg bg-gray-50 h-fit">
-                                <h3 class="text-lg font-semibold mb-4 text-gray-800">⚙️ 精确控制</h3>
-                                <div id="manual-message" class="hidden mb-4"></div>
-                                <div class="space-y-4">
-                                    <div>
-                                        <label for="manual-pin" class="block text-sm font-medium text-gray-700 mb-1">选择引脚</label>
-                                        <select id="manual-pin" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500"></select>
-                                    </div>
-                                    <div>
-                                        <label for="manual-duration" class="block text-sm font-medium text-gray-700 mb-1">持续时间 (0=切换)</label>
-                                        <input type="number" id="manual-duration"  max="86400" value="0" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                    </div>
-                                    <div>
-                                        <label class="flex items-center space-x-2">
-                                            <input type="checkbox" id="manual-pwm-mode" onchange="togglePWMMode()" class="h-4 w-4 text-indigo-600 focus:ring-indigo-500 border-gray-300 rounded">
-                                            <span class="text-sm font-medium text-gray-700">PWM 模式</span>
-                                        </label>
-                                    </div>
-                                    <div id="pwm-controls" class="hidden">
-                                        <label for="manual-pwm-value" class="block text-sm font-medium text-gray-700 mb-1">PWM 强度: <span id="pwm-percentage">50%</span></label>
-                                        <input type="range" id="manual-pwm-value" min="0" max="1023" value="512" 
-                                               oninput="updatePWMPercentage(this.value)" 
-                                               class="w-full h-2 bg-gray-200 rounded-lg appearance-none cursor-pointer">
-                                        <div class="flex justify-between text-xs text-gray-500 mt-1">
-                                            <span>0%</span>
-                                            <span>25%</span>
-                                            <span>50%</span>
-                                            <span>75%</span>
-                                            <span>100%</span>
-                                        </div>
-                                    </div>
-                                    <button class="w-full bg-indigo-600 text-white font-semibold py-2 px-4 rounded-md hover:bg-indigo-700 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-indigo-500 transition-colors" onclick="manualControl()">
-                                        🎛️ 执行控制
-                                    </button>
-                                </div>
-                            </div>
-                        </div>
-                    </div>
-
-                    <!-- 系统状态 -->
-                    <div id="system-content" class="tab-content hidden fade-in space-y-6">
-                        <div class="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">芯片 ID</label>
-                                <span id="chip-id" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">CPU 频率</label>
-                                <span id="cpu-freq" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">Flash 大小</label>
-                                <span id="flash-size" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">可用内存</label>
-                                <span id="free-heap" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">内存碎片化</label>
-                                <span id="heap-frag" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                            <div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                                <label class="block text-xs text-gray-500 font-medium mb-1">运行时间</label>
-                                <span id="uptime" class="text-base font-semibold text-gray-800">加载中...</span>
-                            </div>
-                        </div>
-                        
-                        <div>
-                            <h3 class="text-lg font-semibold mb-3 text-gray-800">📶 WiFi 详情</h3>
-                            <div id="wifi-details" class="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">加载中...</div>
-                        </div>
-                        <div>
-                            <h3 class="text-lg font-semibold mb-3 text-gray-800">🕐 时间信息</h3>
-                            <div id="time-details" class="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">加载中...</div>
-                        </div>
-                        <div>
-                            <h3 class="text-lg font-semibold mb-3 text-gray-800">⏰ 定时器统计</h3>
-                            <div id="timer-stats" class="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">加载中...</div>
-                        </div>
-                        <div>
-                            <h3 class="text-lg font-semibold mb-3 text-gray-800">💾 存储信息</h3>
-                            <div id="storage-details" class="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">加载中...</div>
-                        </div>
-                        <div>
-                            <h3 class="text-lg font-semibold mb-3 text-gray-800">🔌 引脚状态详情</h3>
-                            <div id="pin-details" class="grid grid-cols-3 sm:grid-cols-5 md:grid-cols-8 gap-3">加载中...</div>
-                        </div>
-                    </div>
-
-                    <!-- WiFi 设置 -->
-                    <div id="wifi-content" class="tab-content hidden fade-in">
-                        <div class="max-w-md mx-auto p-5 border rounded-lg bg-gray-50">
-                            <h3 class="text-lg font-semibold mb-4 text-gray-800">📶 WiFi 网络设置</h3>
-                            <div id="wifi-message" class="hidden mb-4"></div>
-                            <div class="space-y-4">
-                                <div>
-                                    <label for="wifi-ssid" class="block text-sm font-medium text-gray-700 mb-1">网络名称 (SSID)</label>
-                                    <input type="text" id="wifi-ssid" placeholder="输入 WiFi 网络名称" maxlength="31" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                </div>
-                                <div>
-                                    <label for="wifi-password" class="block text-sm font-medium text-gray-700 mb-1">网络密码</label>
-                                    <input type="password" id="wifi-password" placeholder="输入 WiFi 密码 (可选)" maxlength="63" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                </div>
-                                <div class="p-3 text-xs text-blue-800 rounded-lg bg-blue-50">
-                                    💡 提示：连接 WiFi 后才能使用定时器功能，因为需要网络时间同步。
-                                </div>
-                                <div class="grid grid-cols-1 sm:grid-cols-2 gap-3">
-                                    <button class="w-full bg-indigo-600 text-white font-semibold py-2 px-4 rounded-md hover:bg-indigo-700 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-indigo-500 transition-colors" onclick="saveWiFi()">
-                                        💾 保存并连接
-                                    </button>
-                                    <button class="w-full bg-amber-500 text-white font-semibold py-2 px-4 rounded-md hover:bg-amber-600 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-amber-500 transition-colors" onclick="restartAP()">
-                                        🔄 重启为热点
-                                    </button>
-                                </div>
-                            </div>
-                        </div>
-                    </div>
-
-                    <!-- 固件更新 -->
-                    <div id="firmware-content" class="tab-content hidden fade-in">
-                        <div class="max-w-md mx-auto p-5 border rounded-lg bg-gray-50">
-                            <h3 class="text-lg font-semibold mb-4 text-gray-800">🔧 固件更新</h3>
-                            <div id="firmware-message" class="hidden mb-4"></div>
-                            
-                            <div class="space-y-4">
-                                <div class="p-4 bg-blue-50 border border-blue-200 rounded-lg">
-                                    <h4 class="font-medium text-blue-800 mb-2">当前固件信息</h4>
-                                    <div class="text-sm text-blue-700">
-                                        <div>版本: <span id="current-version">加载中...</span></div>
-                                        <div>编译时间: <span id="build-time">加载中...</span></div>
-                                        <div>芯片ID: <span id="firmware-chip-id">加载中...</span></div>
-                                    </div>
-                                </div>
-                                
-                                <div>
-                                    <label for="firmware-file" class="block text-sm font-medium text-gray-700 mb-2">
-                                        📁 选择固件文件 (.bin)
-                                    </label>
-                                    <input type="file" id="firmware-file" accept=".bin" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                                    <div class="mt-2 text-xs text-gray-500">
-                                        支持的文件格式: .bin (最大 2MB)
-                                    </div>
-                                </div>
-                                
-                                <div class="p-3 text-xs text-yellow-800 rounded-lg bg-yellow-50 border border-yellow-200">
-                                    ⚠️ 警告：固件更新可能需要 2-5 分钟，期间请勿断电或关闭浏览器。更新完成后设备将自动重启。
-                                </div>
-                                
-                                <div class="space-y-2">
-                                    <button id="upload-btn" class="w-full bg-red-600 text-white font-semibold py-3 px-4 rounded-md hover:bg-red-700 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-red-500 transition-colors disabled:opacity-50 disabled:cursor-not-allowed" onclick="startFirmwareUpdate()" disabled>
-                                        🚀 开始固件更新
-                                    </button>
-                                    
-                                    <div id="upload-progress" class="hidden">
-                                        <div class="w-full bg-gray-200 rounded-full h-3">
-                                            <div id="progress-bar" class="bg-blue-600 h-3 rounded-full transition-all duration-300" style="width: 0%"></div>
-                                        </div>
-                                        <div class="text-sm text-gray-600 text-center mt-2">
-                                            <span id="progress-text">准备中...</span>
-                                        </div>
-                                    </div>
-                                </div>
-                                
-                                <div class="border-t pt-4">
-                                    <h4 class="font-medium text-gray-800 mb-2">更新说明</h4>
-                                    <ul class="text-sm text-gray-600 space-y-1">
-                                        <li>• 确保设备连接稳定的电源</li>
-                                        <li>• 选择正确的固件文件(.bin格式)</li>
-                                        <li>• 更新过程中请勿断电</li>
-                                        <li>• 更新完成后设备会自动重启</li>
-                                        <li>• 如遇问题可重启设备恢复</li>
-                                    </ul>
-                                </div>
-                            </div>
-                        </div>
-                    </div>
-                </div>
-            </div>
-        </main>
-    </div>
-
-    <!-- 编辑定时器模态弹窗 -->
-    <div id="edit-timer-modal" class="fixed inset-0 bg-gray-600 bg-opacity-50 hidden flex items-center justify-center z-50">
-        <div class="bg-white rounded-lg p-6 max-w-md w-full mx-4 max-h-screen overflow-y-auto">
-            <div class="flex justify-between items-center mb-4">
-                <h3 class="text-lg font-semibold text-gray-800">✏️ 编辑定时器</h3>
-                <button onclick="closeEditModal()" class="text-gray-400 hover:text-gray-600">
-                    <svg class="w-6 h-6" fill="none" stroke="currentColor" viewBox="0 0 24 24">
-                        <path stroke-linecap="round" stroke-linejoin="round" stroke-width="2" d="M6 18L18 6M6 6l12 12"></path>
-                    </svg>
-                </button>
-            </div>
-            <div id="edit-timer-message" class="hidden mb-4"></div>
-            <div class="space-y-4">
-                <div>
-                    <label for="edit-timer-pin" class="block text-sm font-medium text-gray-700 mb-1">选择引脚</label>
-                    <select id="edit-timer-pin" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500"></select>
-                </div>
-                <div>
-                    <label for="edit-timer-time" class="block text-sm font-medium text-gray-700 mb-1">执行时间</label>
-                    <input type="time" id="edit-timer-time" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                </div>
-                <div>
-                    <label for="edit-timer-duration" class="block text-sm font-medium text-gray-700 mb-1">持续时间 (秒)</label>
-                    <input type="number" id="edit-timer-duration" max="86400" value="0.3" class="w-full p-2 border border-gray-300 rounded-md shadow-sm focus:ring-indigo-500 focus:border-indigo-500">
-                </div>
-                <div class="flex items-center">
-                    <input type="checkbox" id="edit-timer-repeat" checked class="h-4 w-4 text-indigo-600 border-gray-300 rounded focus:ring-indigo-500">
-                    <label for="edit-timer-repeat" class="ml-2 block text-sm text-gray-900">每天重复执行</label>
-                </div>
-                <div>
-                    <label class="flex items-center space-x-2">
-                        <input type="checkbox" id="edit-timer-pwm-mode" onchange="toggleEditTimerPWMMode()" class="h-4 w-4 text-indigo-600 focus:ring-indigo-500 border-gray-300 rounded">
-                        <span class="text-sm font-medium text-gray-700">PWM 模式</span>
-                    </label>
-                </div>
-                <div id="edit-timer-pwm-controls" class="hidden">
-                    <label for="edit-timer-pwm-value" class="block text-sm font-medium text-gray-700 mb-1">PWM 强度: <span id="edit-timer-pwm-percentage">50%</span></label>
-                    <input type="range" id="edit-timer-pwm-value" min="0" max="1023" value="512" 
-                           oninput="updateEditTimerPWMPercentage(this.value)" 
-                           class="w-full h-2 bg-gray-200 rounded-lg appearance-none cursor-pointer">
-                    <div class="flex justify-between text-xs text-gray-500 mt-1">
-                        <span>0%</span>
-                        <span>25%</span>
-                        <span>50%</span>
-                        <span>75%</span>
-                        <span>100%</span>
-                    </div>
-                </div>
-                <div class="flex space-x-3 pt-4">
-                    <button class="flex-1 bg-indigo-600 text-white font-semibold py-2 px-4 rounded-md hover:bg-indigo-700 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-indigo-500 transition-colors" onclick="saveTimerEdit()">
-                        💾 保存修改
-                    </button>
-                    <button class="flex-1 bg-gray-300 text-gray-700 font-semibold py-2 px-4 rounded-md hover:bg-gray-400 focus:outline-none focus:ring-2 focus:ring-offset-2 focus:ring-gray-500 transition-colors" onclick="closeEditModal()">
-                        ❌ 取消
-                    </button>
-                </div>
-            </div>
-        </div>
-    </div>
-
-    <script>
-        let currentData = {
-            timers: [],
-            pins: [],
-            systemInfo: null
-        };
-
-        let isLoadingData = false;
-
-        // --- Class definitions for styling ---
-        const activeTabClasses = ['active', 'text-indigo-600', 'font-semibold'];
-        const inactiveTabClasses = ['text-gray-500', 'hover:text-gray-700'];
-        const baseTabClasses = ['py-3', 'px-4', 'text-sm', 'font-medium', 'text-center', 'border-b-2', 'border-transparent', 'transition-colors', 'whitespace-nowrap'];
-
-        document.addEventListener('DOMContentLoaded', function() {
-            // Initialize tabs with base classes
-            document.querySelectorAll('.tab').forEach(tab => {
-                tab.classList.add(...baseTabClasses);
-                if (!tab.classList.contains('active')) {
-                    tab.classList.add(...inactiveTabClasses);
-                }
-            });
-            
-            // Set current time as default for timer
-            setCurrentTimeAsDefault();
-            
-            loadData();
-            // 使用异步轮询替代 setInterval
-            startPolling();
-        });
-
-        function setCurrentTimeAsDefault() {
-            const now = new Date();
-            const hours = String(now.getHours()).padStart(2, '0');
-            const minutes = String(now.getMinutes()).padStart(2, '0');
-            const currentTime = `${hours}:${minutes}`;
-            document.getElementById('timer-time').value = currentTime;
-        }
-
-        function startPolling() {
-            async function poll() {
-                if (!isLoadingData) {
-                    await loadData();
-                }
-                // 等待5秒后再次轮询
-                setTimeout(poll, 5000);
-            }
-            poll();
-        }
-
-        function switchTab(tabName, clickedTab) {
-            document.querySelectorAll('.tab-content').forEach(content => content.classList.add('hidden'));
-            document.querySelectorAll('.tab').forEach(tab => {
-                tab.classList.remove(...activeTabClasses, 'active');
-                tab.classList.add(...inactiveTabClasses);
-            });
-            
-            document.getElementById(tabName + '-content').classList.remove('hidden');
-            clickedTab.classList.add(...activeTabClasses);
-            clickedTab.classList.remove(...inactiveTabClasses);
-            
-            if (tabName === 'system') {
-                loadSystemInfo();
-            }
-        }
-
-        async function loadData() {
-            if (isLoadingData) {
-                return; // 如果正在加载，直接返回
-            }
-            
-            isLoadingData = true;
-            try {
-                const [statusRes, timersRes, pinsRes] = await Promise.all([
-                    fetch('/api/status'),
-                    fetch('/api/timers'),
-                    fetch('/api/pins')
-                ]);
-                const status = await statusRes.json();
-                const timers = await timersRes.json();
-                const pins = await pinsRes.json();
-
-                currentData.timers = timers;
-                currentData.pins = pins;
-
-                updateStatus(status);
-                updateTimersList();
-                updatePinsList();
-                updatePinSelects();
-
-                if (document.getElementById('system-content').offsetParent !== null) {
-                    await loadSystemInfo();
-                }
-            } catch (error) {
-                console.error('加载数据失败:', error);
-                document.getElementById('connection-status').innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-red-100 text-red-800">加载失败</span>`;
-            } finally {
-                isLoadingData = false;
-            }
-        }
-
-        async function loadSystemInfo() {
-            try {
-                const response = await fetch('/api/system');
-                const systemInfo = await response.json();
-                currentData.systemInfo = systemInfo;
-                updateSystemInfo(systemInfo);
-            } catch (error) {
-                console.error('加载系统信息失败:', error);
-            }
-        }
-
-        function updateStatus(status) {
-            const statusElement = document.getElementById('connection-status');
-            const apNotice = document.getElementById('ap-mode-notice');
-            const timerRelated = ['timer-form', 'timer-list-container'];
-
-            if (status.wifiConnected) {
-                statusElement.innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-green-100 text-green-800">✅ WiFi: ${status.localIP}</span>`;
-                apNotice.classList.add('hidden');
-                timerRelated.forEach(id => document.getElementById(id).style.opacity = 1);
-            } else {
-                statusElement.innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-yellow-100 text-yellow-800">📶 AP: ${status.apIP}</span>`;
-                apNotice.classList.remove('hidden');
-                timerRelated.forEach(id => document.getElementById(id).style.opacity = 0.5);
-            }
-            
-            const timeInfo = status.hasValidTime ? `🕐 ${status.currentTime}` : `🕐 时间未同步`;
-            document.getElementById('device-info').innerHTML = `${timeInfo} | 活跃定时器: ${status.activeTimers || 0}`;
-        }
-
-        function updateTimersList() {
-            const list = document.getElementById('timer-list');
-            if (currentData.timers.length === 0) {
-                list.innerHTML = '<div class="text-center p-10 text-gray-500">暂无定时器</div>';
-                return;
-            }
-            list.innerHTML = currentData.timers.map((timer, index) => {
-                const statusText = timer.isActive ? '🔴 运行中' : (timer.enabled ? '⏰ 等待中' : '⏸️ 已禁用');
-                const statusColor = timer.isActive ? 'text-red-600' : (timer.enabled ? 'text-blue-600' : 'text-gray-500');
-                const cardBorder = timer.isActive ? 'border-red-300' : (timer.enabled ? 'border-blue-300' : 'border-gray-200');
-                
-                return `
-                <div class="border ${cardBorder} rounded-lg p-4 flex flex-col sm:flex-row justify-between items-start sm:items-center transition-all hover:shadow-md hover:border-indigo-300 ${!timer.enabled ? 'opacity-60' : ''}">
-                    <div class="grid grid-cols-2 sm:grid-cols-3 md:grid-cols-6 gap-x-4 gap-y-2 text-sm w-full">
-                        <div class="font-bold text-gray-800 col-span-2 sm:col-span-1">📌 引脚 ${timer.pin}</div>
-                        <div class="flex items-center">⏰ ${timer.hour.toString().padStart(2, '0')}:${timer.minute.toString().padStart(2, '0')}</div>
-                        <div class="flex items-center">⏳ ${timer.duration}秒</div>
-                        <div class="flex items-center">${timer.repeatDaily ? '🔄 每天' : '📅 单次'}</div>
-                        <div class="flex items-center">${timer.isPWM ? `🔧 PWM ${Math.round((timer.pwmValue / 1023) * 100)}%` : '🔌 数字'}</div>
-                        <div class="flex items-center font-semibold ${statusColor}">${statusText}</div>
-                    </div>
-                    <div class="flex space-x-2 mt-3 sm:mt-0 sm:ml-4 flex-shrink-0">
-                        <div class="relative">
-                            <button id="timer-menu-${index}" class="text-xs font-semibold py-1 px-3 rounded-md bg-gray-100 text-gray-700 hover:bg-gray-200 transition-colors" onclick="toggleTimerMenu(${index})">
-                                ⚙️ 操作
-                            </button>
-                            <div id="timer-dropdown-${index}" class="absolute right-0 mt-1 w-32 bg-white rounded-md shadow-lg border border-gray-200 z-10 hidden">
-                                <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 ${timer.enabled ? 'text-amber-800' : 'text-green-800'}" onclick="toggleTimer(${index}); hideTimerMenu(${index})">${timer.enabled ? '🚫 禁用' : '✅ 启用'}</button>
-                                <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 text-blue-800" onclick="editTimer(${index}); hideTimerMenu(${index})">✏️ 修改</button>
-                                <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 text-red-800" onclick="deleteTimer(${index}); hideTimerMenu(${index})">🗑️ 删除</button>
-                            </div>
-                        </div>
-                    </div>
-                </div>`;
-            }).join('');
-        }
-
-        function updatePinsList() {
-            const grid = document.getElementById('pins-grid');
-            if (currentData.pins.length === 0) {
-                grid.innerHTML = '<p class="text-gray-500 col-span-full">没有可用的引脚</p>';
-                return;
-            }
-            grid.innerHTML = currentData.pins.map(pin => {
-                let stateClass = 'bg-white hover:bg-gray-100';
-                if (pin.inUse) stateClass = 'bg-yellow-100 text-yellow-800 border-yellow-300';
-                else if (pin.state) stateClass = 'bg-red-100 text-red-800 border-red-300';
-                
-                return `
-                <div class="border-2 rounded-lg p-3 text-center cursor-pointer transition-all ${stateClass}" onclick="togglePin(${pin.pin})" title="点击切换状态">
-                    <div class="font-bold text-lg">${pin.pin}</div>
-                    <div class="text-2xl">${pin.state ? '🔴' : '⚫'}</div>
-                    ${pin.inUse ? '<div class="text-xs font-semibold">占用</div>' : '<div class="text-xs text-gray-400">空闲</div>'}
-                </div>`;
-            }).join('');
-        }
-
-        function updatePinSelects() {
-            const selects = ['timer-pin', 'manual-pin'];
-            const options = currentData.pins.map(pin => `<option value="${pin.pin}">引脚 ${pin.pin}</option>`).join('');
-            selects.forEach(id => {
-                const select = document.getElementById(id);
-                const currentValue = select.value;
-                select.innerHTML = `<option value="">选择引脚</option>${options}`;
-                if (currentValue) select.value = currentValue;
-            });
-        }
-
-        function updateSystemInfo(info) {
-            document.getElementById('chip-id').textContent = info.chipId || '未知';
-            document.getElementById('cpu-freq').textContent = `${info.cpuFreqMHz || 0} MHz`;
-            document.getElementById('flash-size').textContent = formatBytes(info.flashChipSize || 0);
-            document.getElementById('free-heap').textContent = formatBytes(info.freeHeap || 0);
-            document.getElementById('heap-frag').textContent = `${info.heapFragmentation || 0}%`;
-            document.getElementById('uptime').textContent = `${info.uptimeDays || 0}天 ${info.uptimeHours || 0}:${String(info.uptimeMinutes || 0).padStart(2, '0')}:${String(info.uptimeSeconds || 0).padStart(2, '0')}`;
-            
-            updateWiFiDetails(info.wifi || {});
-            updateTimeDetails(info.time || {});
-            updateTimerStats(info.timerStats || {});
-            updateStorageDetails(info);
-            updatePinDetails(info.pins || []);
-        }
-
-        function createInfoCard(label, value) {
-            return `<div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
-                        <label class="block text-xs text-gray-500 font-medium mb-1">${label}</label>
-                        <span class="text-base font-semibold text-gray-800">${value}</span>
-                    </div>`;
-        }
-
-        function updateWiFiDetails(wifi) {
-            const container = document.getElementById('wifi-details');
-            let html = createInfoCard('连接状态', `<span class="inline-block w-2 h-2 rounded-full mr-2 ${wifi.status === 3 ? 'bg-green-500' : 'bg-red-500'}"></span>${wifi.statusText || '未知'}`)
-                     + createInfoCard('工作模式', wifi.modeText || '未知');
-            if (wifi.ssid) {
-                html += createInfoCard('网络名称', wifi.ssid)
-                      + createInfoCard('信号强度', `${wifi.rssi} dBm`)
-                      + createInfoCard('本地 IP', wifi.localIP)
-                      + createInfoCard('MAC 地址', wifi.macAddress);
-            }
-            if (wifi.apSSID) {
-                html += createInfoCard('AP 名称', wifi.apSSID)
-                      + createInfoCard('AP IP', wifi.apIP)
-                      + createInfoCard('连接设备数', wifi.apStationCount || 0);
-            }
-            container.innerHTML = html;
-        }
-
-        function updateTimeDetails(time) {
-            document.getElementById('time-details').innerHTML = 
-                createInfoCard('同步状态', `<span class="inline-block w-2 h-2 rounded-full mr-2 ${time.hasValidTime ? 'bg-green-500' : 'bg-yellow-500'}"></span>${time.hasValidTime ? '已同步' : '未同步'}`)
-              + createInfoCard('时间源', time.timeSource || '未知')
-              + createInfoCard('当前时间', time.currentTime || '未知')
-              + createInfoCard('当前日期', time.currentDate || '未知');
-        }
-
-        function updateTimerStats(stats) {
-            const usage = Math.round((stats.total || 0) / (stats.maxTimers || 1) * 100);
-            document.getElementById('timer-stats').innerHTML = 
-                createInfoCard('总数', `${stats.total || 0} / ${stats.maxTimers || 0}`)
-              + createInfoCard('使用率', `${usage}%`)
-              + createInfoCard('已启用', stats.enabled || 0)
-              + createInfoCard('运行中', stats.active || 0);
-        }
-
-        function updateStorageDetails(info) {
-            const eeprom = info.eeprom || {};
-            const eepromUsage = Math.round((eeprom.timerConfigUsed || 0) / (eeprom.size || 1) * 100);
-            document.getElementById('storage-details').innerHTML = 
-                createInfoCard('程序大小', formatBytes(info.sketchSize || 0))
-              + createInfoCard('可用空间', formatBytes(info.freeSketchSpace || 0))
-              + createInfoCard('EEPROM大小', `${eeprom.size || 0} 字节`)
-              + createInfoCard('配置已用', `${eeprom.timerConfigUsed || 0} 字节 (${eepromUsage}%)`)
-              + createInfoCard('重启原因', info.resetReason || '未知');
-        }
-
-        function updatePinDetails(pins) {
-            document.getElementById('pin-details').innerHTML = pins.map(pin => {
-                let stateClass = 'bg-gray-100 border-gray-200';
-                if (pin.inUse) stateClass = 'bg-yellow-100 border-yellow-300';
-                else if (pin.state) stateClass = 'bg-red-100 border-red-300';
-                return `<div class="p-2 text-center rounded-md border ${stateClass}">
-                            <div class="font-bold text-sm">${pin.pin}</div>
-                            <div class="text-xs">${pin.inUse ? `🔒 #${pin.timerIndex}` : (pin.state ? 'ON' : 'OFF')}</div>
-                        </div>`;
-            }).join('');
-        }
-
-        function formatBytes(bytes) {
-            if (bytes === 0) return '0 B';
-            const k = 1024;
-            const sizes = ['B', 'KB', 'MB', 'GB'];
-            const i = Math.floor(Math.log(bytes) / Math.log(k));
-            return `${parseFloat((bytes / Math.pow(k, i)).toFixed(2))} ${sizes[i]}`;
-        }
-
-        async function addTimer() {
-            const pin = document.getElementById('timer-pin').value;
-            const timeValue = document.getElementById('timer-time').value;
-            const duration = document.getElementById('timer-duration').value;
-            const repeatDaily = document.getElementById('timer-repeat').checked;
-            const isPWM = document.getElementById('timer-pwm-mode').checked;
-            const pwmValue = document.getElementById('timer-pwm-value').value;
-            
-            if (!pin || !timeValue || !duration) {
-                showMessage('timer-message', '请填写完整信息', 'error');
-                return;
-            }
-            
-            const [hour, minute] = timeValue.split(':').map(Number);
-            
-            try {
-                const body = { 
-                    pin: parseInt(pin), 
-                    hour, 
-                    minute, 
-                    duration: parseFloat(duration), 
-                    repeatDaily,
-                    isPWM: isPWM,
-                    pwmValue: parseInt(pwmValue)
-                };
-                
-                const response = await fetch('/api/timers', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify(body)
-                });
-                const result = await response.json();
-                if (result.success) {
-                    showMessage('timer-message', '定时器添加成功！', 'success');
-                    loadData();
-                } else {
-                    showMessage('timer-message', result.message || '添加失败', 'error');
-                }
-            } catch (error) {
-                showMessage('timer-message', '请求失败', 'error');
-            }
-        }
-
-        async function deleteTimer(index) {
-            if (!confirm('确定要删除这个定时器吗？')) return;
-            try {
-                const response = await fetch(`/api/timers/${index}`, {method: 'DELETE'});
-                if (response.ok) loadData();
-                else alert('删除失败');
-            } catch (error) {
-                alert('请求失败');
-            }
-        }
-
-        async function toggleTimer(index) {
-            const timer = currentData.timers[index];
-            try {
-                const response = await fetch(`/api/timers/${index}`, {
-                    method: 'PUT',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify({ ...timer, enabled: !timer.enabled })
-                });
-                if (response.ok) loadData();
-                else alert('操作失败');
-            } catch (error) {
-                alert('请求失败');
-            }
-        }
-
-        async function clearAllTimers() {
-            if (!confirm('确定要清除所有定时器吗？此操作不可恢复！')) return;
-            try {
-                const response = await fetch('/api/timers/clear', {method: 'POST'});
-                if (response.ok) {
-                    showMessage('timer-message', '所有定时器已清除', 'success');
-                    loadData();
-                } else {
-                    showMessage('timer-message', '清除失败', 'error');
-                }
-            } catch (error) {
-                showMessage('timer-message', '请求失败', 'error');
-            }
-        }
-
-        async function manualControl() {
-            const pin = document.getElementById('manual-pin').value;
-            const duration = document.getElementById('manual-duration').value;
-            const isPWM = document.getElementById('manual-pwm-mode').checked;
-            const pwmValue = document.getElementById('manual-pwm-value').value;
-            
-            if (!pin) {
-                showMessage('manual-message', '请选择引脚', 'error');
-                return;
-            }
-            try {
-                const body = { 
-                    pin: parseInt(pin), 
-                    duration: parseFloat(duration) || 0,
-                    isPWM: isPWM,
-                    pwmValue: parseInt(pwmValue)
-                };
-                
-                const response = await fetch('/api/manual', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify(body)
-                });
-                const result = await response.json();
-                if (result.success) {
-                    showMessage('manual-message', '控制命令执行成功', 'success');
-                    loadData();
-                } else {
-                    showMessage('manual-message', `控制失败: ${result.message || '未知错误'}`, 'error');
-                }
-            } catch (error) {
-                showMessage('manual-message', '请求失败', 'error');
-            }
-        }
-
-        async function togglePin(pin) {
-            try {
-                const response = await fetch('/api/manual', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify({
-                        pin: pin, 
-                        duration: 0,
-                        isPWM: false,
-                        pwmValue: 0
-                    })
-                });
-                if (response.ok) {
-                    loadData();
-                }
-            } catch (error) {
-                console.error('引脚切换失败:', error);
-            }
-        }
-
-        async function saveWiFi() {
-            const ssid = document.getElementById('wifi-ssid').value;
-            const password = document.getElementById('wifi-password').value;
-            if (!ssid) {
-                showMessage('wifi-message', '请输入 WiFi 名称', 'error');
-                return;
-            }
-            showMessage('wifi-message', '正在保存设置...', 'info');
-            try {
-                const response = await fetch('/api/wifi', {
-                    method: 'POST',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify({ssid, password})
-                });
-                const result = await response.json();
-                if (result.success) {
-                    showMessage('wifi-message', 'WiFi 设置已保存，设备将重启并尝试连接...', 'success');
-                    setTimeout(() => window.location.reload(), 3000);
-                } else {
-                    showMessage('wifi-message', `设置失败: ${result.message || '未知错误'}`, 'error');
-                }
-            } catch (error) {
-                showMessage('wifi-message', '请求失败', 'error');
-            }
-        }
-
-        async function restartAP() {
-            if (!confirm('确定要重启为 AP 模式吗？设备将断开当前 WiFi 连接。')) return;
-            showMessage('wifi-message', '正在重启...', 'info');
-            try {
-                const response = await fetch('/api/wifi/reset', {method: 'POST'});
-                if (response.ok) {
-                    showMessage('wifi-message', '设备将重启为 AP 模式...', 'success');
-                    setTimeout(() => window.location.reload(), 3000);
-                }
-            } catch (error) {
-                showMessage('wifi-message', '请求失败', 'error');
-            }
-        }
-
-        function togglePWMMode() {
-            const pwmControls = document.getElementById('pwm-controls');
-            const isPWMMode = document.getElementById('manual-pwm-mode').checked;
-            
-            if (isPWMMode) {
-                pwmControls.classList.remove('hidden');
-            } else {
-                pwmControls.classList.add('hidden');
-            }
-        }
-
-        function updatePWMPercentage(value) {
-            const percentage = Math.round((value / 1023) * 100);
-            document.getElementById('pwm-percentage').textContent = percentage + '%';
-        }
-
-        function toggleTimerPWMMode() {
-            const pwmControls = document.getElementById('timer-pwm-controls');
-            const isPWMMode = document.getElementById('timer-pwm-mode').checked;
-            
-            if (isPWMMode) {
-                pwmControls.classList.remove('hidden');
-            } else {
-                pwmControls.classList.add('hidden');
-            }
-        }
-
-        function updateTimerPWMPercentage(value) {
-            const percentage = Math.round((value / 1023) * 100);
-            document.getElementById('timer-pwm-percentage').textContent = percentage + '%';
-        }
-
-        // 固件更新相关函数
-        document.addEventListener('DOMContentLoaded', function() {
-            const fileInput = document.getElementById('firmware-file');
-            const uploadBtn = document.getElementById('upload-btn');
-            
-            if (fileInput && uploadBtn) {
-                fileInput.addEventListener('change', function() {
-                    const file = this.files[0];
-                    if (file) {
-                        if (file.size > 2 * 1024 * 1024) { // 2MB限制
-                            showMessage('firmware-message', '文件大小不能超过 2MB', 'error');
-                            this.value = '';
-                            uploadBtn.disabled = true;
-                            return;
-                        }
-                        if (!file.name.toLowerCase().endsWith('.bin')) {
-                            showMessage('firmware-message', '请选择 .bin 格式的固件文件', 'error');
-                            this.value = '';
-                            uploadBtn.disabled = true;
-                            return;
-                        }
-                        uploadBtn.disabled = false;
-                        showMessage('firmware-message', `已选择文件: ${file.name} (${(file.size / 1024).toFixed(1)} KB)`, 'info');
-                    } else {
-                        uploadBtn.disabled = true;
-                    }
-                });
-            }
-            
-            // 加载当前固件信息
-            loadFirmwareInfo();
-        });
-
-        async function loadFirmwareInfo() {
-            try {
-                const response = await fetch('/api/system');
-                if (response.ok) {
-                    const data = await response.json();
-                    document.getElementById('current-version').textContent = data.firmwareVersion || 'v1.0.0';
-                    document.getElementById('build-time').textContent = data.buildDateTime || '未知';
-                    document.getElementById('firmware-chip-id').textContent = data.chipId || '未知';
-                }
-            } catch (error) {
-                console.error('加载固件信息失败:', error);
-            }
-        }
-
-        async function startFirmwareUpdate() {
-            const fileInput = document.getElementById('firmware-file');
-            const file = fileInput.files[0];
-            
-            if (!file) {
-                showMessage('firmware-message', '请先选择固件文件', 'error');
-                return;
-            }
-            
-            if (!confirm('确定要更新固件吗？更新过程中请勿断电，设备将自动重启。')) {
-                return;
-            }
-            
-            const uploadBtn = document.getElementById('upload-btn');
-            const progressDiv = document.getElementById('upload-progress');
-            const progressBar = document.getElementById('progress-bar');
-            const progressText = document.getElementById('progress-text');
-            
-            // 禁用上传按钮并显示进度条
-            uploadBtn.disabled = true;
-            progressDiv.classList.remove('hidden');
-            progressBar.style.width = '0%';
-            progressText.textContent = '正在上传固件...';
-            
-            const formData = new FormData();
-            formData.append('firmware', file);
-            
-            console.log('开始上传固件文件:', file.name, file.size, 'bytes');
-            
-            try {
-                const xhr = new XMLHttpRequest();
-                
-                // 监听上传进度
-                xhr.upload.onprogress = function(e) {
-                    if (e.lengthComputable) {
-                        const percentComplete = Math.round((e.loaded / e.total) * 100);
-                        progressBar.style.width = percentComplete + '%';
-                        progressText.textContent = `上传中... ${percentComplete}%`;
-                    }
-                };
-                
-                // 监听状态变化
-                xhr.onreadystatechange = function() {
-                    if (xhr.readyState === XMLHttpRequest.DONE) {
-                        if (xhr.status === 200) {
-                            progressBar.style.width = '100%';
-                            progressText.textContent = '上传完成，正在刷写固件...';
-                            showMessage('firmware-message', '固件上传成功，正在更新...请等待设备重启', 'success');
-                            
-                            // 模拟刷写进度
-                            setTimeout(() => {
-                                progressText.textContent = '固件更新中，请稍候...';
-                            }, 1000);
-                            
-                            setTimeout(() => {
-                                progressText.textContent = '更新完成，设备即将重启...';
-                                showMessage('firmware-message', '固件更新完成！设备将在几秒钟后重启', 'success');
-                            }, 3000);
-                            
-                            setTimeout(() => {
-                                window.location.reload();
-                            }, 8000);
-                        } else {
-                            console.error('上传失败，状态码:', xhr.status);
-                            let errorMessage = '未知错误';
-                            try {
-                                const response = JSON.parse(xhr.responseText);
-                                errorMessage = response.message || errorMessage;
-                            } catch (e) {
-                                errorMessage = `服务器错误 (${xhr.status})`;
-                            }
-                            showMessage('firmware-message', `更新失败: ${errorMessage}`, 'error');
-                            resetUploadUI();
-                        }
-                    }
-                };
-                
-                xhr.onerror = function() {
-                    console.error('网络错误或请求失败');
-                    showMessage('firmware-message', '上传失败，请检查网络连接', 'error');
-                    resetUploadUI();
-                };
-                
-                xhr.onabort = function() {
-                    console.error('上传被中止');
-                    showMessage('firmware-message', '上传被中止', 'error');
-                    resetUploadUI();
-                };
-                
-                xhr.open('POST', '/api/firmware/update', true);
-                console.log('发送固件上传请求到:', '/api/firmware/update');
-                xhr.send(formData);
-                
-            } catch (error) {
-                console.error('固件更新失败:', error);
-                showMessage('firmware-message', '更新失败: ' + error.message, 'error');
-                resetUploadUI();
-            }
-        }
-
-        function resetUploadUI() {
-            const uploadBtn = document.getElementById('upload-btn');
-            const progressDiv = document.getElementById('upload-progress');
-            const fileInput = document.getElementById('firmware-file');
-            
-            uploadBtn.disabled = false;
-            progressDiv.classList.add('hidden');
-            fileInput.value = '';
-        }
-
-        let currentEditingTimerIndex = -1;
-
-        // 定时器菜单控制函数
-        function toggleTimerMenu(index) {
-            // 关闭其他菜单
-            document.querySelectorAll('[id^="timer-dropdown-"]').forEach(dropdown => {
-                if (dropdown.id !== `timer-dropdown-${index}`) {
-                    dropdown.classList.add('hidden');
-                }
-            });
-            
-            const dropdown = document.getElementById(`timer-dropdown-${index}`);
-            dropdown.classList.toggle('hidden');
-        }
-
-        function hideTimerMenu(index) {
-            document.getElementById(`timer-dropdown-${index}`).classList.add('hidden');
-        }
-
-        // 点击页面其他地方关闭菜单
-        document.addEventListener('click', function(event) {
-            if (!event.target.closest('[id^="timer-menu-"]')) {
-                document.querySelectorAll('[id^="timer-dropdown-"]').forEach(dropdown => {
-                    dropdown.classList.add('hidden');
-                });
-            }
-        });
-
-        // 编辑定时器功能
-        function editTimer(index) {
-            currentEditingTimerIndex = index;
-            const timer = currentData.timers[index];
-            
-            // 填充表单数据
-            updateEditPinSelect();
-            document.getElementById('edit-timer-pin').value = timer.pin;
-            document.getElementById('edit-timer-time').value = `${timer.hour.toString().padStart(2, '0')}:${timer.minute.toString().padStart(2, '0')}`;
-            document.getElementById('edit-timer-duration').value = timer.duration;
-            document.getElementById('edit-timer-repeat').checked = timer.repeatDaily;
-            document.getElementById('edit-timer-pwm-mode').checked = timer.isPWM || false;
-            document.getElementById('edit-timer-pwm-value').value = timer.pwmValue || 512;
-            
-            // 更新PWM显示
-            toggleEditTimerPWMMode();
-            updateEditTimerPWMPercentage(timer.pwmValue || 512);
-            
-            // 显示模态弹窗
-            document.getElementById('edit-timer-modal').classList.remove('hidden');
-        }
-
-        function closeEditModal() {
-            document.getElementById('edit-timer-modal').classList.add('hidden');
-            currentEditingTimerIndex = -1;
-            document.getElementById('edit-timer-message').classList.add('hidden');
-        }
-
-        function updateEditPinSelect() {
-            const select = document.getElementById('edit-timer-pin');
-            select.innerHTML = '<option value="">选择引脚</option>' +
-                currentData.pins.map(pin => `<option value="${pin.pin}">引脚 ${pin.pin}</option>`).join('');
-        }
-
-        async function saveTimerEdit() {
-            if (currentEditingTimerIndex === -1) return;
-            
-            const pin = document.getElementById('edit-timer-pin').value;
-            const timeValue = document.getElementById('edit-timer-time').value;
-            const duration = document.getElementById('edit-timer-duration').value;
-            const repeatDaily = document.getElementById('edit-timer-repeat').checked;
-            const isPWM = document.getElementById('edit-timer-pwm-mode').checked;
-            const pwmValue = document.getElementById('edit-timer-pwm-value').value;
-            
-            if (!pin || !timeValue || !duration) {
-                showMessage('edit-timer-message', '请填写完整信息', 'error');
-                return;
-            }
-            
-            const [hour, minute] = timeValue.split(':').map(Number);
-            
-            try {
-                const body = { 
-                    pin: parseInt(pin), 
-                    hour, 
-                    minute, 
-                    duration: parseFloat(duration), 
-                    repeatDaily,
-                    isPWM: isPWM,
-                    pwmValue: parseInt(pwmValue)
-                };
-                
-                const response = await fetch(`/api/timers/${currentEditingTimerIndex}`, {
-                    method: 'PUT',
-                    headers: {'Content-Type': 'application/json'},
-                    body: JSON.stringify(body)
-                });
-                const result = await response.json();
-                if (result.success) {
-                    showMessage('edit-timer-message', '定时器修改成功！', 'success');
-                    setTimeout(() => {
-                        closeEditModal();
-                        loadData();
-                    }, 1000);
-                } else {
-                    showMessage('edit-timer-message', result.message || '修改失败', 'error');
-                }
-            } catch (error) {
-                showMessage('edit-timer-message', '请求失败', 'error');
-            }
-        }
-
-        function toggleEditTimerPWMMode() {
-            const pwmControls = document.getElementById('edit-timer-pwm-controls');
-            const isPWMMode = document.getElementById('edit-timer-pwm-mode').checked;
-            
-            if (isPWMMode) {
-                pwmControls.classList.remove('hidden');
-            } else {
-                pwmControls.classList.add('hidden');
-            }
-        }
-
-        function updateEditTimerPWMPercentage(value) {
-            const percentage = Math.round((value / 1023) * 100);
-            document.getElementById('edit-timer-pwm-percentage').textContent = percentage + '%';
-        }
-
-        function showMessage(elementId, message, type) {
-            const el = document.getElementById(elementId);
-            el.textContent = message;
-            const typeClasses = {
-                success: 'bg-green-50 text-green-800 border-green-200',
-                error: 'bg-red-50 text-red-800 border-red-200',
-                info: 'bg-blue-50 text-blue-800 border-blue-200'
-            };
-            el.className = `p-3 mb-4 text-sm rounded-lg border ${typeClasses[type] || typeClasses.info}`;
-            el.classList.remove('hidden');
-            setTimeout(() => el.classList.add('hidden'), 5000);
-        }
-    </script>
-</body>
-</html>
-)rawliteral";
+// 由 tools/build_web.py 根据 web/ 目录生成，请勿手动修改
+// 源文件 68567 字节，压缩后 48675 字节，gzip 后 12698 字节（闪存减少 81%）
+
+#include <Arduino.h>
+
+// gzip 压缩后的网页资源
+struct WebAsset {
+    const char* path;
+    const char* contentType;
+    const char* etag;
+    const uint8_t* data;
+    size_t length;
+};
+
+static const uint8_t COMMON_JS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x55, 0x8f, 0x31, 0x6b, 0xc3, 0x30,
+    0x10, 0x85, 0x77, 0xfd, 0x0a, 0x6f, 0xb2, 0x41, 0x8d, 0x77, 0x97, 0x4c, 0x85, 0x0e, 0x1d, 0x92,
+    0x42, 0x02, 0x9d, 0x2f, 0xd2, 0xa9, 0xbe, 0x92, 0x48, 0xaa, 0xee, 0x84, 0x31, 0xc6, 0xff, 0xbd,
+    0x56, 0xdb, 0x0c, 0xd9, 0xde, 0xf0, 0x1e, 0xdf, 0xf7, 0x7c, 0x09, 0x56, 0x28, 0x86, 0x26, 0xe3,
+    0x77, 0x41, 0x96, 0xb7, 0xd3, 0xf1, 0xd0, 0x96, 0x7c, 0x35, 0x0e, 0x04, 0xcc, 0x0d, 0x65, 0x8c,
+    0x6e, 0xaf, 0xdf, 0x8f, 0xa7, 0xb3, 0xee, 0x16, 0x95, 0x51, 0x4a, 0x0e, 0x8d, 0x47, 0xb1, 0xe3,
+    0x6f, 0x6b, 0x51, 0x7f, 0x15, 0xa3, 0x46, 0x04, 0x87, 0x99, 0x87, 0x45, 0xbf, 0xc4, 0x20, 0x18,
+    0xe4, 0xe9, 0x3c, 0x27, 0xd4, 0x83, 0x86, 0x94, 0xae, 0x64, 0xa1, 0x42, 0xfa, 0x2f, 0x8e, 0x41,
+    0xaf, 0x46, 0x5d, 0xa2, 0x9b, 0x87, 0x8a, 0xda, 0xb1, 0x64, 0x0a, 0x9f, 0xe4, 0xe7, 0xb6, 0x02,
+    0x3b, 0xb5, 0x76, 0xcf, 0x6a, 0x55, 0xc0, 0x73, 0xb0, 0x8d, 0xbf, 0xbb, 0x71, 0xb9, 0xdc, 0x48,
+    0x3e, 0xe8, 0x95, 0x5a, 0x66, 0x72, 0x26, 0x01, 0xf3, 0x14, 0xb3, 0xdb, 0x8c, 0x6c, 0x0c, 0x2c,
+    0x9b, 0x3c, 0xa7, 0x2d, 0xe0, 0x1e, 0x26, 0x20, 0x79, 0xf8, 0xa2, 0x7b, 0x48, 0xd4, 0x4f, 0xe4,
+    0x49, 0x9b, 0xe5, 0x61, 0x5d, 0x51, 0xff, 0x87, 0xee, 0xfb, 0x5d, 0x15, 0x6c, 0xab, 0xc2, 0x0f,
+    0xb3, 0x04, 0x94, 0x38, 0x18, 0x01, 0x00, 0x00,
+};
+
+const WebAsset COMMON_JS = {"/common.5d186a57.js", "application/javascript", "\"5d186a57\"", COMMON_JS_GZ, sizeof(COMMON_JS_GZ)};
+
+static const uint8_t AP_MODE_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xe1, 0x73, 0xd3, 0x46,
+    0x16, 0xff, 0x9e, 0xbf, 0x42, 0x98, 0x76, 0xe4, 0xdc, 0x58, 0xb2, 0xe4, 0xc4, 0x4e, 0x62, 0xc7,
+    0x99, 0x69, 0x09, 0xcc, 0x30, 0x53, 0x4a, 0xe6, 0xa0, 0x73, 0xd3, 0x6f, 0xac, 0xa4, 0x95, 0xbd,
+    0x44, 0x96, 0x74, 0x92, 0x9c, 0xc4, 0x75, 0x33, 0x03, 0x14, 0x0a, 0xed, 0x05, 0x9a, 0x2b, 0x30,
+    0x3d, 0x3a, 0x70, 0x5c, 0xaf, 0xe4, 0x9a, 0xb9, 0x29, 0x84, 0xbb, 0x63, 0xe0, 0xda, 0x12, 0xf8,
+    0x63, 0x0e, 0xd9, 0xce, 0xa7, 0xf6, 0x4f, 0xb8, 0xb7, 0xbb, 0x92, 0x2c, 0xd9, 0x0e, 0x4c, 0x67,
+    0x3a, 0x9e, 0x60, 0xed, 0xea, 0xed, 0x7b, 0xbf, 0xf7, 0xde, 0xef, 0xbd, 0x7d, 0x66, 0xf1, 0xc8,
+    0xf2, 0xe9, 0x63, 0x67, 0x3f, 0x5c, 0x39, 0x2e, 0x34, 0x83, 0x96, 0xb5, 0x34, 0xb5, 0x48, 0xbf,
+    0x04, 0x0b, 0xd9, 0x8d, 0x7a, 0xee, 0xa3, 0xa6, 0x74, 0xec, 0xfd, 0x1c, 0xdd, 0xc3, 0xc8, 0x80,
+    0xaf, 0x16, 0x0e, 0x90, 0xa0, 0x37, 0x91, 0xe7, 0xe3, 0xa0, 0x9e, 0xfb, 0xe0, 0xec, 0x09, 0x69,
+    0x3e, 0x17, 0x6f, 0xdb, 0xa8, 0x85, 0xeb, 0xb9, 0x35, 0x82, 0xd7, 0x5d, 0xc7, 0x0b, 0x72, 0x82,
+    0xee, 0xd8, 0x01, 0xb6, 0x41, 0x6c, 0x9d, 0x18, 0x41, 0xb3, 0x6e, 0xe0, 0x35, 0xa2, 0x63, 0x89,
+    0x2d, 0x0a, 0x02, 0xb1, 0x49, 0x40, 0x90, 0x25, 0xf9, 0x3a, 0xb2, 0x70, 0x5d, 0x95, 0x15, 0xaa,
+    0x26, 0x20, 0x81, 0x85, 0x97, 0x56, 0x70, 0x70, 0xf2, 0xb4, 0xf0, 0x07, 0x72, 0x82, 0x0c, 0x1e,
+    0xbd, 0xe8, 0xef, 0x3f, 0x5a, 0x2c, 0xf2, 0xfd, 0xa9, 0x45, 0x3f, 0xe8, 0xc0, 0xf7, 0xef, 0xba,
+    0x2d, 0xe4, 0x35, 0x88, 0x5d, 0x55, 0x6a, 0x2e, 0x32, 0x0c, 0x62, 0x37, 0xe0, 0x49, 0x73, 0x36,
+    0x24, 0x9f, 0x7c, 0x44, 0x17, 0x9a, 0xe3, 0x19, 0xd8, 0x93, 0x60, 0x67, 0x53, 0x73, 0x8c, 0x4e,
+    0xd7, 0x04, 0x1c, 0x92, 0x89, 0x5a, 0xc4, 0xea, 0x54, 0x25, 0xe4, 0xba, 0x16, 0x96, 0xfc, 0x8e,
+    0x1f, 0xe0, 0x56, 0xe1, 0x5d, 0x8b, 0xd8, 0xab, 0xa7, 0x90, 0x7e, 0x86, 0x2d, 0x4f, 0x80, 0x5c,
+    0x41, 0x3c, 0x83, 0x1b, 0x0e, 0x16, 0x3e, 0x38, 0x29, 0x16, 0x7e, 0xef, 0x68, 0x4e, 0xe0, 0x14,
+    0x7c, 0x64, 0xfb, 0x92, 0x8f, 0x3d, 0x62, 0xd6, 0x34, 0xa4, 0xaf, 0x36, 0x3c, 0xa7, 0x6d, 0x1b,
+    0x92, 0xee, 0x58, 0x8e, 0x57, 0x3d, 0x6a, 0xce, 0x98, 0xb3, 0x66, 0xa5, 0x16, 0xad, 0x66, 0xe6,
+    0x66, 0xd5, 0xb2, 0x5a, 0x03, 0xad, 0x58, 0x6a, 0x62, 0xd2, 0x68, 0x06, 0x55, 0x55, 0xae, 0xd4,
+    0x5a, 0xc4, 0x4e, 0x96, 0x8a, 0xb2, 0xd6, 0xac, 0x19, 0xc4, 0x77, 0x2d, 0xd4, 0xa9, 0x9a, 0x16,
+    0xde, 0xa8, 0x21, 0x8b, 0x34, 0x6c, 0x89, 0x00, 0x00, 0xbf, 0xaa, 0x43, 0xbc, 0xb0, 0x57, 0x3b,
+    0xdf, 0xf6, 0x03, 0x62, 0x76, 0xa4, 0x28, 0x82, 0xf1, 0x76, 0xec, 0x6d, 0x49, 0x71, 0x37, 0x36,
+    0x65, 0xfa, 0x12, 0x81, 0x25, 0x0f, 0xc2, 0xb1, 0xc1, 0xc3, 0x5a, 0x9d, 0x55, 0xe0, 0x55, 0x8d,
+    0x3f, 0x83, 0xa9, 0xb7, 0x53, 0x88, 0xab, 0xeb, 0x4d, 0xb0, 0x51, 0x8b, 0x82, 0xe3, 0x21, 0x83,
+    0xb4, 0xfd, 0xaa, 0x5a, 0x02, 0x71, 0x16, 0xba, 0x26, 0x32, 0x9c, 0xf5, 0xaa, 0x22, 0xcc, 0xba,
+    0x1b, 0x42, 0x05, 0xfe, 0x24, 0x15, 0xfe, 0xf1, 0x1a, 0x1a, 0xca, 0x2b, 0x05, 0xf6, 0x91, 0xd5,
+    0xe9, 0x9a, 0xb3, 0x86, 0x3d, 0xd3, 0x02, 0xb9, 0x26, 0x31, 0x0c, 0x6c, 0x6f, 0xca, 0x94, 0x15,
+    0x00, 0x20, 0x65, 0x85, 0xfa, 0x8e, 0x3c, 0xa9, 0x41, 0x0d, 0x00, 0xea, 0xbc, 0x3a, 0x53, 0x36,
+    0x70, 0xa3, 0x70, 0xb4, 0x52, 0x99, 0xc3, 0x18, 0x09, 0xca, 0xdb, 0x85, 0xa3, 0x73, 0x95, 0x59,
+    0x0d, 0x95, 0x04, 0x8a, 0x6f, 0x3a, 0x8a, 0x1c, 0xc7, 0x96, 0xf8, 0x07, 0x20, 0x6a, 0x01, 0xde,
+    0x08, 0x24, 0x16, 0x9b, 0xc8, 0xfd, 0xd8, 0x9a, 0xd0, 0x54, 0x79, 0x4a, 0x21, 0xdd, 0x98, 0xcb,
+    0xb2, 0xe5, 0x3a, 0x8f, 0xb0, 0xe6, 0x58, 0x46, 0x8d, 0x13, 0x04, 0x28, 0x10, 0x04, 0x4e, 0xab,
+    0x3a, 0x4f, 0xc3, 0x15, 0x1d, 0x76, 0xbb, 0x8e, 0x8b, 0x74, 0x12, 0x74, 0xaa, 0x8a, 0xbc, 0x50,
+    0x1b, 0xea, 0x51, 0x67, 0xe3, 0x98, 0x82, 0xb1, 0x6e, 0x8c, 0x64, 0x06, 0xe2, 0x23, 0x94, 0xd8,
+    0x2b, 0xd3, 0xf1, 0x5a, 0x12, 0x75, 0xd2, 0xed, 0x66, 0xb5, 0x8f, 0xbe, 0x86, 0xca, 0xd1, 0xb0,
+    0xd5, 0x8d, 0x73, 0xac, 0x59, 0x8e, 0xbe, 0x9a, 0x41, 0x58, 0x51, 0x94, 0x71, 0x80, 0x59, 0x0a,
+    0x65, 0xf4, 0x11, 0xdb, 0x6d, 0x07, 0xdd, 0x54, 0x52, 0x63, 0x74, 0x34, 0x7b, 0x82, 0x5a, 0x61,
+    0x29, 0xa4, 0x59, 0xad, 0xd2, 0xb5, 0xef, 0x58, 0xc4, 0x10, 0x8e, 0xe2, 0x32, 0x9e, 0xc3, 0xda,
+    0x48, 0xba, 0xe7, 0xe3, 0x58, 0x71, 0x97, 0xe9, 0xc9, 0xc0, 0x03, 0x7a, 0x43, 0x29, 0x3a, 0x76,
+    0x5c, 0x37, 0x0c, 0x88, 0xa0, 0xc8, 0x25, 0x7f, 0x1c, 0x45, 0xd5, 0x74, 0xf4, 0xb6, 0xdf, 0x75,
+    0xda, 0x01, 0xcd, 0x73, 0xd5, 0x76, 0xec, 0x84, 0x51, 0x11, 0x7e, 0x9e, 0xe7, 0x2c, 0xa7, 0xe8,
+    0x67, 0x26, 0xa6, 0x93, 0xaa, 0x94, 0x0a, 0x6a, 0xa9, 0x52, 0x28, 0xcd, 0xcc, 0x32, 0x52, 0x6d,
+    0xca, 0x5a, 0x60, 0x4f, 0xf4, 0x8e, 0x52, 0x91, 0x52, 0x3d, 0xf6, 0x2e, 0x6d, 0xed, 0x70, 0x87,
+    0x46, 0x23, 0xad, 0xb7, 0x3d, 0x1f, 0x80, 0xb9, 0x0e, 0x61, 0x35, 0x94, 0xf2, 0x17, 0x59, 0x16,
+    0x73, 0x73, 0x9c, 0x6a, 0x49, 0x81, 0x12, 0x9b, 0xd5, 0x32, 0xcf, 0x21, 0x13, 0x33, 0xb0, 0xee,
+    0x78, 0x88, 0x9d, 0xa7, 0x78, 0x18, 0x7a, 0xc9, 0xf5, 0x08, 0x24, 0xb4, 0x93, 0xae, 0x83, 0x38,
+    0x10, 0x69, 0x7e, 0x67, 0x93, 0x4e, 0xb3, 0x97, 0x39, 0x5e, 0x6d, 0xd2, 0xfa, 0xca, 0x28, 0x29,
+    0xa3, 0x8a, 0x69, 0xcc, 0x73, 0xd0, 0x34, 0x17, 0x55, 0xf6, 0x64, 0xa1, 0x00, 0x7f, 0x98, 0xa7,
+    0x15, 0xca, 0xa3, 0x07, 0xdd, 0x09, 0x88, 0x6b, 0x8c, 0x22, 0x30, 0xcb, 0x0b, 0x58, 0xd1, 0xd2,
+    0x08, 0x46, 0xa4, 0x27, 0x18, 0x34, 0x16, 0xe6, 0xe6, 0x94, 0xca, 0x6b, 0x0d, 0x42, 0xbf, 0xf6,
+    0x86, 0x15, 0x92, 0xa2, 0x5f, 0x3a, 0x29, 0xe3, 0x25, 0x32, 0x56, 0x6b, 0x4c, 0x8f, 0x44, 0x6c,
+    0xd3, 0xc9, 0x22, 0xd0, 0x30, 0x32, 0x71, 0x5c, 0x0e, 0x2a, 0x9e, 0x55, 0x90, 0x19, 0x33, 0x40,
+    0x1d, 0xf2, 0x7b, 0x61, 0x46, 0x2f, 0x9b, 0x46, 0xac, 0xc5, 0x6f, 0xeb, 0x3a, 0xf6, 0xfd, 0xac,
+    0x22, 0xd5, 0x44, 0xb8, 0x1c, 0x2b, 0x52, 0x2a, 0x65, 0x73, 0xb6, 0x32, 0x41, 0x51, 0x05, 0xe3,
+    0x39, 0x6d, 0x2e, 0x56, 0x84, 0x3d, 0xcf, 0xc9, 0x46, 0xc4, 0xc4, 0xb8, 0x84, 0x4b, 0xb1, 0x9a,
+    0x85, 0x05, 0x55, 0x53, 0xb5, 0x09, 0x6a, 0x4c, 0x1d, 0x95, 0x51, 0x19, 0xda, 0x0c, 0xeb, 0x8c,
+    0x49, 0xf5, 0x53, 0x8e, 0x08, 0x47, 0x48, 0x8b, 0xde, 0x88, 0xc8, 0x0e, 0x36, 0x65, 0x3f, 0x40,
+    0x41, 0xdb, 0x97, 0x34, 0x64, 0x34, 0x70, 0x77, 0x84, 0x66, 0x87, 0x5d, 0x07, 0x71, 0xac, 0x69,
+    0x5f, 0xe6, 0x1d, 0x3b, 0x8d, 0x4f, 0xd3, 0xcc, 0xd2, 0x6c, 0x82, 0xaf, 0x04, 0x57, 0xc0, 0x68,
+    0x95, 0xb0, 0x22, 0x4a, 0x85, 0xbf, 0x34, 0xa1, 0x4c, 0x46, 0xb8, 0x59, 0xe1, 0x3d, 0xcd, 0x01,
+    0xf3, 0xdd, 0xf1, 0xf2, 0x48, 0x27, 0x9f, 0xb5, 0xc7, 0x2c, 0xa2, 0x05, 0x13, 0x99, 0x49, 0xeb,
+    0x09, 0x1c, 0x37, 0x1d, 0xa7, 0xa8, 0x2f, 0xc5, 0xdd, 0x42, 0x9b, 0x2b, 0xcd, 0x2b, 0x23, 0xd8,
+    0x36, 0x17, 0x8b, 0xfc, 0xa2, 0x9f, 0x5a, 0x2c, 0x46, 0x63, 0x07, 0xbd, 0xc7, 0xe1, 0xcb, 0x20,
+    0x6b, 0x82, 0x6e, 0x21, 0xdf, 0xaf, 0xe7, 0x92, 0xdb, 0x2f, 0x97, 0xdd, 0xe7, 0x6d, 0x9e, 0x4d,
+    0x2c, 0xea, 0xd2, 0x2f, 0xf7, 0xb7, 0x5f, 0x08, 0x6c, 0x9c, 0x00, 0x4d, 0x2a, 0xec, 0xb9, 0x4b,
+    0x74, 0xac, 0xe8, 0xef, 0xff, 0xb9, 0xff, 0xd3, 0xdd, 0x83, 0x2b, 0xd7, 0xd9, 0x70, 0xe1, 0x52,
+    0x3b, 0xa0, 0x61, 0x5c, 0x3f, 0x38, 0x3b, 0xa2, 0x3d, 0x9d, 0x3d, 0x78, 0xf5, 0xcb, 0xfd, 0x9b,
+    0x4f, 0x85, 0x77, 0x56, 0x7a, 0xbb, 0xdf, 0x84, 0xcf, 0xbf, 0x10, 0x24, 0xe1, 0xe0, 0xee, 0x85,
+    0xc1, 0x3f, 0x2e, 0x0e, 0x5e, 0xfe, 0xb5, 0x77, 0x63, 0x87, 0x1a, 0xca, 0x28, 0x26, 0x06, 0x9d,
+    0x84, 0x4c, 0x22, 0xb5, 0x80, 0xa9, 0x08, 0xce, 0x27, 0x90, 0x19, 0x65, 0x72, 0x4b, 0x13, 0x50,
+    0x30, 0x52, 0x0a, 0xc3, 0x4a, 0x61, 0x36, 0xbf, 0xfc, 0x46, 0x80, 0xc1, 0x28, 0x7c, 0x70, 0x35,
+    0xdc, 0xbf, 0x19, 0x7e, 0x76, 0x3d, 0x7c, 0x70, 0xf9, 0xd5, 0x8f, 0x37, 0xfa, 0x9f, 0x3c, 0xec,
+    0x5f, 0xfa, 0x81, 0x23, 0xf9, 0xdf, 0x85, 0x4b, 0x83, 0xbd, 0x67, 0x1c, 0x46, 0x78, 0xed, 0x71,
+    0xef, 0xd2, 0x6e, 0xff, 0xeb, 0xcb, 0x43, 0xc7, 0x5f, 0xfd, 0xb4, 0x13, 0x6e, 0xef, 0xf5, 0x6f,
+    0xed, 0x86, 0x8f, 0xb6, 0x7a, 0xb7, 0x9f, 0x84, 0x9f, 0xdf, 0x1f, 0x7c, 0xb2, 0xff, 0xf3, 0xf3,
+    0xad, 0x70, 0xeb, 0x4a, 0xef, 0x4f, 0xdf, 0x87, 0x8f, 0xbe, 0xee, 0x7d, 0xf5, 0x34, 0xbc, 0xb3,
+    0x1b, 0x7e, 0xb9, 0x05, 0x0f, 0x07, 0x5f, 0x3d, 0x09, 0xb7, 0xb7, 0x7a, 0x0f, 0x77, 0x40, 0x69,
+    0xe2, 0x0e, 0xed, 0x0c, 0x43, 0x7f, 0xe8, 0x2a, 0x27, 0x38, 0xb6, 0xdf, 0xd6, 0x5a, 0x04, 0xc6,
+    0x3d, 0x1f, 0xad, 0x61, 0x6a, 0x2d, 0x8f, 0xd7, 0x20, 0x82, 0xd3, 0x23, 0x21, 0x1c, 0x5e, 0x29,
+    0xf4, 0x05, 0xbb, 0x2b, 0x05, 0xd8, 0x8b, 0x74, 0xf9, 0x3e, 0x31, 0x72, 0x4b, 0x1c, 0x67, 0xb8,
+    0x7d, 0xbd, 0xff, 0xdd, 0x63, 0x21, 0x7f, 0xe6, 0xcc, 0xc9, 0xe5, 0xe9, 0xc5, 0x22, 0x13, 0x85,
+    0x23, 0xec, 0x22, 0x12, 0x82, 0x8e, 0x0b, 0xc3, 0x26, 0xa5, 0x66, 0x6e, 0x88, 0x84, 0x9d, 0x8e,
+    0xe6, 0x50, 0xfe, 0x0c, 0xe5, 0xa5, 0xe3, 0x26, 0x8c, 0x04, 0x18, 0x2c, 0x0c, 0x5e, 0xdc, 0x0c,
+    0xaf, 0xec, 0x0c, 0x03, 0xc1, 0x0d, 0xe4, 0x04, 0x98, 0x9f, 0x2c, 0x6c, 0x37, 0x60, 0x46, 0xcd,
+    0xcd, 0xa8, 0x39, 0xc1, 0xc3, 0x7f, 0x6c, 0x13, 0x0f, 0x1b, 0x13, 0x79, 0xf1, 0x7a, 0xf8, 0x2e,
+    0xc8, 0xac, 0x03, 0xef, 0x13, 0x17, 0xf6, 0x3e, 0xed, 0xff, 0xed, 0xe2, 0x64, 0xec, 0x89, 0xec,
+    0x10, 0xff, 0x70, 0x8b, 0xfb, 0x30, 0x5c, 0x1f, 0xe2, 0x07, 0xd7, 0x2f, 0xe4, 0xc3, 0x2f, 0xf6,
+    0x0e, 0x2e, 0x7c, 0x36, 0x9d, 0x71, 0xa5, 0x32, 0x93, 0x1b, 0x7a, 0xa0, 0xb5, 0xa1, 0xae, 0xed,
+    0xc8, 0x32, 0x4f, 0x54, 0xc2, 0x3f, 0xb8, 0x13, 0x84, 0xd4, 0x35, 0xc4, 0x39, 0xf6, 0x42, 0x78,
+    0xf5, 0xf2, 0x5e, 0xf8, 0xf0, 0x2f, 0xe1, 0x0f, 0x4f, 0x33, 0x7c, 0xe6, 0x8a, 0x46, 0x35, 0xf2,
+    0xc5, 0x98, 0xc6, 0xe4, 0xa6, 0xa1, 0xf4, 0xd0, 0x2d, 0xa2, 0xaf, 0xd6, 0x73, 0x1e, 0x86, 0x22,
+    0xf2, 0x82, 0x77, 0x56, 0xf2, 0xd3, 0xcc, 0xd2, 0xad, 0xcb, 0xc2, 0xc1, 0xd5, 0xeb, 0x94, 0x90,
+    0x29, 0x06, 0xa7, 0x0d, 0x15, 0x69, 0xc8, 0x0f, 0xc9, 0x05, 0xed, 0x4f, 0xa0, 0x65, 0x88, 0x30,
+    0xdc, 0xbe, 0x11, 0x3e, 0xfe, 0x74, 0x70, 0xf5, 0x9f, 0xe1, 0xe7, 0xbb, 0x83, 0x67, 0xff, 0x19,
+    0xec, 0x7f, 0x0f, 0x05, 0xc0, 0x79, 0xde, 0xbb, 0xf1, 0x5d, 0x78, 0xed, 0xe9, 0xc1, 0xbd, 0xbf,
+    0xf7, 0xee, 0xbd, 0x4c, 0xb4, 0x45, 0x5f, 0xbe, 0xee, 0x11, 0x37, 0x10, 0x7c, 0x4f, 0xaf, 0xe7,
+    0x8a, 0xba, 0xd3, 0x6a, 0x39, 0xb6, 0x5c, 0x36, 0xd4, 0xf9, 0x0a, 0x2a, 0xcf, 0xc9, 0xe7, 0x7d,
+    0x5a, 0x9b, 0x5c, 0x24, 0x91, 0x5d, 0x9a, 0x32, 0xdb, 0xb6, 0x4e, 0xe7, 0x00, 0xc1, 0x6f, 0x3a,
+    0xeb, 0xa7, 0x78, 0x4d, 0xe7, 0xa3, 0xda, 0x2e, 0xb0, 0xb0, 0x88, 0xb4, 0x64, 0xc5, 0xe9, 0xee,
+    0x14, 0x44, 0xc1, 0x0f, 0x84, 0xe8, 0xdd, 0x32, 0x59, 0xab, 0x1b, 0x30, 0x46, 0xb5, 0xa0, 0x38,
+    0xe4, 0x06, 0x0e, 0x8e, 0x5b, 0x98, 0x3e, 0xbe, 0xdb, 0x39, 0x69, 0xe4, 0xc5, 0x74, 0x83, 0x10,
+    0xa7, 0x6b, 0x53, 0xc3, 0x33, 0x32, 0x73, 0xfa, 0x7d, 0xca, 0x8b, 0x73, 0xe9, 0xb6, 0xf0, 0x56,
+    0x97, 0xda, 0xda, 0x3c, 0x97, 0x91, 0xa5, 0x75, 0x71, 0x2c, 0xfa, 0xf9, 0x15, 0x6d, 0x8f, 0xeb,
+    0x7a, 0x8f, 0xf8, 0x81, 0xec, 0xe1, 0x16, 0x0c, 0x01, 0x79, 0x91, 0x37, 0x21, 0x6a, 0x92, 0x98,
+    0x79, 0x86, 0xbe, 0x5e, 0x17, 0xa3, 0x6b, 0x95, 0xba, 0x00, 0xbf, 0xf7, 0xce, 0x92, 0x16, 0x86,
+    0xc9, 0x2f, 0x9f, 0x9f, 0xae, 0x2f, 0x75, 0x27, 0x6b, 0x83, 0x7b, 0x21, 0xad, 0x6a, 0xb3, 0x30,
+    0xa3, 0x28, 0x0a, 0x7d, 0x80, 0x0f, 0xf2, 0x3b, 0xb6, 0x2e, 0x0c, 0xa3, 0x96, 0xed, 0x12, 0xdd,
+    0x29, 0xf6, 0x2d, 0xbb, 0x1e, 0xfb, 0x5e, 0xc6, 0x26, 0x6a, 0x5b, 0x41, 0x1e, 0xce, 0xf2, 0xe0,
+    0xd1, 0x72, 0x7e, 0x43, 0xd8, 0xa8, 0x88, 0x38, 0x2d, 0xaf, 0x21, 0xab, 0x8d, 0xe5, 0x00, 0xc8,
+    0x3c, 0x3c, 0x1d, 0x17, 0xd2, 0x1b, 0x34, 0xc4, 0x62, 0xb1, 0x16, 0x16, 0x8c, 0x23, 0x54, 0x2f,
+    0x8d, 0x40, 0x2a, 0xcd, 0x22, 0xed, 0xaf, 0x13, 0xbb, 0x89, 0x58, 0x10, 0xd9, 0x0c, 0x41, 0xdd,
+    0xf7, 0x70, 0xd0, 0xf6, 0x6c, 0xea, 0x7d, 0x00, 0xa3, 0x59, 0x56, 0x41, 0xef, 0xe1, 0xb7, 0xe1,
+    0xdd, 0xdd, 0x21, 0x71, 0xa1, 0xff, 0x82, 0xce, 0xfe, 0xee, 0xf5, 0xf0, 0xc2, 0x1d, 0x59, 0x96,
+    0x41, 0x0d, 0x27, 0x4f, 0xec, 0x01, 0x94, 0x0d, 0xc4, 0xa3, 0x8e, 0xd6, 0x11, 0x81, 0x60, 0xb0,
+    0x02, 0x66, 0xd1, 0xa3, 0xe0, 0x0a, 0x31, 0x6e, 0x9e, 0x3d, 0x2e, 0x2a, 0x47, 0xc9, 0x1b, 0x45,
+    0x4e, 0x4f, 0xf1, 0xab, 0x2f, 0x7c, 0xf6, 0x6f, 0x5e, 0xe3, 0x3f, 0x3f, 0xbf, 0xc8, 0x2f, 0x14,
+    0x0e, 0x8a, 0x97, 0x63, 0x52, 0xf8, 0xdc, 0x3b, 0x8e, 0x29, 0x21, 0x44, 0x6d, 0x9c, 0x10, 0x43,
+    0xcb, 0xc4, 0x05, 0xa3, 0xeb, 0xc4, 0x86, 0xe9, 0x5f, 0x86, 0xc9, 0x99, 0x4d, 0xcb, 0x72, 0xd3,
+    0xc3, 0x66, 0xfd, 0x5c, 0x33, 0x08, 0xdc, 0x6a, 0xb1, 0xf8, 0x56, 0x37, 0x11, 0xa5, 0xcc, 0xdd,
+    0xc4, 0x96, 0x8f, 0xc7, 0x8f, 0x78, 0xd8, 0x72, 0x90, 0x91, 0xe7, 0xfc, 0x29, 0xa8, 0xe5, 0x88,
+    0x4b, 0x5c, 0x38, 0xed, 0x54, 0xa4, 0x2c, 0xa2, 0xa4, 0xf0, 0xf1, 0xc7, 0x42, 0xda, 0xcd, 0x07,
+    0xff, 0x1a, 0x3c, 0xd9, 0xe1, 0xf1, 0xed, 0x7d, 0x7b, 0xa1, 0x77, 0x7f, 0x27, 0x9d, 0x2f, 0xb8,
+    0xe5, 0x78, 0x13, 0x4d, 0x27, 0x0e, 0xcc, 0x01, 0x04, 0xbd, 0x99, 0x67, 0x3b, 0x51, 0x01, 0x3b,
+    0x16, 0x96, 0xd9, 0x3a, 0x1d, 0xc3, 0x83, 0x5b, 0x77, 0x06, 0x7b, 0x7b, 0x55, 0xb1, 0xc0, 0x25,
+    0x6b, 0xd9, 0x58, 0x47, 0x83, 0x06, 0x93, 0xe1, 0x00, 0x20, 0xb6, 0x83, 0xbd, 0xdb, 0x23, 0xb6,
+    0x46, 0x4b, 0x23, 0xd5, 0x22, 0xbb, 0x87, 0x52, 0x87, 0x67, 0xe9, 0xd5, 0x7f, 0x7f, 0x4c, 0xf7,
+    0xcd, 0x43, 0x98, 0xe3, 0xc2, 0x03, 0x8e, 0xb8, 0x63, 0x62, 0xea, 0x98, 0x58, 0x44, 0x2e, 0x29,
+    0x46, 0x86, 0x24, 0xe4, 0x8a, 0x05, 0x5a, 0xd1, 0x41, 0xd3, 0x31, 0xaa, 0xe2, 0xca, 0xe9, 0x33,
+    0x67, 0xc5, 0xa9, 0xcd, 0x84, 0x4c, 0xec, 0xb4, 0xec, 0xac, 0x8e, 0xd5, 0xc0, 0x18, 0x67, 0x26,
+    0xa2, 0x79, 0x1d, 0x67, 0x5e, 0x93, 0xf1, 0xc2, 0xe1, 0xe9, 0x16, 0x23, 0x86, 0xa6, 0x12, 0x3b,
+    0x31, 0xae, 0xaf, 0xcd, 0x21, 0xd7, 0xf1, 0xdb, 0xe4, 0x2f, 0xe9, 0x2a, 0xd0, 0xff, 0x8e, 0xd3,
+    0xf6, 0x45, 0x9b, 0x21, 0x86, 0xe1, 0x34, 0x2f, 0x2e, 0x9f, 0x3e, 0x15, 0x35, 0xe2, 0xf7, 0xc0,
+    0x33, 0x6c, 0x88, 0x85, 0x38, 0xcd, 0xf9, 0xe4, 0x62, 0xd0, 0x9b, 0x58, 0x5f, 0x05, 0x29, 0x1b,
+    0xb3, 0x17, 0x75, 0x46, 0x07, 0x1e, 0x20, 0x96, 0xfd, 0x37, 0xe6, 0x91, 0x8f, 0xa5, 0xc3, 0x94,
+    0xf3, 0x75, 0x24, 0x98, 0x64, 0xf0, 0xbc, 0x4f, 0x8d, 0xb2, 0xac, 0x72, 0x01, 0x99, 0x36, 0xbd,
+    0xc8, 0x2e, 0x36, 0x26, 0x35, 0x0a, 0xde, 0x01, 0x7a, 0xd7, 0xb6, 0x61, 0x48, 0x84, 0x2e, 0x11,
+    0x35, 0xad, 0xec, 0xbd, 0xda, 0xbf, 0xbd, 0x05, 0x97, 0xea, 0xaf, 0xcf, 0x35, 0x6b, 0x08, 0x62,
+    0x51, 0xa4, 0xb9, 0x2e, 0x25, 0xd7, 0x44, 0x36, 0x67, 0xb0, 0xc1, 0x34, 0x9d, 0xa4, 0x3f, 0x3b,
+    0xa0, 0x25, 0xe7, 0x47, 0x42, 0x95, 0x90, 0x04, 0xfe, 0x52, 0x57, 0x74, 0x31, 0xfa, 0xbd, 0x50,
+    0x64, 0xff, 0xa1, 0xf9, 0x7f, 0x58, 0x98, 0x4b, 0xa1, 0xe0, 0x14, 0x00, 0x00,
+};
+
+const WebAsset AP_MODE_PAGE = {"/", "text/html", "\"ae1ac812\"", AP_MODE_PAGE_GZ, sizeof(AP_MODE_PAGE_GZ)};
+
+static const uint8_t INDEX_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x6b, 0x77, 0x13, 0x47,
+    0xb6, 0xe8, 0x77, 0xff, 0x8a, 0x8e, 0x0e, 0x99, 0x96, 0xee, 0x48, 0xf2, 0x1b, 0xb8, 0x76, 0xe4,
+    0x73, 0x79, 0x9e, 0x70, 0x4f, 0x08, 0x5e, 0x01, 0x66, 0xee, 0x59, 0x2c, 0xee, 0x72, 0x5b, 0x6a,
+    0xdb, 0x3d, 0x48, 0x6a, 0x4d, 0x77, 0x0b, 0xdb, 0x68, 0xb4, 0x96, 0x21, 0x21, 0x3c, 0x82, 0x81,
+    0x10, 0x02, 0x03, 0x21, 0xd7, 0x90, 0x81, 0x40, 0x92, 0x31, 0x70, 0x92, 0x0c, 0x10, 0x30, 0xe1,
+    0xc3, 0xfd, 0x27, 0x39, 0x6e, 0xc9, 0xfe, 0x44, 0x7e, 0xc2, 0xd9, 0xbb, 0x1e, 0xdd, 0x55, 0xfd,
+    0x90, 0x64, 0x0c, 0x13, 0x26, 0x6b, 0xd6, 0x4a, 0xb0, 0xd4, 0x5d, 0xb5, 0x6b, 0xd7, 0xae, 0xfd,
+    0xaa, 0x5d, 0xbb, 0xb6, 0xde, 0x7a, 0x63, 0xfb, 0x9e, 0x6d, 0xfb, 0xfe, 0x63, 0x74, 0x87, 0x32,
+    0xe5, 0x94, 0x8a, 0x23, 0x5d, 0x6f, 0xe1, 0x1f, 0xa5, 0xa8, 0x95, 0x27, 0x73, 0x89, 0x23, 0x53,
+    0x99, 0x6d, 0xef, 0x26, 0xf0, 0x99, 0xae, 0x15, 0xe0, 0x4f, 0x49, 0x77, 0x34, 0x25, 0x3f, 0xa5,
+    0x59, 0xb6, 0xee, 0xe4, 0x12, 0xfb, 0xf7, 0xed, 0xcc, 0x6c, 0x4e, 0xf0, 0xc7, 0x65, 0xad, 0xa4,
+    0xe7, 0x12, 0x87, 0x0d, 0x7d, 0xba, 0x62, 0x5a, 0x4e, 0x42, 0xc9, 0x9b, 0x65, 0x47, 0x2f, 0x43,
+    0xb3, 0x69, 0xa3, 0xe0, 0x4c, 0xe5, 0x0a, 0xfa, 0x61, 0x23, 0xaf, 0x67, 0xc8, 0x97, 0xb4, 0x62,
+    0x94, 0x0d, 0xc7, 0xd0, 0x8a, 0x19, 0x3b, 0xaf, 0x15, 0xf5, 0x5c, 0x6f, 0xb6, 0x07, 0xc1, 0x38,
+    0x86, 0x53, 0xd4, 0x47, 0x46, 0x75, 0x67, 0xd7, 0x1e, 0xa5, 0x71, 0xf6, 0xb6, 0x7b, 0xf2, 0xc1,
+    0xea, 0xe7, 0x5f, 0x34, 0x3e, 0x7f, 0xf6, 0x56, 0x37, 0x7d, 0xd3, 0xf5, 0x96, 0x9d, 0xb7, 0x8c,
+    0x8a, 0xa3, 0xd8, 0x56, 0x3e, 0x97, 0x98, 0x72, 0x9c, 0x8a, 0x3d, 0xd4, 0xdd, 0x9d, 0x2f, 0x94,
+    0xb3, 0x8e, 0x66, 0x14, 0xa7, 0x8d, 0x72, 0x21, 0x6f, 0xdb, 0xd9, 0xbc, 0x59, 0x4a, 0x8c, 0xbc,
+    0xd5, 0x4d, 0x9b, 0x62, 0x1f, 0x67, 0x16, 0xfa, 0x8e, 0x9b, 0x85, 0xd9, 0x5a, 0x66, 0x5a, 0x1f,
+    0x3f, 0x64, 0x38, 0x99, 0x09, 0x40, 0x2d, 0x63, 0x97, 0x4c, 0xd3, 0x99, 0x32, 0xca, 0x93, 0x43,
+    0x5a, 0x19, 0x71, 0x31, 0x34, 0x5b, 0x2f, 0x0c, 0x67, 0x4a, 0xe6, 0x91, 0x8c, 0x69, 0xcf, 0x04,
+    0xdb, 0x4c, 0x5a, 0xda, 0x2c, 0x41, 0xb6, 0x0e, 0x83, 0x8d, 0x67, 0xb5, 0xbc, 0x63, 0x1c, 0xd6,
+    0x6b, 0x15, 0xd3, 0x86, 0x79, 0x98, 0xe5, 0x21, 0x4b, 0x2f, 0x6a, 0xf8, 0x44, 0x7c, 0x3b, 0x34,
+    0xa4, 0x4d, 0x38, 0xba, 0x55, 0x63, 0x84, 0x18, 0x52, 0xd5, 0x61, 0xaf, 0xbd, 0x36, 0x6e, 0x9b,
+    0xc5, 0xaa, 0xa3, 0x0f, 0x8f, 0x9b, 0x8e, 0x63, 0x96, 0x86, 0x32, 0xbd, 0x95, 0x99, 0xe1, 0xa2,
+    0x3e, 0xe1, 0x0c, 0xf5, 0x0c, 0x5b, 0xc6, 0xe4, 0x14, 0xfe, 0x9d, 0xd2, 0xc9, 0x87, 0x3e, 0x78,
+    0x33, 0xae, 0xe5, 0x0f, 0x4d, 0x5a, 0x66, 0xb5, 0x5c, 0xc8, 0xe4, 0xcd, 0xa2, 0x69, 0x0d, 0xfd,
+    0xcb, 0xc0, 0xc4, 0xc0, 0x46, 0x7d, 0x70, 0x58, 0x2b, 0x1b, 0x25, 0x8d, 0x40, 0x84, 0x77, 0xba,
+    0x55, 0x34, 0xca, 0xba, 0xd2, 0x93, 0xed, 0xb7, 0x15, 0x1d, 0x66, 0x93, 0x31, 0xab, 0x4e, 0xfd,
+    0x7f, 0x1d, 0xd2, 0x67, 0x27, 0x2c, 0x58, 0x1b, 0x5b, 0xf1, 0x9a, 0xd4, 0x26, 0x2c, 0xb3, 0x54,
+    0x23, 0x4b, 0x31, 0xd4, 0x53, 0x77, 0x4c, 0xf6, 0xb1, 0xb7, 0xa7, 0xe7, 0xcd, 0x7a, 0x3d, 0x3b,
+    0xa1, 0x15, 0xf4, 0x8c, 0x51, 0xae, 0xf9, 0xb0, 0xf1, 0xc9, 0xae, 0x32, 0x00, 0x1e, 0x64, 0x80,
+    0x8d, 0x72, 0x10, 0x36, 0x6d, 0x42, 0x01, 0x9b, 0x15, 0x2d, 0x6f, 0x38, 0xb3, 0x30, 0x05, 0xc7,
+    0xd2, 0xca, 0xf6, 0x84, 0x69, 0x95, 0x86, 0xc8, 0x27, 0xa0, 0x91, 0xfe, 0x1f, 0xc9, 0xde, 0x9e,
+    0xca, 0x4c, 0x0a, 0x47, 0xe5, 0xed, 0x7a, 0xa3, 0xdb, 0xf5, 0xa4, 0x00, 0x99, 0x29, 0xa3, 0x50,
+    0xd0, 0xcb, 0xb5, 0x82, 0x61, 0x57, 0x8a, 0xda, 0xec, 0x50, 0xd9, 0x2c, 0xeb, 0x75, 0x58, 0x5c,
+    0xb2, 0xa6, 0x5d, 0x6f, 0x75, 0x33, 0xbe, 0xc4, 0xd5, 0x55, 0xf2, 0x45, 0xcd, 0xb6, 0x73, 0x89,
+    0xf1, 0xc9, 0x0c, 0x2e, 0x56, 0x06, 0x66, 0xa3, 0x38, 0xfa, 0x8c, 0x43, 0xbf, 0x6d, 0x86, 0x6f,
+    0x74, 0x49, 0x01, 0x3e, 0x32, 0x5b, 0xc1, 0x38, 0xcc, 0x7b, 0xe0, 0x02, 0x69, 0x40, 0x16, 0x4b,
+    0x29, 0xcd, 0x64, 0xb4, 0xaa, 0x63, 0x2a, 0x25, 0x6d, 0x26, 0x33, 0x9d, 0xd9, 0x34, 0x53, 0x54,
+    0x2a, 0x99, 0x01, 0xce, 0xff, 0xf0, 0xde, 0x1f, 0x62, 0x7a, 0xca, 0x70, 0x74, 0x85, 0x2c, 0x89,
+    0x5e, 0xc8, 0x40, 0x43, 0x7b, 0x4a, 0x2b, 0x98, 0xd3, 0xc0, 0x31, 0xd0, 0x65, 0xa3, 0x52, 0x1a,
+    0xcf, 0x6c, 0x0c, 0x8c, 0x32, 0x51, 0xd4, 0x67, 0x94, 0x3f, 0x54, 0x6d, 0xc7, 0x98, 0x98, 0xcd,
+    0x8c, 0xeb, 0xce, 0xb4, 0xae, 0x97, 0x15, 0x00, 0x52, 0xb2, 0x33, 0x79, 0x60, 0x0f, 0xdd, 0x62,
+    0xed, 0x71, 0xb4, 0x5e, 0xde, 0x89, 0x4c, 0xa0, 0x0f, 0xc0, 0x13, 0xdc, 0xc7, 0xcd, 0x62, 0x41,
+    0x98, 0xd3, 0xff, 0xec, 0x01, 0xb1, 0xf9, 0x79, 0xe1, 0xfc, 0x8f, 0x4a, 0x94, 0xcc, 0x4c, 0xf5,
+    0x02, 0xa4, 0x8a, 0x04, 0x08, 0x90, 0xf3, 0x7b, 0x0f, 0x02, 0x45, 0x4a, 0x4e, 0xa6, 0x37, 0x31,
+    0xb2, 0xfc, 0x68, 0x6e, 0xf9, 0xd1, 0xd7, 0x8d, 0x2b, 0x8f, 0x57, 0xde, 0x7f, 0xea, 0xde, 0xbd,
+    0xde, 0x3c, 0xf5, 0x95, 0x7b, 0xe9, 0x98, 0x7b, 0xfc, 0x89, 0x7b, 0xf7, 0x6a, 0xe3, 0xf2, 0x03,
+    0xf7, 0xca, 0x9d, 0xb7, 0xba, 0x2b, 0x48, 0x6c, 0x8a, 0x1c, 0x4e, 0xc9, 0x28, 0x10, 0xaa, 0x95,
+    0xf5, 0x3c, 0xf2, 0x47, 0xc6, 0x76, 0x34, 0xa7, 0x6a, 0x27, 0x82, 0x63, 0x11, 0x9c, 0x4b, 0x7a,
+    0xc1, 0xa8, 0xb2, 0x71, 0x09, 0x67, 0xe3, 0x34, 0xed, 0x8a, 0x56, 0xe6, 0xad, 0x8d, 0x32, 0xb2,
+    0x64, 0x86, 0x90, 0x47, 0x24, 0x87, 0x52, 0x99, 0xc9, 0xf4, 0x65, 0x07, 0x95, 0xca, 0x6c, 0x06,
+    0x18, 0xcf, 0x23, 0xf5, 0x44, 0xb5, 0x58, 0x54, 0x62, 0xd7, 0x18, 0x80, 0x37, 0xfe, 0x32, 0xd7,
+    0xf8, 0xdb, 0x47, 0xcb, 0x8f, 0x16, 0xb3, 0xd9, 0x2c, 0x20, 0x8d, 0x43, 0xf9, 0xc8, 0x07, 0xe6,
+    0xc0, 0x94, 0x92, 0x51, 0x9e, 0x30, 0x65, 0xec, 0x67, 0xec, 0x30, 0xa5, 0x06, 0x94, 0x71, 0xd3,
+    0x02, 0x2e, 0xc8, 0x38, 0xfc, 0x03, 0x79, 0xdb, 0x07, 0x6f, 0x2b, 0xb0, 0x48, 0xa8, 0x74, 0xd8,
+    0x20, 0x94, 0x5b, 0x50, 0x31, 0x02, 0x5b, 0xc9, 0x5c, 0xd0, 0x92, 0x75, 0x02, 0x1c, 0xc3, 0x46,
+    0x19, 0x0f, 0x0e, 0x87, 0xcd, 0xca, 0x9a, 0xcc, 0x58, 0x30, 0x4d, 0x98, 0x08, 0x50, 0x0c, 0xc9,
+    0x36, 0x90, 0x50, 0x34, 0xcb, 0xd0, 0x32, 0x45, 0x6d, 0x5c, 0x2f, 0xe6, 0x12, 0xfb, 0x40, 0xdb,
+    0x60, 0x9f, 0xf1, 0x2a, 0xe8, 0x1a, 0x8f, 0xee, 0xa0, 0xa8, 0x14, 0xaa, 0xa8, 0x12, 0x8a, 0x59,
+    0xce, 0x17, 0x8d, 0xfc, 0xa1, 0x5c, 0xc2, 0x9e, 0x36, 0x9c, 0xfc, 0x14, 0x74, 0x48, 0xaa, 0x8e,
+    0x51, 0xd2, 0x2d, 0x5b, 0x4d, 0x2b, 0xa0, 0x00, 0xed, 0x54, 0x82, 0xd0, 0x8b, 0x3e, 0xcb, 0x40,
+    0xd7, 0xc4, 0x88, 0xc0, 0x1d, 0x14, 0x70, 0xd4, 0x08, 0xd1, 0xa0, 0x4b, 0x5a, 0xb9, 0xaa, 0x15,
+    0x3d, 0xd0, 0x23, 0x8d, 0x53, 0x1f, 0xb9, 0xa7, 0xef, 0x50, 0xf6, 0x5d, 0x3b, 0x34, 0x7b, 0xd6,
+    0x06, 0xb6, 0xf1, 0xa1, 0x35, 0xbf, 0x7b, 0xd2, 0x7c, 0xb2, 0xd0, 0x3c, 0xfd, 0xa0, 0x31, 0x77,
+    0x74, 0xed, 0xd0, 0xa6, 0x8d, 0x09, 0xc3, 0x87, 0xf5, 0x7b, 0x63, 0xa7, 0xb1, 0x72, 0xf7, 0xc7,
+    0xe6, 0xd3, 0xbb, 0x6b, 0x87, 0x34, 0x61, 0x58, 0xa5, 0x69, 0xcd, 0xd2, 0x7d, 0x68, 0xee, 0x67,
+    0x8f, 0x97, 0x9f, 0x3c, 0x68, 0x7c, 0xf6, 0x7d, 0xe3, 0xd2, 0x7d, 0x01, 0x5e, 0x37, 0x2c, 0xa6,
+    0xcc, 0x9b, 0x0c, 0x74, 0xc5, 0x57, 0x22, 0x02, 0xf5, 0x99, 0x3d, 0x49, 0x08, 0x08, 0xf0, 0x67,
+    0x0a, 0xd3, 0xdd, 0x62, 0x2f, 0xad, 0x02, 0x36, 0x0d, 0x9e, 0x96, 0x4d, 0x07, 0x78, 0xdd, 0xeb,
+    0x45, 0x15, 0x2b, 0xea, 0x37, 0x54, 0x56, 0x03, 0x8a, 0xa4, 0x20, 0x66, 0xf5, 0x62, 0x11, 0x38,
+    0x12, 0x95, 0x26, 0xe7, 0xd3, 0xe2, 0x24, 0x4a, 0x1d, 0x7b, 0x31, 0xd8, 0xc3, 0x78, 0x92, 0xb3,
+    0x26, 0x7b, 0x8e, 0xcc, 0x09, 0x3d, 0xc0, 0xa4, 0x27, 0xc0, 0x54, 0x5a, 0x21, 0x59, 0x17, 0x34,
+    0x42, 0x62, 0xe4, 0xa7, 0xab, 0xd7, 0x9f, 0x3f, 0x3a, 0xa7, 0x6c, 0x19, 0x55, 0x1a, 0x77, 0x6e,
+    0xb8, 0x4b, 0xe7, 0x1a, 0xe7, 0xce, 0xaf, 0x7e, 0x78, 0xe1, 0xf9, 0xd2, 0x55, 0x26, 0xb4, 0x8a,
+    0xfb, 0xf4, 0x13, 0xf7, 0xd4, 0x3c, 0x90, 0xdf, 0xbd, 0x79, 0xc2, 0xbd, 0xf9, 0xc1, 0xf2, 0xe3,
+    0xb3, 0x7e, 0xe3, 0xe7, 0x4b, 0x67, 0x1a, 0x97, 0xaf, 0x37, 0xbe, 0xfb, 0xd4, 0x3d, 0x7f, 0xa6,
+    0xb1, 0x78, 0xab, 0xf9, 0xf4, 0xe3, 0xe6, 0x93, 0x6b, 0xc0, 0x8f, 0xab, 0x97, 0xbf, 0xff, 0xaf,
+    0xb9, 0x63, 0x2b, 0xf7, 0x1e, 0xba, 0xc7, 0x4f, 0xae, 0x3c, 0xfb, 0x7f, 0x8d, 0xb3, 0xb7, 0xdc,
+    0x93, 0xf7, 0x15, 0x5c, 0x46, 0x85, 0xb6, 0x59, 0x7e, 0x72, 0xcb, 0x3d, 0x7f, 0xaf, 0x79, 0xf1,
+    0x8e, 0xc7, 0xbf, 0xee, 0xe9, 0x05, 0x50, 0x7c, 0xd0, 0x2b, 0x6a, 0x09, 0x26, 0x2d, 0xa3, 0xa0,
+    0xe0, 0x3f, 0x68, 0x78, 0xed, 0x4c, 0xaf, 0x52, 0x44, 0x5f, 0x80, 0x7f, 0xed, 0x57, 0x26, 0xb5,
+    0x4a, 0x48, 0xd3, 0x43, 0x13, 0x78, 0x9b, 0xc1, 0x49, 0x40, 0x07, 0x2a, 0x99, 0xb3, 0x11, 0x4b,
+    0x99, 0x41, 0x8b, 0x97, 0xf0, 0x17, 0x7b, 0x90, 0x13, 0x55, 0xa6, 0x39, 0xd3, 0x41, 0xc4, 0x0c,
+    0xf5, 0x4b, 0x5a, 0x0a, 0xde, 0x53, 0x9b, 0xa6, 0x97, 0x0c, 0x62, 0x1b, 0xfc, 0x95, 0xf4, 0x15,
+    0x62, 0xe3, 0xe1, 0x13, 0xf7, 0xf4, 0x75, 0xe0, 0x38, 0x41, 0x60, 0xa7, 0xfa, 0x43, 0xb8, 0x80,
+    0x11, 0xb7, 0xb5, 0xc9, 0x10, 0x7f, 0x20, 0x44, 0x5f, 0xb3, 0x09, 0x93, 0xe4, 0xd3, 0x1a, 0xf0,
+    0xcd, 0x16, 0x51, 0x37, 0x80, 0x91, 0xc5, 0x61, 0x56, 0x80, 0x13, 0x3d, 0x65, 0x56, 0x34, 0xf3,
+    0x87, 0x94, 0x58, 0xd3, 0x40, 0xf0, 0xdd, 0x84, 0x8a, 0x76, 0x1c, 0x4d, 0xd2, 0xea, 0xdc, 0xa9,
+    0xc6, 0x47, 0x5f, 0xb9, 0x4b, 0x9f, 0xae, 0x7c, 0x00, 0xec, 0x40, 0x00, 0x23, 0x2b, 0xe9, 0x45,
+    0xb0, 0x38, 0x02, 0xd2, 0xe2, 0x00, 0xd3, 0xd4, 0x34, 0x54, 0x40, 0x05, 0xca, 0xbc, 0x49, 0x40,
+    0xf7, 0x0b, 0xac, 0x5c, 0x2a, 0x08, 0xd6, 0x7a, 0xc2, 0xcc, 0x57, 0xed, 0x21, 0x0b, 0x7c, 0x3c,
+    0x90, 0x9b, 0x82, 0x31, 0x69, 0x12, 0x75, 0x4f, 0x9f, 0x32, 0x00, 0xfe, 0x73, 0xe2, 0x58, 0x12,
+    0x24, 0x24, 0x79, 0x8d, 0x9a, 0x3b, 0xfe, 0xfb, 0x82, 0x93, 0x5f, 0xb9, 0xfd, 0xa5, 0x7b, 0xee,
+    0x63, 0xca, 0xcc, 0xfe, 0xe4, 0x8d, 0x72, 0xa5, 0xea, 0x28, 0xce, 0x6c, 0x45, 0xa7, 0x43, 0x08,
+    0x1a, 0x99, 0x0d, 0x76, 0x58, 0x2b, 0x56, 0xe1, 0x65, 0x6f, 0xdf, 0x10, 0x8a, 0xe1, 0xdf, 0x95,
+    0x2c, 0xed, 0xa8, 0x51, 0xa8, 0x5a, 0xc4, 0x95, 0x7c, 0x41, 0x8a, 0x34, 0xce, 0x1c, 0x6d, 0x3e,
+    0x59, 0xa4, 0x14, 0x51, 0x92, 0xcd, 0xdb, 0x17, 0x52, 0xd1, 0x74, 0x29, 0x57, 0x4b, 0xe3, 0xe0,
+    0x48, 0x09, 0x94, 0xf1, 0x07, 0x06, 0x9f, 0x2e, 0x97, 0xd8, 0xbc, 0x71, 0x00, 0x69, 0xc3, 0x28,
+    0x05, 0x9e, 0xf2, 0x2f, 0x48, 0x27, 0xc9, 0x7e, 0x07, 0x1d, 0x41, 0x71, 0x56, 0xf9, 0x29, 0x3d,
+    0x7f, 0x68, 0xdc, 0x9c, 0x11, 0xe7, 0x65, 0xe9, 0x15, 0x5d, 0x43, 0x1b, 0x80, 0xef, 0xf4, 0x82,
+    0x27, 0xb5, 0x20, 0xff, 0xd3, 0x5c, 0x07, 0xb0, 0x81, 0x37, 0xf6, 0xf4, 0xc4, 0xcd, 0x25, 0x1a,
+    0xfd, 0x44, 0xd4, 0x0a, 0x7a, 0x03, 0xd2, 0x81, 0x4a, 0x45, 0x24, 0x94, 0xb4, 0x88, 0x01, 0xc7,
+    0xb4, 0x71, 0xef, 0x9c, 0x7b, 0xf3, 0xab, 0xd5, 0x13, 0xf3, 0xee, 0xcd, 0xf9, 0xc6, 0xa9, 0xdb,
+    0x2b, 0x37, 0xce, 0xf8, 0x6b, 0x16, 0xc1, 0x2c, 0x71, 0xc4, 0xf0, 0x3d, 0x9b, 0x4e, 0xc8, 0x52,
+    0x99, 0x2e, 0x11, 0x6b, 0x47, 0x2c, 0xf2, 0x14, 0xec, 0x61, 0x51, 0x58, 0xcc, 0xc9, 0xc9, 0xa2,
+    0xbe, 0x0f, 0xdf, 0x8f, 0xfe, 0x7e, 0xf7, 0x6e, 0x78, 0x9b, 0x4c, 0x25, 0xda, 0x11, 0x2c, 0x7a,
+    0x5d, 0x63, 0xc8, 0x18, 0x34, 0x73, 0x6d, 0xd9, 0x3a, 0x31, 0x02, 0x98, 0x30, 0x4b, 0xe6, 0xbb,
+    0xa8, 0x61, 0xea, 0x04, 0x66, 0x86, 0x56, 0x1e, 0xac, 0xab, 0x1d, 0x50, 0xd2, 0x91, 0xeb, 0x85,
+    0xed, 0x09, 0x9b, 0xbf, 0xa0, 0xc8, 0x21, 0x82, 0xee, 0xd2, 0x63, 0xf7, 0xf1, 0x97, 0x43, 0x0a,
+    0x9d, 0x9c, 0x8c, 0x4b, 0x45, 0xb7, 0x70, 0x81, 0xd0, 0x64, 0x8c, 0x0c, 0xf6, 0xbc, 0xc9, 0x66,
+    0x11, 0x2d, 0x96, 0x16, 0x2e, 0x44, 0x70, 0x99, 0x18, 0x72, 0x25, 0xa3, 0x0c, 0x82, 0xc8, 0xc4,
+    0xb3, 0xb7, 0xa7, 0xaf, 0xdf, 0x93, 0xce, 0xc1, 0xde, 0xbe, 0x44, 0x97, 0x59, 0x26, 0x80, 0x72,
+    0x89, 0x6a, 0xa5, 0x00, 0xbb, 0x42, 0xbe, 0x8a, 0xa3, 0xde, 0xe8, 0x49, 0xf4, 0xad, 0xb2, 0xa4,
+    0x4b, 0x2a, 0xd1, 0x25, 0x0b, 0xf3, 0x14, 0xf2, 0xe8, 0xa4, 0xef, 0xa6, 0x0b, 0x76, 0x55, 0xab,
+    0x00, 0x3b, 0x03, 0x5e, 0x79, 0x74, 0x8c, 0x60, 0xd3, 0x9c, 0xaf, 0x5a, 0xb6, 0x09, 0x88, 0x99,
+    0x86, 0xb0, 0x15, 0x6b, 0xb9, 0x75, 0x8b, 0xdd, 0x27, 0xf4, 0x72, 0x76, 0x18, 0xf1, 0xc8, 0xc2,
+    0xbe, 0xf7, 0x0d, 0x06, 0x1e, 0x0c, 0x06, 0x5b, 0x6c, 0x0a, 0xb6, 0xc0, 0x3d, 0x79, 0xcc, 0x26,
+    0x46, 0x76, 0x43, 0xa7, 0xbd, 0x9d, 0x91, 0xc0, 0xc5, 0x04, 0x37, 0xba, 0xdf, 0x90, 0x1d, 0x05,
+    0xd8, 0x54, 0xd1, 0x9d, 0x82, 0xa8, 0xd5, 0xa6, 0xcc, 0xc3, 0xba, 0x35, 0xe4, 0x43, 0xd8, 0xe4,
+    0xc9, 0x01, 0x6c, 0xf6, 0xc9, 0x26, 0x8d, 0x90, 0x4a, 0x10, 0x8d, 0x3e, 0xf1, 0x8b, 0x39, 0x31,
+    0x61, 0xeb, 0x8e, 0xfc, 0x4c, 0x90, 0x1d, 0xb2, 0xb3, 0x27, 0xd1, 0x0f, 0x1a, 0xc3, 0xb0, 0x05,
+    0xaf, 0x59, 0x2b, 0x14, 0xc8, 0xca, 0x82, 0x60, 0x8e, 0x74, 0xfd, 0xbc, 0xf0, 0xe9, 0x79, 0x85,
+    0x7a, 0x2d, 0x9e, 0xcb, 0xd2, 0x25, 0xba, 0xcb, 0x1d, 0x51, 0xc1, 0x82, 0x39, 0x0d, 0x32, 0x0a,
+    0xe0, 0xe7, 0x4d, 0x5e, 0x00, 0xa0, 0x33, 0x1a, 0x60, 0x9f, 0xde, 0xf5, 0x13, 0x80, 0xa2, 0xd1,
+    0x7a, 0xf6, 0xf9, 0x22, 0xb0, 0xe2, 0x96, 0x62, 0x91, 0x90, 0xc0, 0x26, 0x34, 0x68, 0x3c, 0x3a,
+    0xbe, 0x7a, 0xe5, 0x66, 0xe3, 0xd4, 0x5c, 0xe3, 0xda, 0xa9, 0x56, 0x44, 0x90, 0x75, 0x44, 0xd1,
+    0xb0, 0x9d, 0x8c, 0x17, 0xcd, 0x48, 0x44, 0xf9, 0xa3, 0x7d, 0x2f, 0xea, 0x46, 0x36, 0xcf, 0xde,
+    0x17, 0x71, 0x11, 0x7c, 0x48, 0x0e, 0xca, 0x43, 0xc1, 0x73, 0x79, 0xfb, 0x41, 0x02, 0xc9, 0x7a,
+    0x20, 0x51, 0x27, 0x70, 0x83, 0x30, 0x4b, 0xe3, 0x2b, 0x15, 0x0b, 0x10, 0x09, 0x20, 0x1e, 0x74,
+    0xa2, 0x4d, 0xad, 0x80, 0x04, 0xac, 0x14, 0x01, 0xd6, 0x14, 0x60, 0x05, 0xa6, 0x80, 0xa0, 0xc4,
+    0xa3, 0x03, 0xb0, 0x3a, 0xb2, 0xec, 0xc1, 0xfe, 0xea, 0xf4, 0xf5, 0x95, 0xa7, 0x4f, 0xe9, 0xd6,
+    0x3f, 0xc0, 0x26, 0x91, 0x7f, 0x38, 0xf5, 0xe8, 0x7e, 0xb4, 0xe5, 0xc6, 0x8a, 0xb9, 0xc3, 0x81,
+    0xfd, 0x55, 0xdc, 0x26, 0xa1, 0x54, 0x10, 0x36, 0x09, 0x7d, 0xd2, 0x26, 0xe1, 0x05, 0xc9, 0xff,
+    0xf3, 0xc2, 0xc5, 0x33, 0x0a, 0xf5, 0x87, 0xdd, 0x67, 0xdf, 0xac, 0xce, 0x2d, 0xf0, 0xdd, 0xb2,
+    0xe4, 0xca, 0x83, 0x3f, 0x6c, 0x67, 0x70, 0xe4, 0x44, 0x0c, 0x6a, 0xfd, 0x8a, 0x5d, 0x12, 0x50,
+    0x1b, 0x90, 0x31, 0x1d, 0x24, 0x98, 0xf6, 0xbf, 0xda, 0x95, 0xa8, 0xb4, 0x0e, 0xb4, 0x88, 0x90,
+    0x41, 0x99, 0x02, 0x32, 0xcd, 0x63, 0x3f, 0xb8, 0x27, 0x9e, 0xb0, 0xb9, 0xcf, 0xdf, 0x68, 0x9e,
+    0x3a, 0xe1, 0x9e, 0xbb, 0x47, 0x89, 0xe0, 0x9e, 0x3c, 0xd1, 0x98, 0xff, 0x82, 0x6f, 0xf5, 0x2b,
+    0x31, 0x9b, 0xe8, 0xd6, 0xfb, 0x2a, 0xe4, 0x51, 0xc3, 0x79, 0x51, 0xb1, 0xf8, 0xe9, 0xea, 0x15,
+    0xdc, 0xc4, 0x36, 0xbf, 0xfd, 0xb1, 0x79, 0xe3, 0x6e, 0xe4, 0x9a, 0x30, 0xe6, 0x7a, 0xb9, 0xfb,
+    0x2b, 0x06, 0xf4, 0x15, 0x6e, 0xb0, 0x22, 0x46, 0x78, 0x6d, 0x76, 0x58, 0x0c, 0xb7, 0x97, 0xba,
+    0xa9, 0xe8, 0xc9, 0x51, 0x66, 0xea, 0x60, 0x67, 0x11, 0x1a, 0x3e, 0x6a, 0x6b, 0xf1, 0x3a, 0x6c,
+    0xc0, 0xd6, 0xeb, 0x53, 0x73, 0x1e, 0x88, 0x75, 0xaa, 0xff, 0x21, 0xfd, 0xe9, 0xce, 0x3d, 0x69,
+    0x61, 0xfe, 0x2f, 0xdf, 0x95, 0x5e, 0x87, 0x13, 0x1d, 0xc6, 0x6b, 0x6d, 0x5e, 0xf4, 0x3f, 0x1d,
+    0xe8, 0x5f, 0x9b, 0x03, 0x4d, 0x39, 0x62, 0x1b, 0xe5, 0x6a, 0xe6, 0x45, 0x9f, 0xfd, 0x0c, 0x2d,
+    0x13, 0xdd, 0x7a, 0x53, 0xcb, 0x14, 0xef, 0x45, 0x47, 0xfb, 0x45, 0x34, 0xb2, 0xbe, 0x06, 0xbf,
+    0x28, 0x1c, 0xec, 0xec, 0xd0, 0x43, 0x8a, 0x88, 0xaa, 0x0e, 0x24, 0x42, 0x27, 0x27, 0xdc, 0x62,
+    0x57, 0x04, 0xb2, 0xa3, 0x2d, 0x0f, 0xab, 0xd5, 0x3e, 0x31, 0x8a, 0x11, 0x16, 0xda, 0x10, 0xd7,
+    0x89, 0x22, 0xcc, 0x82, 0x70, 0xa7, 0xef, 0x81, 0xa7, 0xa1, 0xec, 0xda, 0x2e, 0x58, 0x47, 0x2e,
+    0xba, 0xf9, 0x29, 0xa3, 0x92, 0x11, 0x9c, 0x2c, 0x02, 0x6b, 0x5c, 0xb3, 0x83, 0x4c, 0x12, 0xf0,
+    0x15, 0x64, 0xa7, 0x48, 0x66, 0xc9, 0x5f, 0x6e, 0xa2, 0xdb, 0x46, 0xf7, 0x2b, 0xab, 0x5f, 0x7c,
+    0xdc, 0x3c, 0x7b, 0x22, 0x6a, 0xa6, 0x95, 0x6a, 0x66, 0xc2, 0xd2, 0xff, 0xf8, 0xeb, 0x98, 0xea,
+    0x4e, 0xe8, 0x34, 0xa5, 0xb8, 0x37, 0x6f, 0xbb, 0xf7, 0xcf, 0x45, 0x4c, 0x76, 0x02, 0x5f, 0x67,
+    0x6c, 0xe3, 0x88, 0xfe, 0xeb, 0x98, 0x2e, 0xb8, 0xc9, 0x78, 0xce, 0xf1, 0xe1, 0x71, 0x77, 0xf1,
+    0xcf, 0x51, 0xd3, 0xb5, 0x74, 0x3d, 0x33, 0xa5, 0x6b, 0x95, 0x5f, 0xc9, 0x6c, 0xc9, 0x3c, 0x9b,
+    0x5f, 0x9c, 0xc5, 0x0d, 0xc2, 0x99, 0x4b, 0x11, 0x13, 0xc6, 0xb9, 0x02, 0x37, 0x6b, 0x93, 0xbf,
+    0x8e, 0x09, 0xaf, 0x3c, 0x3b, 0x8f, 0x9a, 0x3d, 0x70, 0x4c, 0xe0, 0xcd, 0xb6, 0x5a, 0x91, 0x8e,
+    0x20, 0x5e, 0xc2, 0x54, 0x25, 0x0f, 0xb3, 0x83, 0xcd, 0x52, 0x7f, 0x78, 0x13, 0xfb, 0xc9, 0x03,
+    0x7a, 0x16, 0xb7, 0x72, 0xef, 0xcb, 0xc6, 0xfb, 0xc7, 0x03, 0x3b, 0x25, 0x3c, 0x7a, 0xcd, 0x14,
+    0x74, 0x4c, 0xe6, 0xb1, 0x13, 0xeb, 0xb3, 0x1c, 0x2d, 0xf6, 0x9f, 0xeb, 0x41, 0x1f, 0x03, 0x53,
+    0x84, 0xde, 0xcb, 0xcf, 0x6e, 0x34, 0x8e, 0xde, 0x8b, 0x38, 0x48, 0x7b, 0x9d, 0xf1, 0xff, 0xe9,
+    0xdc, 0x7d, 0xc5, 0x0b, 0xe0, 0x34, 0x9f, 0x2c, 0xac, 0xdc, 0xbd, 0x11, 0x79, 0x14, 0x88, 0xe9,
+    0x1c, 0xaf, 0xe9, 0x02, 0x5c, 0xf8, 0x51, 0x01, 0x21, 0x77, 0x8f, 0xdd, 0x89, 0x5c, 0x00, 0xdb,
+    0x31, 0x41, 0xba, 0xf5, 0xd7, 0x9b, 0x87, 0xbc, 0x38, 0x0e, 0x0d, 0x5b, 0x44, 0x4a, 0x02, 0xec,
+    0xba, 0xdb, 0x4d, 0x22, 0x10, 0xc9, 0x19, 0x94, 0xe7, 0xb4, 0x99, 0x47, 0x72, 0xda, 0x87, 0xc4,
+    0x24, 0xe9, 0x7b, 0xe1, 0x10, 0x18, 0xcd, 0x98, 0x02, 0x1f, 0x98, 0xa7, 0x50, 0xbd, 0xaa, 0xe3,
+    0x6c, 0x5f, 0x87, 0xd0, 0xf3, 0x7c, 0x9e, 0x9d, 0x11, 0xd6, 0x24, 0x2f, 0x37, 0xe2, 0x42, 0x40,
+    0xda, 0xb6, 0xe0, 0xf5, 0xad, 0x6d, 0x13, 0x48, 0xb1, 0x75, 0xcf, 0xcf, 0x37, 0x6f, 0xdf, 0x57,
+    0x92, 0x7b, 0xf7, 0xee, 0xda, 0x1e, 0x13, 0x69, 0xc0, 0xce, 0x09, 0x7f, 0x16, 0x74, 0x48, 0x21,
+    0xf6, 0x96, 0x4b, 0xac, 0xfc, 0xf8, 0x89, 0x7b, 0xfc, 0x96, 0x48, 0x04, 0x0a, 0x96, 0x6c, 0xff,
+    0x8a, 0x7a, 0x79, 0xd2, 0x99, 0xca, 0x25, 0xfa, 0x7b, 0x5f, 0x9b, 0x23, 0x60, 0x32, 0x8f, 0x0a,
+    0xa0, 0x32, 0x0d, 0xbd, 0xd6, 0x47, 0xbe, 0x7b, 0x1f, 0x36, 0xaf, 0x1f, 0x8d, 0xa6, 0x9b, 0x3f,
+    0x80, 0x47, 0x3b, 0xff, 0x51, 0x2c, 0xfd, 0x28, 0x44, 0x25, 0x09, 0xbe, 0xd2, 0xea, 0xdc, 0xa9,
+    0x94, 0x44, 0xc2, 0x8d, 0xaf, 0xc3, 0xe9, 0x70, 0x85, 0xeb, 0x10, 0xee, 0x11, 0x8c, 0xc3, 0x46,
+    0x3d, 0x22, 0x33, 0x87, 0x3c, 0x26, 0x62, 0x05, 0x5a, 0xf2, 0x86, 0xd2, 0x38, 0x77, 0xbe, 0x79,
+    0xf3, 0xf1, 0xf3, 0xa5, 0xab, 0x34, 0x09, 0x86, 0x4d, 0xf6, 0xfc, 0xd9, 0xc6, 0xa9, 0xf9, 0x95,
+    0xf7, 0x9f, 0x2e, 0x3f, 0x7d, 0x16, 0xce, 0x80, 0x79, 0xbe, 0x74, 0xc6, 0xfd, 0xec, 0xfa, 0xf2,
+    0xa3, 0xc7, 0xab, 0xd7, 0xe6, 0x56, 0xbe, 0x3c, 0x2a, 0xa6, 0xd4, 0xd0, 0x24, 0x9b, 0x4e, 0x53,
+    0x64, 0x24, 0xc5, 0xd4, 0xe7, 0xc7, 0x94, 0x7f, 0x45, 0xfb, 0x6d, 0x5b, 0x3b, 0xac, 0x23, 0x49,
+    0xd9, 0x56, 0x1b, 0xcc, 0xd2, 0xf2, 0xb3, 0xcf, 0xd1, 0x32, 0xfd, 0xf0, 0x80, 0x12, 0xbc, 0x2b,
+    0x36, 0x5f, 0xcc, 0x9f, 0xb7, 0x86, 0x21, 0x45, 0x3f, 0xe8, 0xbd, 0xf6, 0x69, 0x53, 0x00, 0x1b,
+    0xd7, 0x3f, 0x6b, 0x01, 0x93, 0x16, 0x93, 0xb6, 0x74, 0xf0, 0x0c, 0x2c, 0x67, 0xcb, 0x28, 0x9b,
+    0xf5, 0xc5, 0x0f, 0x14, 0x3c, 0xde, 0x3f, 0x7f, 0x0f, 0x78, 0xa6, 0xf9, 0xfe, 0x62, 0xf3, 0xd8,
+    0x0f, 0x6b, 0x0d, 0x30, 0xf0, 0x14, 0xb9, 0x7f, 0x08, 0xbb, 0x73, 0xf1, 0xb6, 0x22, 0x27, 0xf0,
+    0x49, 0x26, 0xc7, 0x9b, 0xca, 0x7a, 0xcd, 0x8e, 0x2f, 0xf8, 0x03, 0x82, 0x5c, 0x07, 0xd4, 0x0e,
+    0x79, 0x2a, 0x47, 0xe4, 0xc8, 0xc4, 0x06, 0x22, 0x32, 0xed, 0x02, 0x6a, 0x03, 0x10, 0xe9, 0x03,
+    0xbf, 0x80, 0xe4, 0xd6, 0xd1, 0xf9, 0x78, 0xbe, 0xd4, 0x40, 0xe0, 0x44, 0x4f, 0x4c, 0xec, 0x20,
+    0xfd, 0x37, 0x51, 0x2d, 0x85, 0x73, 0x68, 0x9e, 0x3a, 0xd9, 0xb8, 0xf6, 0x57, 0x31, 0xa0, 0x99,
+    0xaf, 0x5a, 0x16, 0xac, 0x57, 0x06, 0x98, 0xd3, 0xc6, 0xb0, 0x78, 0xd4, 0x5e, 0x42, 0xb4, 0x11,
+    0xcd, 0xa5, 0x4b, 0x2b, 0xf7, 0x58, 0x9a, 0x93, 0x08, 0x67, 0xbc, 0x6a, 0x14, 0x0b, 0x34, 0xa5,
+    0xa9, 0x1d, 0x08, 0x1a, 0xa4, 0xd9, 0xb5, 0x5d, 0xec, 0xee, 0xf3, 0x14, 0x8b, 0xd2, 0xb4, 0x02,
+    0x12, 0xe5, 0xd6, 0x09, 0x96, 0xcb, 0x83, 0x35, 0x61, 0x14, 0x5f, 0x28, 0xfa, 0xdb, 0x47, 0x04,
+    0xe5, 0x93, 0xa3, 0x0a, 0x3b, 0x6f, 0xa1, 0xfc, 0x73, 0xe9, 0x04, 0xfc, 0xab, 0x24, 0xb3, 0xe3,
+    0x46, 0x39, 0xd5, 0x15, 0x6d, 0xcd, 0xe8, 0x80, 0xd2, 0x7c, 0xe8, 0x23, 0x2d, 0x9f, 0xd7, 0x2b,
+    0x4e, 0x2e, 0x81, 0x9d, 0xd3, 0xd9, 0xc9, 0x23, 0x7f, 0x77, 0x13, 0x25, 0x0a, 0x1f, 0xaa, 0x91,
+    0xc8, 0xed, 0x2a, 0x1e, 0x61, 0x5f, 0xbc, 0x87, 0x27, 0x2c, 0x57, 0x3f, 0xa0, 0xd3, 0x6d, 0x5c,
+    0x5f, 0x72, 0x97, 0xce, 0x0d, 0x29, 0x88, 0xb7, 0xd2, 0x38, 0x79, 0x49, 0x99, 0x3c, 0x62, 0x54,
+    0x14, 0xf7, 0xec, 0x47, 0xcd, 0xa5, 0xaf, 0xa0, 0x11, 0x79, 0x0e, 0xd3, 0x51, 0x92, 0x8d, 0x6b,
+    0x73, 0xee, 0xcd, 0xdb, 0x4a, 0xdf, 0xee, 0xad, 0xa9, 0xce, 0xd7, 0xa7, 0x54, 0x18, 0x7c, 0xf1,
+    0xe5, 0xb9, 0x78, 0x9e, 0x09, 0xb6, 0xb2, 0x7b, 0xfb, 0xe0, 0xf3, 0xa5, 0x93, 0xd4, 0x17, 0x40,
+    0x73, 0x78, 0xe3, 0x1b, 0xf7, 0xc3, 0x2b, 0x60, 0x35, 0x69, 0x0e, 0xea, 0xf2, 0xd2, 0x55, 0xf7,
+    0xda, 0x1d, 0x9a, 0x3d, 0x8a, 0xf9, 0x94, 0xa4, 0x0f, 0x48, 0x51, 0xe3, 0xfa, 0x8d, 0xd5, 0xaf,
+    0xcf, 0x3c, 0x5f, 0x3a, 0xd5, 0xd5, 0xce, 0xa3, 0x93, 0xf1, 0x15, 0xbd, 0xb5, 0xbe, 0x80, 0x8f,
+    0xd2, 0xdf, 0xa7, 0x2c, 0x3f, 0x9d, 0x77, 0xe7, 0x8f, 0xba, 0xc7, 0x17, 0x57, 0x9e, 0x7d, 0xe6,
+    0x9e, 0x7c, 0xb0, 0xfe, 0x85, 0x46, 0x42, 0x98, 0x65, 0x53, 0x20, 0xcd, 0xcb, 0xf7, 0x4e, 0xd6,
+    0x93, 0x39, 0x3c, 0xd2, 0xc5, 0x52, 0x82, 0x57, 0x16, 0xbf, 0x74, 0x3f, 0x3e, 0x0d, 0xce, 0x8b,
+    0xa8, 0x6f, 0x61, 0x55, 0xc0, 0x49, 0xa1, 0xbe, 0x89, 0xd2, 0x07, 0x5a, 0xde, 0x3d, 0xf9, 0xe1,
+    0xea, 0x85, 0x05, 0x4c, 0x04, 0xbe, 0xb6, 0x00, 0x2a, 0x04, 0x73, 0x7e, 0x3f, 0x7a, 0xd6, 0xb8,
+    0xb4, 0xd8, 0xbc, 0xf8, 0x37, 0xe0, 0x2f, 0xf7, 0xf8, 0x77, 0xab, 0x97, 0x17, 0x1b, 0x7f, 0x3b,
+    0xb7, 0x72, 0xfb, 0x24, 0xb8, 0x38, 0xe0, 0xbb, 0x30, 0x30, 0x77, 0xcf, 0x34, 0x4e, 0x9e, 0xf7,
+    0xd6, 0xd4, 0xbd, 0xff, 0xe1, 0xca, 0x89, 0xaf, 0xdd, 0xd3, 0x77, 0xa8, 0x25, 0x8b, 0x71, 0x71,
+    0xb8, 0x8e, 0xee, 0x13, 0xdc, 0x18, 0x1a, 0x63, 0xc1, 0xc3, 0xf1, 0xcc, 0xb8, 0x13, 0x3a, 0x24,
+    0x65, 0x19, 0x24, 0xed, 0x7c, 0x9a, 0xfe, 0xd6, 0x09, 0x28, 0x9b, 0x5e, 0x61, 0x02, 0x8a, 0x52,
+    0x30, 0x6c, 0x6d, 0xbc, 0xa8, 0x17, 0x86, 0xd8, 0x3d, 0x1c, 0x5c, 0x1b, 0xef, 0x19, 0x3b, 0xce,
+    0x29, 0x9b, 0x4e, 0x46, 0xc3, 0x05, 0xd2, 0x0b, 0xa2, 0xf7, 0x83, 0x6e, 0xc0, 0x4e, 0xc6, 0xcb,
+    0xfb, 0xc9, 0x91, 0x12, 0x1e, 0x01, 0xf2, 0xce, 0x28, 0x53, 0x57, 0xe7, 0x60, 0x97, 0x3b, 0xe7,
+    0xde, 0xfe, 0x48, 0x5c, 0x42, 0xd1, 0x3d, 0xe0, 0x76, 0x93, 0x91, 0xb0, 0x62, 0x99, 0x93, 0xe0,
+    0x5f, 0x44, 0x1d, 0xc8, 0x09, 0xeb, 0x30, 0x2d, 0x5f, 0xff, 0x10, 0x0d, 0x20, 0x3b, 0xaf, 0xea,
+    0x17, 0xb3, 0xac, 0x39, 0xd0, 0xcc, 0xb8, 0xe6, 0x67, 0xc3, 0x70, 0x9b, 0x8a, 0x4b, 0x03, 0xed,
+    0x65, 0x00, 0x02, 0x95, 0x60, 0xda, 0x0a, 0x3f, 0xe2, 0x45, 0xa9, 0x4a, 0x28, 0xe4, 0xd6, 0x11,
+    0xbb, 0xcf, 0x36, 0xa4, 0xf4, 0xbc, 0x99, 0x18, 0x89, 0x70, 0x6b, 0x62, 0xef, 0xdb, 0x6c, 0x0c,
+    0x27, 0x37, 0xf4, 0x25, 0xc4, 0x80, 0x9d, 0x87, 0x2d, 0xd1, 0x17, 0x23, 0xee, 0x89, 0x0f, 0x51,
+    0xe7, 0xb4, 0x8a, 0xc4, 0x45, 0x84, 0x20, 0xf9, 0x0d, 0x95, 0x8a, 0xc3, 0x2e, 0x2e, 0xc5, 0x7b,
+    0x04, 0xde, 0xbd, 0x28, 0xaa, 0x08, 0xe9, 0x12, 0xad, 0xdc, 0xfb, 0xbe, 0xf1, 0xe7, 0xb3, 0xcc,
+    0x17, 0xa8, 0x16, 0x5b, 0x4f, 0x87, 0x8b, 0x05, 0x39, 0xb0, 0x2b, 0x1a, 0x23, 0x3f, 0xcd, 0x7d,
+    0xa1, 0x34, 0x6f, 0xdc, 0x05, 0x57, 0x98, 0x0a, 0x17, 0x75, 0x85, 0x9b, 0x77, 0xbe, 0x83, 0x9d,
+    0x06, 0xe8, 0x78, 0x14, 0xcc, 0xc7, 0xe7, 0x41, 0x47, 0x1a, 0x7e, 0x73, 0x6a, 0x17, 0x1b, 0x8b,
+    0x7f, 0x81, 0x7e, 0xd0, 0x44, 0x34, 0x90, 0xc4, 0x3e, 0x52, 0xb3, 0x91, 0x92, 0x3b, 0x31, 0x54,
+    0x9f, 0x9d, 0x68, 0xde, 0xc1, 0x8b, 0x3e, 0xa2, 0xe4, 0x47, 0x35, 0x0c, 0x88, 0x3c, 0xa8, 0x71,
+    0x51, 0xe4, 0xe5, 0x1e, 0xee, 0x97, 0xc7, 0x56, 0x8f, 0x9e, 0x58, 0xbd, 0x7c, 0x77, 0xf5, 0x8b,
+    0x3f, 0xa3, 0x1d, 0x20, 0x4d, 0x68, 0xbf, 0xc6, 0xd1, 0x2f, 0xdc, 0x9b, 0xf3, 0xac, 0x79, 0x77,
+    0xb5, 0xd8, 0xc6, 0xc7, 0x0d, 0xfc, 0x61, 0x57, 0x81, 0x02, 0x0e, 0x30, 0x2c, 0x87, 0x93, 0x61,
+    0x09, 0xf8, 0x66, 0x41, 0x2b, 0x7a, 0x5c, 0x3a, 0x61, 0xcc, 0xe8, 0x05, 0xc5, 0x28, 0xa3, 0x3c,
+    0xf7, 0x78, 0x0c, 0x4f, 0x52, 0x79, 0x41, 0xce, 0x7d, 0x81, 0xe5, 0xce, 0x71, 0xe8, 0x88, 0x9f,
+    0x9f, 0xb6, 0xb2, 0xaf, 0x47, 0x98, 0xeb, 0xdb, 0xea, 0x2a, 0x12, 0x28, 0x6a, 0x72, 0x77, 0x8d,
+    0xbb, 0xd4, 0x4c, 0xda, 0x4a, 0xa8, 0xa1, 0xf0, 0xe1, 0x54, 0xc6, 0xce, 0x5b, 0x78, 0x72, 0x1b,
+    0x48, 0xe7, 0x5a, 0xeb, 0x45, 0x37, 0xe6, 0x0b, 0xb7, 0xf7, 0xc3, 0x83, 0xf1, 0xcb, 0x6b, 0xe7,
+    0x48, 0xae, 0x0d, 0xf8, 0x8d, 0x3f, 0x7e, 0x1c, 0xcc, 0x44, 0x63, 0x5a, 0x59, 0x48, 0xaa, 0x33,
+    0x6d, 0x7d, 0x07, 0x90, 0x77, 0x37, 0xd2, 0x55, 0xc8, 0x50, 0xf0, 0x81, 0x0e, 0xa0, 0x06, 0x20,
+    0xea, 0x56, 0x62, 0x6b, 0x22, 0x94, 0x87, 0x27, 0x7d, 0x9d, 0xb3, 0x11, 0xf4, 0xc4, 0xc6, 0x84,
+    0x02, 0xfe, 0x57, 0x31, 0x97, 0x40, 0x05, 0x8c, 0xaa, 0xc0, 0x32, 0x0f, 0xe9, 0x9e, 0xcf, 0xbb,
+    0x0d, 0x35, 0x6a, 0x42, 0xc1, 0xcb, 0xaf, 0x5b, 0xcd, 0x99, 0x5c, 0xa2, 0x47, 0xe9, 0x51, 0xfa,
+    0x06, 0xe0, 0x3f, 0x84, 0x55, 0xd1, 0x9c, 0x29, 0xd6, 0x21, 0x83, 0x3a, 0x3c, 0xaf, 0x55, 0x60,
+    0x2f, 0x85, 0x34, 0x4f, 0x88, 0x8f, 0xff, 0x60, 0xe2, 0x19, 0xbe, 0xfc, 0x9c, 0x5e, 0x9d, 0x4d,
+    0x80, 0x73, 0x00, 0xbc, 0xb2, 0x7b, 0xa3, 0xd2, 0xbb, 0xf9, 0x9d, 0xde, 0xcd, 0xca, 0x46, 0xf8,
+    0xb4, 0xb1, 0xd8, 0xdb, 0xa7, 0xf4, 0x92, 0x4b, 0x67, 0x08, 0x1f, 0x39, 0x0b, 0x70, 0x1e, 0x69,
+    0x91, 0x22, 0x28, 0xb2, 0xda, 0x4b, 0x8d, 0x8c, 0x09, 0x80, 0x5f, 0x61, 0x3e, 0x52, 0xcc, 0x28,
+    0xaf, 0x4d, 0x4e, 0x92, 0x80, 0xdf, 0x3a, 0xae, 0x7e, 0xb0, 0xd3, 0xfa, 0x8e, 0xae, 0x7e, 0xc4,
+    0x8d, 0xf8, 0x4b, 0x87, 0xfb, 0x04, 0xbc, 0x7e, 0x81, 0x6b, 0x1f, 0x91, 0xa3, 0xff, 0x5a, 0xee,
+    0x7e, 0x08, 0x93, 0xfb, 0x3b, 0x5e, 0x00, 0x89, 0x1a, 0xf5, 0x35, 0xbd, 0x05, 0x22, 0x6a, 0x89,
+    0xd8, 0xac, 0x35, 0xb4, 0x0a, 0xff, 0xb8, 0xd7, 0x41, 0x02, 0x53, 0xec, 0x2c, 0x93, 0x2d, 0xd0,
+    0xe9, 0xe5, 0x67, 0xb3, 0x05, 0x06, 0x78, 0xc1, 0xc4, 0xb6, 0x68, 0x34, 0xd7, 0x96, 0xdc, 0x26,
+    0xae, 0xee, 0x3f, 0xb3, 0xdc, 0xc2, 0x08, 0x72, 0x49, 0xea, 0xf7, 0xf6, 0x08, 0x72, 0x7c, 0x1a,
+    0x1b, 0x65, 0x7a, 0xff, 0x81, 0xe3, 0xf2, 0x64, 0xf1, 0x91, 0x0b, 0x82, 0xc1, 0xf9, 0xe5, 0x67,
+    0x77, 0x1b, 0x17, 0x7f, 0x88, 0x8f, 0xcc, 0xfb, 0x33, 0xf7, 0x24, 0x5a, 0x16, 0x80, 0xb5, 0x4c,
+    0xdd, 0xf3, 0x30, 0xd7, 0x39, 0x71, 0x3f, 0x31, 0xbe, 0xe5, 0x0d, 0x92, 0x80, 0xb3, 0x3b, 0xd2,
+    0xf5, 0xd3, 0xe7, 0x67, 0x14, 0xf7, 0xdc, 0xa5, 0xc6, 0x83, 0x93, 0x9d, 0x06, 0xe5, 0xc5, 0xe2,
+    0x2a, 0xdd, 0x79, 0xb3, 0x54, 0x32, 0xcb, 0xd9, 0xc1, 0x42, 0xef, 0xe6, 0x8d, 0xda, 0xe0, 0xa6,
+    0xec, 0x1f, 0x6c, 0xb9, 0xa8, 0x0a, 0xfb, 0x50, 0xd4, 0x1d, 0x85, 0xf9, 0xc0, 0xdb, 0x35, 0x47,
+    0xcb, 0xd5, 0xba, 0xe8, 0x25, 0xf5, 0xa1, 0x03, 0x07, 0xd3, 0x5d, 0x78, 0x1b, 0x81, 0x7c, 0xa0,
+    0x79, 0x84, 0xbb, 0xca, 0x13, 0xe6, 0x50, 0x19, 0x04, 0xae, 0xab, 0x3e, 0x4c, 0x3a, 0x1a, 0xf6,
+    0x3b, 0xf4, 0x6a, 0x01, 0xe9, 0x3a, 0xa1, 0x15, 0x6d, 0x7d, 0xb8, 0x0b, 0xf4, 0x99, 0xed, 0xb0,
+    0xc2, 0x04, 0xfb, 0xb4, 0xf1, 0x6d, 0xb8, 0x34, 0xba, 0x9d, 0x3b, 0xa0, 0xd2, 0x47, 0x6a, 0x5a,
+    0x0d, 0xe8, 0x66, 0x78, 0x22, 0xad, 0x8b, 0x7a, 0x90, 0x03, 0x31, 0xca, 0x11, 0x60, 0x24, 0x39,
+    0x84, 0xbe, 0xc1, 0x0d, 0x00, 0xac, 0xb3, 0x0f, 0x01, 0xf3, 0x65, 0xa4, 0xde, 0x18, 0xb2, 0x81,
+    0x4e, 0xb8, 0xea, 0x1c, 0x13, 0xbb, 0xc4, 0x31, 0xa0, 0x4a, 0x93, 0x3f, 0xa7, 0x86, 0x0b, 0xbe,
+    0xf1, 0x90, 0x7d, 0xa6, 0xcf, 0xff, 0x42, 0x16, 0xb3, 0xa2, 0x21, 0xdd, 0xb0, 0x7d, 0x70, 0x69,
+    0xe1, 0x19, 0x11, 0x36, 0x2a, 0xab, 0x65, 0x73, 0xda, 0xd2, 0x2a, 0x88, 0x55, 0x01, 0xf8, 0xa2,
+    0x04, 0x7d, 0xb2, 0x5a, 0xa1, 0xb0, 0xe3, 0x30, 0x7c, 0x78, 0xc7, 0x00, 0xca, 0x96, 0x75, 0x2b,
+    0xa9, 0x6e, 0xdf, 0xb3, 0x7b, 0x1b, 0x3d, 0x30, 0x41, 0xa2, 0xea, 0x05, 0x35, 0x3d, 0x51, 0x2d,
+    0x93, 0xf2, 0x1c, 0xc9, 0x54, 0xcd, 0xef, 0xf8, 0xc7, 0xaa, 0x6e, 0xcd, 0xee, 0x25, 0xce, 0xac,
+    0x89, 0x77, 0x8e, 0x92, 0x2a, 0x56, 0xac, 0x51, 0x53, 0x59, 0x30, 0x13, 0x3b, 0xb4, 0xfc, 0x54,
+    0x12, 0xbe, 0xe5, 0x46, 0x60, 0x19, 0xb5, 0xf1, 0x2c, 0x11, 0x0b, 0x1c, 0x01, 0x87, 0x4b, 0x66,
+    0xb3, 0x59, 0x99, 0x1c, 0xa9, 0xe1, 0x2e, 0x63, 0x22, 0xf9, 0x86, 0xdc, 0x92, 0xdd, 0x3e, 0xb2,
+    0x93, 0x7c, 0xbd, 0x52, 0xa9, 0x18, 0x60, 0xe1, 0xd5, 0x01, 0x80, 0xf5, 0xae, 0x3a, 0xfc, 0x0b,
+    0x42, 0xb0, 0x8d, 0x32, 0x15, 0xca, 0xf2, 0x16, 0x7b, 0xbb, 0x3e, 0xa1, 0x55, 0x8b, 0x20, 0xcf,
+    0xc0, 0x37, 0x30, 0x39, 0x64, 0x17, 0xfc, 0x4c, 0xc2, 0x50, 0xa3, 0x66, 0x11, 0x04, 0x6b, 0x12,
+    0xbf, 0x63, 0x57, 0x3e, 0x69, 0x25, 0x16, 0x46, 0x8d, 0xad, 0x2d, 0x50, 0x35, 0x57, 0xd6, 0xa7,
+    0x95, 0xed, 0x24, 0x7a, 0xc5, 0x57, 0x7c, 0xca, 0x04, 0x0d, 0x9f, 0xdb, 0xeb, 0xa0, 0xec, 0x25,
+    0xa1, 0x49, 0x76, 0x52, 0x77, 0xde, 0xc6, 0x67, 0xc9, 0x54, 0x2a, 0x5b, 0xd1, 0x0a, 0x7b, 0x71,
+    0xcc, 0x64, 0x5f, 0x5a, 0xed, 0x51, 0xbd, 0x3e, 0x60, 0x9f, 0xaa, 0xb0, 0x56, 0x81, 0x5e, 0xbb,
+    0xe9, 0xd3, 0x16, 0xfd, 0xf2, 0x3e, 0x7e, 0xb9, 0xb1, 0x0d, 0x35, 0x32, 0x74, 0x7d, 0x68, 0x43,
+    0x8d, 0xc1, 0xab, 0x8f, 0x09, 0x0b, 0x0e, 0x00, 0x77, 0x14, 0x75, 0xfc, 0xb8, 0x75, 0x76, 0x57,
+    0x81, 0x55, 0xe7, 0x20, 0xa6, 0x12, 0xd6, 0x8e, 0x5a, 0x43, 0x01, 0x1c, 0x12, 0xd2, 0xa7, 0x84,
+    0x44, 0xa6, 0x5a, 0x97, 0x66, 0xcf, 0x96, 0xf3, 0x8a, 0xf7, 0xba, 0x02, 0x6f, 0xf0, 0x31, 0xae,
+    0xa5, 0x24, 0x91, 0xd8, 0x74, 0x5a, 0x33, 0x1c, 0x45, 0xa4, 0x79, 0x1d, 0x17, 0x07, 0x87, 0x00,
+    0x85, 0x96, 0xc4, 0xae, 0x69, 0x10, 0xa3, 0x1e, 0xf2, 0x82, 0x02, 0x92, 0x87, 0xf6, 0xaa, 0x61,
+    0x00, 0x0b, 0xbc, 0xab, 0x95, 0xf4, 0x34, 0x51, 0x58, 0x7a, 0x01, 0x1e, 0xb5, 0xe7, 0x4a, 0x7e,
+    0x02, 0x28, 0x70, 0x27, 0x2f, 0x2a, 0x35, 0xc2, 0xcb, 0x4b, 0x05, 0xf8, 0x4a, 0xa5, 0xde, 0x0f,
+    0x70, 0xdd, 0xf0, 0x7a, 0x79, 0xde, 0xd2, 0x4b, 0xa0, 0x1a, 0x90, 0x53, 0x83, 0x7c, 0x9a, 0xf6,
+    0x78, 0x7b, 0x78, 0x2d, 0xac, 0x9d, 0x8a, 0x5f, 0x4e, 0x46, 0x1d, 0xe5, 0xb7, 0x8a, 0x2a, 0x4c,
+    0x3a, 0x84, 0x8b, 0x37, 0x3b, 0xe0, 0x20, 0x8f, 0x8e, 0xe1, 0xe1, 0x23, 0x06, 0x8f, 0x6c, 0xee,
+    0xcf, 0x30, 0x12, 0x61, 0x60, 0x08, 0x86, 0x57, 0x2e, 0x97, 0xe3, 0x55, 0x56, 0x60, 0xd5, 0x90,
+    0x1d, 0xf6, 0x7a, 0x1a, 0x9d, 0xae, 0x78, 0x3d, 0xc8, 0x55, 0x3e, 0xcf, 0x10, 0xce, 0x0a, 0x32,
+    0x96, 0xa5, 0x3b, 0x55, 0xab, 0x8c, 0x3d, 0x65, 0x23, 0xe0, 0x58, 0x55, 0x60, 0x5e, 0xc7, 0x9a,
+    0x65, 0x52, 0x7a, 0x80, 0x96, 0x16, 0x7a, 0x0f, 0x88, 0x4e, 0x0d, 0x0b, 0x7e, 0x42, 0xbb, 0x02,
+    0x7f, 0x0f, 0xe6, 0x28, 0x7b, 0x8e, 0x5a, 0x66, 0xc9, 0xb0, 0xf5, 0xac, 0x06, 0x2b, 0x7b, 0xa0,
+    0x6b, 0x42, 0x07, 0x8e, 0x4b, 0xaa, 0xdd, 0x5a, 0xc5, 0xe8, 0xa6, 0x9d, 0xd5, 0x54, 0x5a, 0x7a,
+    0xca, 0x0a, 0xdb, 0x04, 0x9e, 0x22, 0x50, 0x35, 0xd5, 0x75, 0xd0, 0x93, 0x4e, 0xda, 0x99, 0x8d,
+    0xe1, 0xa1, 0x01, 0x86, 0x10, 0x35, 0x2a, 0x6f, 0x44, 0x61, 0xb1, 0x46, 0x1e, 0x86, 0x81, 0x46,
+    0x08, 0x9a, 0x35, 0x61, 0xa8, 0xfb, 0x0d, 0x7c, 0xdb, 0x99, 0x65, 0xb0, 0xe8, 0x1f, 0xf9, 0x15,
+    0x81, 0x80, 0xff, 0x0c, 0x77, 0x51, 0x27, 0x77, 0x2f, 0xc1, 0x27, 0x49, 0xd1, 0x4a, 0xf1, 0xa7,
+    0xf4, 0x02, 0x29, 0xae, 0x6d, 0xd2, 0x7b, 0x36, 0x0a, 0xbd, 0x42, 0x4f, 0xa8, 0x30, 0xd8, 0x49,
+    0xba, 0xca, 0xb1, 0x4a, 0x46, 0xce, 0xff, 0x07, 0x8e, 0xa4, 0x0e, 0xca, 0x28, 0xb1, 0x5b, 0xca,
+    0x1b, 0xb9, 0x1c, 0x5a, 0x73, 0x49, 0x4d, 0x84, 0xf8, 0x22, 0xaf, 0x21, 0x89, 0x75, 0xcb, 0x32,
+    0x2d, 0xa6, 0x79, 0xcd, 0xa2, 0x9e, 0x25, 0xdf, 0x93, 0x2a, 0x3d, 0x98, 0x6d, 0x7c, 0x7a, 0xbf,
+    0x31, 0x7f, 0xd7, 0xbd, 0xf9, 0x9f, 0x2b, 0xdf, 0xdf, 0x1a, 0x52, 0xd3, 0xb4, 0x6d, 0x0b, 0xd5,
+    0x17, 0x2a, 0x3c, 0x05, 0x88, 0x19, 0xf0, 0xc8, 0x7a, 0x7b, 0xdf, 0xee, 0x77, 0x72, 0x63, 0x2f,
+    0xa3, 0xb8, 0x14, 0xbf, 0xfc, 0xeb, 0xdd, 0x1e, 0x16, 0x72, 0x63, 0x29, 0xa2, 0xcc, 0xd9, 0x06,
+    0x15, 0x5d, 0x9f, 0x00, 0xe9, 0x29, 0x16, 0x81, 0x63, 0x23, 0xfd, 0x99, 0x18, 0xd9, 0x10, 0x09,
+    0x55, 0x13, 0x18, 0x5e, 0xb1, 0xc0, 0xe8, 0xc3, 0x07, 0x9d, 0x31, 0x8c, 0xc4, 0xce, 0x4c, 0x04,
+    0x3d, 0x0e, 0xf5, 0x60, 0xb0, 0xc6, 0xbc, 0x6f, 0x24, 0x7b, 0x09, 0xad, 0xfd, 0x8f, 0x1e, 0x3f,
+    0xf9, 0xe8, 0xf8, 0x2f, 0x71, 0x05, 0x3b, 0x58, 0x3f, 0x5a, 0x6f, 0x89, 0x26, 0x11, 0x84, 0x56,
+    0xb1, 0x2e, 0x9a, 0x83, 0x28, 0xde, 0xad, 0x49, 0xe2, 0xc6, 0x16, 0x3a, 0xb7, 0x96, 0xc5, 0xf7,
+    0x7c, 0xc6, 0xca, 0xbb, 0xa4, 0xc4, 0x51, 0x7c, 0x67, 0xb9, 0x14, 0x92, 0x2a, 0x4b, 0xf1, 0x7b,
+    0x58, 0xc2, 0x4f, 0x2f, 0xa0, 0x8b, 0xe8, 0x15, 0xe7, 0x41, 0xdf, 0x2c, 0xe2, 0x66, 0x35, 0xba,
+    0x62, 0x20, 0x37, 0x14, 0x81, 0x2c, 0xa6, 0x9a, 0x6d, 0xa3, 0x68, 0xe9, 0x05, 0x98, 0x8f, 0x34,
+    0x93, 0x97, 0xcd, 0x99, 0x93, 0x18, 0x80, 0x17, 0xeb, 0x9e, 0xe1, 0x57, 0x16, 0x1d, 0x3f, 0x4e,
+    0xb2, 0xbc, 0x86, 0x94, 0x0d, 0x35, 0x86, 0x19, 0xec, 0xeb, 0xb5, 0xe2, 0xae, 0xd1, 0xba, 0xcf,
+    0xac, 0x9c, 0x46, 0x71, 0x66, 0x73, 0xb8, 0x4b, 0xa4, 0x85, 0x67, 0x20, 0x61, 0x6f, 0x3e, 0xa2,
+    0xc4, 0x91, 0xd5, 0x28, 0xa4, 0xb2, 0xe4, 0x68, 0x2c, 0xcb, 0xce, 0x25, 0x72, 0xbd, 0xb8, 0xf0,
+    0x3a, 0xb0, 0xff, 0x2b, 0x26, 0x06, 0x3b, 0x3b, 0xf6, 0xa8, 0xe1, 0x1f, 0x3e, 0xb3, 0x3c, 0xd1,
+    0x2d, 0xa3, 0x02, 0x35, 0xb4, 0x4a, 0x3b, 0x52, 0x84, 0xcd, 0xec, 0xcb, 0xa0, 0x06, 0x60, 0x4e,
+    0x04, 0xc1, 0xe7, 0x35, 0x2a, 0x84, 0x14, 0xab, 0x29, 0xcd, 0xfe, 0x9d, 0x56, 0x34, 0x48, 0xfd,
+    0x03, 0xe5, 0x5f, 0x95, 0x31, 0x92, 0x64, 0xee, 0xe1, 0x2c, 0xf8, 0x74, 0xf5, 0xb1, 0xa1, 0x31,
+    0x21, 0x03, 0xbd, 0x71, 0xed, 0x6b, 0x9a, 0x95, 0xd7, 0xca, 0x4b, 0x14, 0xea, 0xdb, 0xc9, 0x4a,
+    0x72, 0x43, 0x8d, 0xe3, 0x51, 0x57, 0xfe, 0xa4, 0x34, 0xbe, 0x7f, 0xb2, 0xf2, 0xf0, 0x7d, 0xef,
+    0x44, 0x45, 0xa4, 0x19, 0x75, 0x0b, 0x88, 0x5d, 0x51, 0xfe, 0xf4, 0x27, 0xa5, 0x07, 0x9d, 0xd2,
+    0x90, 0x44, 0x8b, 0x76, 0x87, 0xcb, 0x33, 0x4a, 0x4c, 0xae, 0x8d, 0xfb, 0x8a, 0x6d, 0x54, 0x6a,
+    0x83, 0xc2, 0x86, 0x30, 0xcb, 0x72, 0x23, 0x72, 0xb9, 0x1e, 0x74, 0x3a, 0x70, 0x7d, 0xfc, 0x09,
+    0xa8, 0xa1, 0xb3, 0xd6, 0x16, 0x97, 0xd1, 0x1b, 0x57, 0x8f, 0x35, 0x2e, 0x5f, 0x17, 0x0e, 0x8c,
+    0x70, 0xbf, 0xab, 0x0e, 0x0b, 0x4e, 0x48, 0x00, 0x7a, 0x04, 0x32, 0x25, 0xad, 0x92, 0x4c, 0x92,
+    0xcf, 0x69, 0xd8, 0x7a, 0xea, 0x33, 0x29, 0x74, 0x18, 0x45, 0xcd, 0xb5, 0x0f, 0xc6, 0xa4, 0xb6,
+    0x3b, 0x6b, 0xd8, 0x5b, 0x08, 0xd9, 0x60, 0x39, 0xd5, 0x9f, 0x17, 0x2e, 0x7e, 0xaf, 0xd0, 0x9b,
+    0x1a, 0xcb, 0x8f, 0x16, 0xd5, 0x21, 0x0a, 0x23, 0xab, 0x97, 0xc9, 0x49, 0x39, 0xb6, 0xc0, 0xac,
+    0xfc, 0xe6, 0xe2, 0x29, 0xf7, 0xc7, 0xe3, 0xa4, 0x01, 0x7c, 0x7f, 0x84, 0xa7, 0x5c, 0xee, 0xc3,
+    0x6f, 0x9b, 0x5f, 0x1e, 0x6d, 0x5e, 0xbc, 0xa3, 0x06, 0x3c, 0x12, 0x72, 0xd6, 0x14, 0x31, 0x92,
+    0x67, 0xab, 0x70, 0x4f, 0x1c, 0x31, 0x8e, 0x9f, 0xc5, 0x45, 0x1a, 0x04, 0x36, 0xc2, 0xfe, 0xa6,
+    0x44, 0xb3, 0x0a, 0x5b, 0xc9, 0x26, 0x35, 0x62, 0x0c, 0xb6, 0x7b, 0xc5, 0x51, 0xfa, 0xa3, 0x47,
+    0x11, 0xf3, 0xd3, 0x48, 0x13, 0x35, 0x70, 0xe9, 0x05, 0x47, 0xa2, 0x84, 0x57, 0xc6, 0x22, 0x8e,
+    0xae, 0x81, 0xf5, 0x7c, 0x0c, 0xea, 0xf2, 0xd1, 0xe4, 0x00, 0x3d, 0xe6, 0x24, 0x61, 0x1a, 0xd8,
+    0x27, 0x63, 0x9e, 0x29, 0xf9, 0x6c, 0x99, 0xd3, 0x31, 0xe7, 0x8d, 0x64, 0xeb, 0x83, 0xed, 0x24,
+    0xa5, 0x12, 0x38, 0xe4, 0xa7, 0x11, 0x00, 0x16, 0xd6, 0xf7, 0x43, 0x38, 0x52, 0x00, 0x1f, 0x63,
+    0x41, 0x1b, 0x6a, 0x6f, 0x84, 0xa6, 0xcb, 0x4f, 0x62, 0x37, 0xe2, 0x4c, 0xd5, 0x7a, 0xeb, 0x5b,
+    0x8f, 0x7d, 0x72, 0x66, 0x6c, 0xbf, 0x9c, 0xb2, 0xbf, 0x91, 0x24, 0xca, 0x62, 0x38, 0x09, 0xff,
+    0xce, 0xf2, 0xcc, 0x2a, 0xbb, 0xc4, 0xce, 0x61, 0x83, 0xc1, 0xc6, 0x88, 0x82, 0xa0, 0x78, 0x98,
+    0xef, 0x57, 0xfa, 0xc0, 0xd1, 0xfc, 0x3a, 0x74, 0x44, 0x23, 0xf2, 0xab, 0x07, 0x0a, 0x95, 0x7f,
+    0x0b, 0x1d, 0xcb, 0x7a, 0x67, 0xc7, 0x12, 0xc8, 0xa6, 0xbc, 0x17, 0xee, 0x54, 0xb3, 0x8e, 0xc9,
+    0xf6, 0xbb, 0xa1, 0xfd, 0x2d, 0xee, 0x61, 0x69, 0x43, 0xba, 0x93, 0x6d, 0xd5, 0xb4, 0xd3, 0xc1,
+    0xbf, 0xf3, 0x06, 0xe7, 0xa7, 0x3a, 0xf5, 0xe6, 0xed, 0x0b, 0x9d, 0xf5, 0xe6, 0x3d, 0xe9, 0xe1,
+    0xc5, 0x76, 0xcd, 0x28, 0xce, 0x32, 0xd1, 0xfc, 0x40, 0xa1, 0xe7, 0x13, 0xb0, 0x78, 0x40, 0x9d,
+    0xe3, 0x8a, 0x3b, 0xff, 0x69, 0xe3, 0xaf, 0x37, 0xd4, 0xfa, 0xda, 0xe0, 0x1a, 0x36, 0xc6, 0xc4,
+    0x89, 0xee, 0xbe, 0x78, 0x5b, 0xc1, 0xcf, 0x1b, 0x6a, 0xbb, 0x35, 0x67, 0x2a, 0x4b, 0xb8, 0x97,
+    0xa9, 0x8d, 0x6c, 0x65, 0xba, 0xf4, 0x3b, 0xdc, 0xa7, 0x2b, 0xdd, 0x0a, 0xc6, 0xb0, 0x53, 0xff,
+    0x03, 0xfe, 0xf4, 0xa4, 0xea, 0x6f, 0x8e, 0xe1, 0xd8, 0x17, 0xcf, 0x28, 0xe0, 0x06, 0xbb, 0x8b,
+    0x97, 0x3b, 0x1b, 0x3b, 0x10, 0x89, 0xe4, 0xea, 0x9a, 0xa8, 0x86, 0x3a, 0x22, 0xe6, 0xeb, 0xa4,
+    0x7a, 0x87, 0xe1, 0xe0, 0x3e, 0x52, 0x6d, 0x03, 0x79, 0xa6, 0x84, 0x19, 0x07, 0xf8, 0xb7, 0xc8,
+    0x24, 0x2e, 0x63, 0x4f, 0xc1, 0xea, 0x1d, 0xca, 0x04, 0x13, 0x08, 0x78, 0xd1, 0xe3, 0x40, 0x52,
+    0x14, 0x3f, 0x63, 0x2e, 0x57, 0x33, 0x1b, 0x6a, 0x44, 0x59, 0xd6, 0x43, 0xc5, 0x55, 0x43, 0x91,
+    0xd4, 0x5e, 0x34, 0xf5, 0xfd, 0x62, 0x24, 0x35, 0xba, 0xc6, 0xeb, 0x26, 0xef, 0xcc, 0x5e, 0x8c,
+    0xd8, 0xb7, 0x8a, 0x8d, 0x0a, 0xe5, 0xbf, 0x76, 0x03, 0x4e, 0x49, 0x8e, 0x13, 0x09, 0x92, 0xd2,
+    0xea, 0x1d, 0x8d, 0x4f, 0xe6, 0x97, 0x9f, 0x5e, 0x8b, 0xca, 0x4e, 0x62, 0x07, 0x89, 0x96, 0x59,
+    0x01, 0xe5, 0x50, 0x0e, 0xcf, 0x87, 0xd7, 0x71, 0x56, 0x48, 0x69, 0xdb, 0x0c, 0x0d, 0xec, 0x83,
+    0xc0, 0xf6, 0x93, 0x13, 0x05, 0x39, 0xbd, 0xc2, 0x3f, 0x3b, 0x8c, 0xbd, 0x11, 0xa8, 0x1c, 0x41,
+    0xf3, 0xe5, 0x9f, 0xe0, 0x44, 0x66, 0x8e, 0xd3, 0x5c, 0x09, 0x7d, 0xc2, 0xa1, 0x24, 0xab, 0xcc,
+    0x0a, 0x49, 0x98, 0x32, 0x69, 0x06, 0x7b, 0x3c, 0xa9, 0x09, 0x1a, 0x02, 0x9a, 0xf1, 0xbd, 0x59,
+    0xb4, 0x04, 0xcc, 0x93, 0x04, 0x2d, 0x16, 0x49, 0x3c, 0x9f, 0x70, 0xc3, 0x88, 0x61, 0x34, 0x45,
+    0x23, 0x86, 0xfb, 0x79, 0xe1, 0xea, 0x37, 0x0a, 0x33, 0x65, 0x60, 0xdd, 0xc0, 0x4b, 0xa5, 0x19,
+    0x94, 0xc8, 0xe9, 0xad, 0x53, 0xe4, 0xd7, 0x34, 0x51, 0x29, 0xc9, 0x59, 0x98, 0x81, 0xce, 0x8f,
+    0x83, 0x3a, 0xc2, 0x9f, 0xa5, 0x98, 0xd0, 0x93, 0x82, 0x97, 0x8f, 0x1f, 0xdf, 0x4a, 0xfa, 0xe8,
+    0x15, 0x60, 0x27, 0xee, 0xac, 0x81, 0xc0, 0x3f, 0x2f, 0x5c, 0xfe, 0x98, 0xb8, 0x07, 0x27, 0xaf,
+    0xaf, 0x5e, 0xb9, 0xd9, 0x51, 0x64, 0x1f, 0x3d, 0xb6, 0x54, 0x16, 0xd3, 0x4b, 0x92, 0xaa, 0x9a,
+    0x8a, 0x70, 0xdf, 0xfc, 0x10, 0x01, 0x77, 0x69, 0xd0, 0x2a, 0xc5, 0x3b, 0x6f, 0x5e, 0x95, 0xa1,
+    0x08, 0xdf, 0x0d, 0xdf, 0xc9, 0x9e, 0x1b, 0x36, 0x94, 0x3c, 0xb7, 0x4a, 0x38, 0x13, 0x67, 0x50,
+    0x34, 0x5c, 0xd4, 0xd8, 0x35, 0xbe, 0xbd, 0x81, 0xf5, 0xa6, 0xc8, 0x15, 0x66, 0x4c, 0x0c, 0x63,
+    0x99, 0x21, 0x15, 0xd9, 0x71, 0x0b, 0x00, 0x0f, 0x61, 0x82, 0x6e, 0x1b, 0x7c, 0x40, 0x67, 0x0d,
+    0x4f, 0x1c, 0x50, 0x2d, 0xea, 0x24, 0xc2, 0x95, 0x53, 0x3d, 0xf9, 0x94, 0x97, 0x0a, 0xd4, 0x8d,
+    0x4a, 0x66, 0x05, 0xdd, 0x00, 0xf2, 0x7e, 0x5b, 0x4f, 0x05, 0x7a, 0xc5, 0xef, 0x3a, 0x02, 0x39,
+    0xad, 0xfd, 0x04, 0x14, 0xee, 0x83, 0x14, 0x06, 0x8f, 0x40, 0x0a, 0xc2, 0x8b, 0x0a, 0x36, 0x28,
+    0x01, 0x4f, 0xab, 0xa5, 0xcf, 0x04, 0x6c, 0x27, 0xf9, 0x49, 0xfd, 0x52, 0x9e, 0xa1, 0x7c, 0x64,
+    0x19, 0x74, 0x7e, 0xa8, 0xa9, 0xa0, 0xd8, 0x84, 0x05, 0x1f, 0x38, 0x03, 0x98, 0x0f, 0x31, 0x47,
+    0x47, 0x21, 0x95, 0x50, 0x48, 0x21, 0xfe, 0x5c, 0x82, 0x95, 0x64, 0x12, 0xaa, 0x2f, 0xb5, 0xf6,
+    0x4e, 0xf0, 0x76, 0x82, 0x0f, 0x27, 0x2e, 0x5d, 0xb2, 0x6f, 0xa6, 0xc8, 0x9b, 0x11, 0xa4, 0xb8,
+    0xff, 0x8c, 0x6a, 0xe3, 0xea, 0x37, 0x9e, 0x65, 0xa4, 0x2d, 0xc8, 0xd2, 0x60, 0x8b, 0x10, 0x98,
+    0xa0, 0x79, 0x49, 0x8c, 0xb8, 0xf3, 0xd7, 0x81, 0x8b, 0x98, 0xdf, 0x3f, 0x14, 0xd9, 0x43, 0xca,
+    0x0a, 0x4b, 0x8c, 0x34, 0xbf, 0x7a, 0xbc, 0x7a, 0xf9, 0x5b, 0xd6, 0xa3, 0xbe, 0x06, 0x41, 0xf2,
+    0x22, 0x6b, 0xde, 0xee, 0x80, 0x3e, 0xf0, 0xc2, 0x0a, 0x80, 0xbb, 0x9a, 0x56, 0xfd, 0xea, 0x4a,
+    0xfe, 0x61, 0x93, 0x59, 0x41, 0x50, 0x76, 0x0b, 0x26, 0x56, 0xc6, 0xde, 0xa2, 0x8d, 0xf8, 0xf9,
+    0xb7, 0x4f, 0x53, 0x98, 0x24, 0xf7, 0xec, 0x7c, 0x32, 0xd3, 0xc6, 0x23, 0x63, 0x22, 0xd2, 0x0c,
+    0x1f, 0x69, 0x33, 0x2b, 0xe3, 0x9a, 0x6b, 0xb1, 0xb5, 0x0d, 0x1c, 0x5d, 0x10, 0x87, 0x26, 0x47,
+    0xbb, 0xd1, 0x53, 0x08, 0x3e, 0x80, 0xb4, 0xd5, 0x97, 0x91, 0x0e, 0x26, 0x7b, 0x31, 0x2c, 0x37,
+    0xd4, 0x18, 0x01, 0x70, 0x8b, 0xe9, 0x6b, 0x15, 0x32, 0x44, 0x4a, 0x1c, 0x22, 0x27, 0xbe, 0xa1,
+    0x71, 0xf5, 0x70, 0x8c, 0xc9, 0x8f, 0x67, 0xe1, 0xe6, 0x57, 0x3c, 0x6b, 0x08, 0x45, 0x94, 0xe8,
+    0x35, 0x11, 0xd8, 0x1f, 0x23, 0x0f, 0xb0, 0x33, 0xb4, 0x1c, 0xf6, 0xca, 0xe2, 0xab, 0x5d, 0x05,
+    0xdc, 0xf7, 0xaa, 0xb0, 0xdd, 0x6e, 0x2e, 0xdc, 0x52, 0x5b, 0x85, 0x25, 0x59, 0xa9, 0x8c, 0x00,
+    0xa0, 0x31, 0x54, 0xde, 0x08, 0xab, 0x52, 0xdd, 0x09, 0x6f, 0x77, 0xbf, 0x7d, 0x84, 0xee, 0xa3,
+    0x15, 0xf8, 0xd4, 0x6a, 0xeb, 0xee, 0x17, 0xa3, 0x08, 0x00, 0xc4, 0xb8, 0x94, 0x06, 0x8d, 0xf0,
+    0x6c, 0x89, 0x40, 0x26, 0x2d, 0xb7, 0x01, 0xaa, 0x7b, 0xa1, 0x31, 0x01, 0xde, 0x2a, 0x7a, 0xea,
+    0x55, 0x7d, 0x68, 0x0b, 0x16, 0x1a, 0xbe, 0x0d, 0xed, 0xda, 0x42, 0xf4, 0xca, 0x2a, 0xc4, 0xcc,
+    0x1c, 0xdf, 0xef, 0x84, 0xd7, 0xd8, 0x83, 0x78, 0xee, 0x94, 0x00, 0x6f, 0xb6, 0x9a, 0x3d, 0x2d,
+    0x5e, 0x10, 0x03, 0x90, 0xbe, 0xdc, 0xae, 0xcd, 0xb2, 0x90, 0x04, 0x38, 0xf0, 0x8a, 0xf4, 0x8a,
+    0x1c, 0xd8, 0xd1, 0x77, 0xb0, 0x15, 0x61, 0x7b, 0x0f, 0xe1, 0x3d, 0x3b, 0x9a, 0xa3, 0x33, 0x8b,
+    0xda, 0xbd, 0x84, 0xbb, 0xec, 0xd5, 0x81, 0xf1, 0x0b, 0x71, 0x5d, 0xc6, 0x78, 0x1c, 0x15, 0x03,
+    0x70, 0xdb, 0xe9, 0xc5, 0x6d, 0xda, 0x1b, 0x83, 0x83, 0xd0, 0xa9, 0x56, 0x97, 0x82, 0xf4, 0x52,
+    0x13, 0x04, 0x1f, 0x6e, 0x62, 0x61, 0x98, 0x54, 0x68, 0x41, 0xbf, 0xcb, 0xed, 0xf6, 0xd2, 0xfb,
+    0xee, 0x22, 0x34, 0x31, 0xca, 0x2f, 0x8d, 0x82, 0x9a, 0x04, 0x7a, 0x1f, 0x38, 0x28, 0x8b, 0x4b,
+    0xde, 0x82, 0x2d, 0x11, 0x09, 0x04, 0x6d, 0x83, 0x6d, 0x77, 0x92, 0xe4, 0xe7, 0xa4, 0x69, 0x9a,
+    0x4c, 0xcd, 0xb3, 0x39, 0xbf, 0x60, 0x91, 0x8b, 0x0d, 0x35, 0xd2, 0xb9, 0x1e, 0x28, 0x70, 0xb1,
+    0xb6, 0xa2, 0x16, 0x1b, 0x6a, 0x64, 0x46, 0x75, 0x39, 0x43, 0x26, 0x2a, 0x92, 0x25, 0xae, 0x1f,
+    0x2e, 0x9d, 0xa7, 0xc6, 0xbd, 0xd8, 0x6f, 0xbc, 0x5b, 0x24, 0x96, 0xaf, 0x40, 0x4d, 0x8b, 0x0e,
+    0x07, 0xfe, 0x96, 0x4e, 0x2e, 0x40, 0x63, 0x95, 0xa5, 0xc5, 0x13, 0xbb, 0xa9, 0xa6, 0x23, 0x23,
+    0xa1, 0x94, 0x48, 0xd3, 0x60, 0xd9, 0xa7, 0x04, 0xeb, 0x4e, 0xd3, 0xb1, 0xd1, 0xde, 0x6f, 0xa8,
+    0xe1, 0x68, 0x59, 0x76, 0x46, 0x95, 0xcb, 0xf5, 0x93, 0xd8, 0x0b, 0x0f, 0x0f, 0x0f, 0xd2, 0xc0,
+    0x8b, 0x77, 0xf9, 0x03, 0x03, 0x13, 0x6c, 0xee, 0x52, 0x47, 0xdc, 0x1f, 0x8a, 0xda, 0xad, 0x3e,
+    0x96, 0xea, 0xfa, 0x6d, 0x90, 0x25, 0x54, 0xf7, 0xe1, 0x2d, 0xd8, 0x1d, 0xd1, 0xec, 0x34, 0x35,
+    0x4d, 0xba, 0x63, 0x14, 0x3d, 0xd8, 0x99, 0xfa, 0x82, 0x14, 0xba, 0x6d, 0x60, 0x20, 0x9c, 0xfc,
+    0x90, 0xd0, 0x6f, 0x43, 0xd3, 0x17, 0xaf, 0xac, 0x33, 0x78, 0xa4, 0x43, 0xc4, 0xd0, 0xcb, 0xcf,
+    0x6e, 0xb8, 0xe7, 0x1e, 0xd2, 0x6c, 0x33, 0xa0, 0x14, 0x43, 0xde, 0x82, 0xe6, 0x75, 0xa5, 0xb0,
+    0xb5, 0x14, 0x89, 0x6e, 0xe3, 0xda, 0x5f, 0xdd, 0x6b, 0xf7, 0x95, 0x5d, 0xa3, 0x0c, 0x36, 0x0b,
+    0x82, 0x47, 0x35, 0xdd, 0xbd, 0x65, 0x9b, 0x02, 0x6d, 0xdd, 0xcf, 0xe7, 0xf8, 0xbc, 0xb4, 0xfc,
+    0x96, 0x42, 0x01, 0x2f, 0x61, 0x10, 0x29, 0xe1, 0xf3, 0xd1, 0x2a, 0xe4, 0xbe, 0x7e, 0xec, 0x8c,
+    0xb6, 0x8c, 0x2a, 0xd2, 0x74, 0x58, 0xfb, 0x88, 0x11, 0xa1, 0xa5, 0x87, 0x18, 0xc6, 0xa3, 0xa3,
+    0xda, 0x50, 0xf6, 0x60, 0x77, 0x0e, 0x3e, 0x15, 0x60, 0x52, 0xed, 0xb9, 0x0d, 0x98, 0xc1, 0xe1,
+    0x4a, 0x99, 0x44, 0x95, 0x29, 0x63, 0x0a, 0x16, 0x17, 0xd1, 0x8c, 0x09, 0xd3, 0x72, 0xe6, 0x46,
+    0x95, 0xd2, 0xca, 0x2a, 0x8a, 0xb5, 0x4c, 0xa4, 0xd0, 0x71, 0x57, 0x88, 0x3d, 0xe8, 0x0f, 0x30,
+    0xac, 0x8f, 0x9b, 0x71, 0xb8, 0x60, 0x28, 0x3c, 0x82, 0x9f, 0xbd, 0x4b, 0x64, 0x32, 0x4b, 0x47,
+    0xf6, 0x76, 0x1f, 0x7e, 0x4b, 0x51, 0x83, 0xae, 0x5e, 0xb0, 0x3c, 0x86, 0xc5, 0x59, 0x48, 0xfd,
+    0xf1, 0x79, 0x95, 0x1c, 0x33, 0x13, 0x85, 0xbb, 0x17, 0x8c, 0x48, 0x5e, 0x97, 0x38, 0x3c, 0x4a,
+    0x38, 0xc8, 0x3d, 0x5a, 0xda, 0x9f, 0x75, 0x16, 0x62, 0xf6, 0x9d, 0xf6, 0xbe, 0xd5, 0xb8, 0xb6,
+    0x20, 0xf7, 0xc6, 0xac, 0x94, 0x80, 0x74, 0x45, 0x87, 0xdd, 0xa9, 0x99, 0x20, 0x25, 0x5b, 0x3c,
+    0x65, 0x55, 0xc5, 0xec, 0xfe, 0x9c, 0x18, 0x82, 0x22, 0xef, 0xb3, 0x8e, 0xe9, 0x68, 0x45, 0xca,
+    0x3a, 0xdd, 0xec, 0x51, 0x49, 0x9b, 0xf1, 0xa3, 0xfb, 0xbd, 0x2c, 0x28, 0xd5, 0x36, 0xef, 0x84,
+    0xf4, 0x6d, 0xcd, 0x16, 0x8d, 0xb9, 0x27, 0x84, 0x79, 0xc7, 0xe8, 0x0e, 0x43, 0x1c, 0xbc, 0xae,
+    0x74, 0x2b, 0xfc, 0xa9, 0x34, 0x7e, 0x4f, 0xf4, 0xea, 0xd0, 0x6a, 0x05, 0xcd, 0xb3, 0x27, 0x08,
+    0x34, 0x32, 0x39, 0xf0, 0x1e, 0xa2, 0x55, 0xd5, 0xb7, 0x2c, 0xb8, 0x90, 0xa6, 0xe0, 0x79, 0x1c,
+    0x82, 0xcc, 0x39, 0x52, 0xd6, 0x78, 0x64, 0x9e, 0x75, 0xa0, 0x07, 0x1e, 0xbe, 0x78, 0x85, 0xce,
+    0x2e, 0xc3, 0x16, 0x97, 0x53, 0x5d, 0xd7, 0x2b, 0x96, 0x59, 0xa2, 0x9e, 0x23, 0xfd, 0x4c, 0xac,
+    0xf5, 0xb0, 0xf4, 0x7a, 0x7f, 0x68, 0x69, 0xe8, 0x73, 0x6a, 0xe3, 0xc1, 0xd3, 0x99, 0x30, 0x26,
+    0x61, 0x63, 0x53, 0xe0, 0xab, 0xc4, 0xde, 0xda, 0xcc, 0xb5, 0xeb, 0x60, 0x85, 0x02, 0x45, 0x70,
+    0x5a, 0xaf, 0x52, 0xf3, 0xce, 0x47, 0xee, 0xe3, 0x73, 0xb4, 0x22, 0x9a, 0x9a, 0x0e, 0xf9, 0x80,
+    0xf6, 0x21, 0x3c, 0x7e, 0xf6, 0xfd, 0xca, 0x48, 0x9a, 0xd3, 0x2d, 0x3a, 0x6e, 0x98, 0xbe, 0x8f,
+    0x00, 0x81, 0x6e, 0xe4, 0x5e, 0x0a, 0x06, 0x23, 0x8d, 0xf1, 0x70, 0x76, 0xec, 0x18, 0x7d, 0x6f,
+    0xcf, 0x6e, 0x8e, 0x0a, 0x2c, 0x74, 0x60, 0xea, 0xc0, 0x36, 0xee, 0xe2, 0xe5, 0x95, 0xd3, 0xc7,
+    0x22, 0x57, 0x7e, 0xf5, 0xf8, 0x7c, 0xf3, 0xe9, 0x5d, 0x3c, 0x34, 0xc1, 0xc5, 0xf7, 0x7b, 0x47,
+    0x91, 0x95, 0x03, 0x52, 0x92, 0xbc, 0xd9, 0x7e, 0xca, 0x53, 0xa9, 0x68, 0xd0, 0xe4, 0x0e, 0x98,
+    0x7b, 0x76, 0xc1, 0xfd, 0xec, 0xba, 0x9a, 0x26, 0x93, 0x02, 0x0b, 0xa1, 0x3b, 0xef, 0xe9, 0x9a,
+    0x4d, 0x9d, 0xd9, 0x56, 0x42, 0x2a, 0xf8, 0x61, 0xe8, 0x82, 0xb5, 0xd2, 0xb9, 0x42, 0xd5, 0x1f,
+    0x69, 0xd5, 0x3a, 0x88, 0x64, 0x78, 0x91, 0xd2, 0xe0, 0x69, 0x4b, 0xc7, 0xa1, 0x8c, 0x75, 0x85,
+    0x2e, 0x62, 0xa3, 0x15, 0xf2, 0x5d, 0xe1, 0x3e, 0x29, 0x30, 0x21, 0xc6, 0x7a, 0xf9, 0xd9, 0x8f,
+    0x18, 0x8c, 0x68, 0x19, 0x51, 0xc0, 0x1f, 0xcb, 0x6a, 0x1f, 0x51, 0x98, 0xb1, 0x79, 0x2b, 0x16,
+    0x2e, 0x20, 0x53, 0x21, 0x3c, 0x01, 0xfb, 0xba, 0x91, 0x5c, 0x0f, 0x8b, 0xda, 0x5f, 0x50, 0xfe,
+    0x85, 0x36, 0x63, 0xaf, 0xea, 0xf4, 0x9b, 0x39, 0x5d, 0x46, 0xcd, 0x34, 0xa2, 0xf4, 0x62, 0x3b,
+    0xe5, 0xff, 0x5f, 0x16, 0x1f, 0xd7, 0xc7, 0xf0, 0xc4, 0x87, 0x46, 0xef, 0x2f, 0x28, 0xf4, 0x27,
+    0xac, 0xd4, 0xd4, 0x50, 0x52, 0x0a, 0x5f, 0xec, 0x79, 0x17, 0xac, 0xcf, 0x9e, 0x9d, 0x3b, 0x85,
+    0x93, 0x8e, 0x76, 0xa1, 0x04, 0x51, 0x82, 0xc6, 0xf1, 0x5f, 0x9a, 0x41, 0x45, 0x3e, 0x92, 0x90,
+    0x1a, 0xa3, 0xad, 0xda, 0xa3, 0x6c, 0x55, 0xb9, 0x72, 0x39, 0x94, 0xeb, 0xed, 0xe9, 0x1b, 0xf0,
+    0x0e, 0x0a, 0x41, 0x64, 0x30, 0xe2, 0xb0, 0x55, 0x4d, 0xab, 0xff, 0x8e, 0xff, 0xec, 0xc6, 0x7f,
+    0xfe, 0x6d, 0xab, 0x90, 0x1a, 0x4b, 0x55, 0xd0, 0x44, 0xd1, 0x34, 0xad, 0x24, 0xf9, 0x58, 0x34,
+    0x27, 0xd9, 0x70, 0xdd, 0x8a, 0xf7, 0xe0, 0x50, 0x4a, 0x38, 0xad, 0x83, 0xc9, 0xe3, 0x0f, 0x3f,
+    0xee, 0x2c, 0x9a, 0x9a, 0x93, 0xa4, 0x6d, 0x15, 0xd6, 0xb6, 0x62, 0x4e, 0x27, 0x0f, 0xa5, 0x8d,
+    0x14, 0xec, 0xd7, 0xcc, 0x9d, 0x78, 0x73, 0x31, 0xd9, 0x97, 0x4a, 0xd5, 0x71, 0x3d, 0x11, 0x93,
+    0x03, 0xc6, 0x41, 0x7a, 0x6c, 0x1c, 0xc8, 0x83, 0xf1, 0xab, 0xfe, 0xd7, 0xfc, 0x4c, 0xa9, 0x76,
+    0x67, 0xc6, 0x18, 0x32, 0x49, 0xf1, 0x58, 0x83, 0x7f, 0xa4, 0x4e, 0x23, 0x11, 0x6b, 0x48, 0x97,
+    0xe4, 0x9d, 0xf9, 0x71, 0x52, 0xbb, 0xbe, 0xbc, 0x5d, 0xb0, 0xbf, 0x70, 0xa8, 0xd4, 0x0e, 0x04,
+    0x6d, 0x8a, 0x89, 0x7d, 0xf4, 0xce, 0x8e, 0xb7, 0x18, 0x78, 0x7e, 0xd4, 0x76, 0xde, 0xec, 0x3a,
+    0x4b, 0xb8, 0x3b, 0x3f, 0x58, 0xea, 0x04, 0x02, 0x41, 0xdd, 0x9f, 0x02, 0xe6, 0x7c, 0x02, 0x41,
+    0x51, 0x87, 0xbd, 0xe1, 0x51, 0x91, 0x7c, 0xe3, 0xd3, 0xc5, 0x7c, 0x96, 0x29, 0x73, 0x7a, 0x37,
+    0xbd, 0x31, 0xc8, 0x41, 0xb1, 0x0b, 0x84, 0xc0, 0x54, 0x78, 0xf7, 0x96, 0x56, 0x49, 0xb8, 0x7b,
+    0xa6, 0xf1, 0x29, 0xab, 0x8b, 0x07, 0xcf, 0x49, 0xfe, 0x8f, 0x7f, 0xd6, 0xeb, 0xe5, 0x3f, 0x1c,
+    0xc0, 0xb3, 0xc3, 0x34, 0x3d, 0x17, 0x3c, 0x98, 0xf3, 0xc6, 0xcc, 0xda, 0x95, 0xa2, 0xe1, 0x24,
+    0x41, 0x58, 0x52, 0x44, 0xd3, 0xbd, 0x4b, 0x6e, 0x74, 0xa5, 0xc4, 0x54, 0x40, 0x05, 0x7f, 0xe4,
+    0x31, 0x57, 0xc3, 0xac, 0xf2, 0x21, 0xc2, 0x88, 0xbb, 0xca, 0x0e, 0x0a, 0x5b, 0x2a, 0xdd, 0x45,
+    0x60, 0x76, 0x51, 0xa0, 0xe9, 0x2e, 0x8e, 0xfa, 0x90, 0xc0, 0xae, 0xde, 0x74, 0xd2, 0x5d, 0xc2,
+    0x82, 0xa5, 0xbb, 0x08, 0xe9, 0x87, 0xc8, 0xbf, 0xe9, 0x2e, 0x4e, 0x48, 0x01, 0x3c, 0x7b, 0x92,
+    0xea, 0xaa, 0x0f, 0x47, 0xe7, 0x67, 0x59, 0xfa, 0x1f, 0xab, 0xba, 0xed, 0xfc, 0xef, 0xbd, 0x7b,
+    0xde, 0x95, 0xd3, 0x0b, 0xd3, 0x88, 0x6e, 0x4a, 0xe8, 0x55, 0x2d, 0x3a, 0x71, 0x69, 0x5a, 0xb0,
+    0x0c, 0xb4, 0x41, 0xd6, 0xae, 0xe6, 0xf3, 0xb8, 0xfb, 0x68, 0x43, 0x75, 0x2f, 0x97, 0x81, 0xfd,
+    0xb8, 0xd7, 0xc9, 0xf3, 0xee, 0xe9, 0x85, 0xe7, 0x4b, 0xe0, 0x7f, 0xab, 0x0c, 0x82, 0x1a, 0xc8,
+    0x95, 0xe6, 0xe9, 0x38, 0x2d, 0xa0, 0x32, 0x14, 0xd8, 0x77, 0x6a, 0xd7, 0xe8, 0xaf, 0x70, 0x90,
+    0xa4, 0x2e, 0x71, 0x51, 0x43, 0x89, 0x7d, 0xed, 0x78, 0xa4, 0xf1, 0x9f, 0xc7, 0x22, 0xa1, 0x04,
+    0x55, 0x82, 0x78, 0x1c, 0x42, 0xf3, 0x2c, 0x68, 0x62, 0x72, 0x1e, 0x2d, 0xb8, 0x55, 0x02, 0x87,
+    0xe5, 0xc6, 0x5d, 0x98, 0xfc, 0xca, 0x97, 0x47, 0xe9, 0x01, 0xc8, 0xca, 0xb3, 0x2b, 0xcb, 0x8f,
+    0xbe, 0xf6, 0x0b, 0x59, 0x9d, 0xbf, 0xfc, 0x7c, 0x69, 0x41, 0x4d, 0xa5, 0x38, 0xd7, 0xb5, 0x4b,
+    0xac, 0x1b, 0x13, 0x96, 0xac, 0x7b, 0x43, 0x2d, 0x9c, 0xf8, 0x71, 0x80, 0x60, 0x71, 0x30, 0x6b,
+    0x14, 0xea, 0x63, 0xe9, 0x5a, 0x49, 0x77, 0xa6, 0xcc, 0xc2, 0x90, 0xba, 0x7d, 0xc7, 0x3b, 0x3b,
+    0xf6, 0xed, 0x50, 0xeb, 0xde, 0xda, 0xd1, 0xf5, 0x34, 0x0f, 0xa5, 0x44, 0x9a, 0x13, 0xf3, 0x49,
+    0x7e, 0x07, 0x0f, 0xbc, 0x24, 0x82, 0x2e, 0xa3, 0x41, 0x38, 0xb1, 0x8e, 0xb5, 0x92, 0x28, 0x15,
+    0x4d, 0x21, 0xf1, 0x44, 0x8e, 0x53, 0x48, 0xc8, 0x62, 0xcb, 0xc5, 0x4e, 0xa1, 0x15, 0x31, 0x44,
+    0x2e, 0x0e, 0x90, 0x84, 0x1d, 0x71, 0x93, 0xe9, 0x67, 0xb3, 0x14, 0x64, 0x9a, 0xb9, 0xd5, 0x43,
+    0x72, 0x42, 0x44, 0x3d, 0xad, 0x8e, 0xee, 0xdf, 0xa7, 0x76, 0x4e, 0x14, 0x7a, 0xee, 0xfa, 0x12,
+    0x88, 0x12, 0xfc, 0x05, 0x95, 0x38, 0xa6, 0x89, 0xfc, 0x59, 0x15, 0xca, 0x34, 0x8d, 0xc5, 0x9b,
+    0x14, 0x9d, 0xe5, 0x47, 0xf3, 0xe0, 0xd2, 0xd2, 0xcb, 0xfe, 0x28, 0x52, 0x9d, 0x33, 0x93, 0x28,
+    0xff, 0xdd, 0x04, 0x25, 0xd5, 0x67, 0x99, 0xd1, 0x3d, 0x7b, 0xf7, 0x45, 0x31, 0x4c, 0x1b, 0xd9,
+    0x09, 0xe2, 0xfa, 0xf0, 0x5b, 0x3a, 0x87, 0x75, 0x49, 0xba, 0x4a, 0x61, 0xfc, 0x1d, 0xe5, 0x3a,
+    0x50, 0x9f, 0xbc, 0x23, 0x7b, 0x2f, 0x9c, 0x91, 0xac, 0xd9, 0x66, 0x07, 0x7e, 0xa2, 0x21, 0x08,
+    0xa0, 0x8d, 0xc5, 0x0d, 0xfc, 0xee, 0xc1, 0x8b, 0x98, 0xdc, 0x60, 0x89, 0xfe, 0x90, 0xcd, 0x0d,
+    0x12, 0x57, 0xfe, 0x99, 0x10, 0x4a, 0x5d, 0xf1, 0x9c, 0x24, 0xda, 0xa6, 0x76, 0x64, 0x1e, 0x5b,
+    0x1a, 0x44, 0xdc, 0x10, 0xbd, 0x12, 0x3b, 0xc8, 0x7f, 0xe4, 0xf5, 0x65, 0xda, 0xc1, 0x10, 0x91,
+    0x68, 0x5d, 0x7b, 0xf7, 0xe3, 0xa7, 0xcb, 0x4f, 0x6e, 0xb2, 0xbb, 0xf3, 0xc4, 0x16, 0xae, 0x4d,
+    0x3c, 0x82, 0x60, 0xc7, 0x18, 0x58, 0x9a, 0xcc, 0x0c, 0x6e, 0x6c, 0x94, 0x69, 0x24, 0x5b, 0xbe,
+    0xd5, 0x8b, 0x57, 0x56, 0xee, 0xdd, 0x83, 0x6d, 0x40, 0xc7, 0x42, 0x14, 0xb5, 0xce, 0x9d, 0x4a,
+    0x91, 0x7f, 0x28, 0x4b, 0x19, 0xa8, 0x33, 0x85, 0x2e, 0x2f, 0x07, 0xe3, 0x10, 0xa3, 0x2c, 0xf0,
+    0x85, 0xc7, 0x00, 0x24, 0x67, 0x5d, 0x60, 0x80, 0x9e, 0xae, 0x48, 0x8d, 0x25, 0x5f, 0x08, 0x6a,
+    0x93, 0x23, 0x4e, 0x7f, 0xb7, 0x87, 0x1c, 0x15, 0x47, 0x66, 0x87, 0x07, 0xe6, 0xe8, 0x57, 0x56,
+    0xf4, 0x4e, 0x25, 0xed, 0x56, 0xc9, 0x08, 0x5e, 0x91, 0xd4, 0xa0, 0x8c, 0xf3, 0xe2, 0x9f, 0x6d,
+    0xba, 0xf2, 0x66, 0xb2, 0x80, 0xb2, 0x08, 0xb6, 0xb4, 0x72, 0x62, 0x51, 0x59, 0xba, 0x6e, 0x52,
+    0x21, 0x51, 0x16, 0x00, 0x8e, 0x92, 0xd2, 0x56, 0x60, 0x1a, 0x8b, 0x7f, 0x71, 0xaf, 0xdd, 0xa1,
+    0x17, 0x54, 0x69, 0x2d, 0x5b, 0xb0, 0xb2, 0xf0, 0x9c, 0xe6, 0xec, 0x06, 0x8d, 0x8e, 0x2f, 0x3c,
+    0x76, 0x75, 0xbc, 0x64, 0x38, 0x84, 0x52, 0x88, 0x6c, 0x9a, 0xcf, 0xa3, 0x13, 0x31, 0x0a, 0xa0,
+    0x40, 0x2b, 0x72, 0x93, 0xb1, 0xc1, 0xbe, 0x50, 0x54, 0x9e, 0x2f, 0x9d, 0xf1, 0x0a, 0x64, 0xb1,
+    0x00, 0xc8, 0x0f, 0x0f, 0xdc, 0xfb, 0x9f, 0xaf, 0xdc, 0xfb, 0x94, 0xc6, 0xa7, 0x29, 0x96, 0x82,
+    0x90, 0x09, 0xf7, 0xc2, 0x92, 0xa9, 0xdc, 0x88, 0x32, 0x0d, 0x6e, 0x87, 0x39, 0x4d, 0xc2, 0xef,
+    0xb8, 0xb0, 0x59, 0x4b, 0x47, 0xb6, 0x49, 0xa6, 0xd2, 0xfd, 0xec, 0xc2, 0x58, 0x84, 0x20, 0xca,
+    0x88, 0x8d, 0x31, 0x9c, 0x5e, 0x85, 0x18, 0x86, 0x17, 0xb3, 0x53, 0x21, 0x14, 0xaa, 0x60, 0xc6,
+    0xb9, 0x19, 0x5e, 0x55, 0x4c, 0xff, 0xf7, 0x8a, 0xa9, 0x93, 0xe1, 0x91, 0xb4, 0x71, 0x69, 0x11,
+    0xcb, 0x63, 0x91, 0xf0, 0x2f, 0xab, 0x88, 0x4e, 0xa8, 0xfa, 0x5f, 0x73, 0xc7, 0x04, 0x87, 0xa3,
+    0x3d, 0xdf, 0xd0, 0x91, 0x5a, 0x71, 0x4c, 0x9c, 0x9b, 0x82, 0xe0, 0xba, 0x49, 0x1c, 0x6b, 0xed,
+    0x4e, 0x4a, 0x90, 0x78, 0x32, 0xa3, 0x48, 0xf3, 0x5e, 0x3f, 0x9b, 0xbc, 0xac, 0x65, 0x0c, 0x6a,
+    0x51, 0x5e, 0xfb, 0xa1, 0xe6, 0xdb, 0x74, 0xe6, 0x9f, 0xd8, 0x2d, 0x52, 0x9f, 0x84, 0x8a, 0x0b,
+    0x7e, 0xce, 0x34, 0x51, 0x9e, 0x08, 0xed, 0x85, 0x5c, 0x0a, 0x72, 0x3d, 0x8e, 0x01, 0x00, 0x6c,
+    0x04, 0x3c, 0x5a, 0x5e, 0x4d, 0x60, 0xf2, 0x13, 0xdd, 0x3c, 0x70, 0xa9, 0x23, 0xe2, 0x16, 0x8e,
+    0x5c, 0x1d, 0x81, 0x9f, 0xf8, 0x32, 0x52, 0x78, 0x2f, 0xa4, 0x48, 0xf5, 0xe1, 0x70, 0xfa, 0x6a,
+    0x8b, 0x38, 0xb4, 0x5c, 0x06, 0x22, 0x70, 0x94, 0xef, 0xbf, 0xc0, 0x3b, 0x8f, 0x6f, 0xaa, 0xc3,
+    0xe1, 0x05, 0x92, 0x2b, 0x74, 0xac, 0x69, 0x95, 0xc2, 0xd5, 0x31, 0xd6, 0xb4, 0x56, 0xf1, 0x01,
+    0x97, 0x5f, 0x66, 0xa9, 0x22, 0xaa, 0x59, 0xbc, 0x82, 0xf5, 0x8a, 0x2a, 0xde, 0xd1, 0xc1, 0xaa,
+    0xbd, 0xf0, 0x95, 0x74, 0x8a, 0x3a, 0x16, 0x35, 0xdd, 0x45, 0xca, 0x77, 0xc4, 0x67, 0xac, 0x88,
+    0x05, 0x50, 0xfd, 0x85, 0xa4, 0x85, 0x03, 0xb7, 0x3a, 0x2d, 0x76, 0x01, 0x7e, 0x79, 0x46, 0xb6,
+    0x29, 0xf5, 0x46, 0x53, 0x7e, 0xf3, 0x1b, 0x1f, 0x00, 0x20, 0xe3, 0xbd, 0x88, 0x98, 0x06, 0x2d,
+    0x1e, 0x13, 0x87, 0x7c, 0x8e, 0x14, 0x16, 0xc1, 0x4f, 0xf6, 0x81, 0x9e, 0x83, 0xde, 0x28, 0xd4,
+    0x36, 0xe0, 0x27, 0x7a, 0x80, 0x31, 0xa2, 0xf4, 0x29, 0xb8, 0x04, 0x7d, 0x03, 0xec, 0x4f, 0x50,
+    0x93, 0x05, 0xeb, 0x07, 0xa3, 0x8a, 0x27, 0x65, 0xf0, 0xe8, 0x89, 0x08, 0xec, 0x4a, 0x57, 0xde,
+    0x7f, 0xba, 0xf2, 0xe0, 0xf8, 0xca, 0xb3, 0x13, 0x58, 0x1b, 0x55, 0xd4, 0x6e, 0x7e, 0x69, 0x93,
+    0x9c, 0xaa, 0x62, 0xfe, 0x07, 0x9b, 0x57, 0x96, 0x17, 0x64, 0x64, 0xd7, 0x6a, 0x03, 0xa1, 0x38,
+    0xa5, 0x8c, 0x57, 0x7b, 0x09, 0x8a, 0xf8, 0x29, 0xeb, 0x98, 0xef, 0x98, 0xd3, 0xba, 0xb5, 0x4d,
+    0xb3, 0x75, 0xe6, 0x8c, 0xbf, 0x41, 0x9e, 0xeb, 0xe5, 0x82, 0xfd, 0x7b, 0xc3, 0x01, 0xc3, 0x81,
+    0x05, 0xf9, 0xd4, 0x14, 0x90, 0x2e, 0xea, 0x45, 0x76, 0xf2, 0x08, 0xb9, 0xec, 0xdf, 0x6e, 0x56,
+    0xde, 0xbe, 0xc6, 0x2f, 0x05, 0xcb, 0x6b, 0xbf, 0xd2, 0x62, 0x7f, 0x81, 0x32, 0x80, 0xeb, 0x9b,
+    0x69, 0x44, 0x13, 0x76, 0x31, 0xb3, 0x0d, 0x9e, 0x63, 0xe0, 0x0a, 0xb1, 0xe2, 0x84, 0x04, 0x0d,
+    0xf4, 0x3f, 0x3c, 0x5a, 0xd5, 0xf1, 0xe8, 0x48, 0x58, 0xdd, 0x6e, 0xba, 0xa4, 0x5e, 0xf4, 0xbb,
+    0x37, 0x55, 0x57, 0xfe, 0x7d, 0x6b, 0x6a, 0xcc, 0x37, 0xca, 0x4c, 0x05, 0xc4, 0x62, 0x5c, 0x67,
+    0x79, 0x6c, 0xf8, 0x9a, 0x57, 0xd6, 0xf4, 0xae, 0xd1, 0xc2, 0xff, 0x11, 0x57, 0x48, 0xe5, 0x66,
+    0x6b, 0xbf, 0x44, 0x1a, 0xb2, 0xf1, 0x6c, 0x73, 0x8d, 0x97, 0x57, 0x63, 0x36, 0x68, 0xf1, 0xc9,
+    0x6f, 0x72, 0xed, 0xe7, 0x80, 0xde, 0x40, 0x90, 0x59, 0x4e, 0xe2, 0xdf, 0xd1, 0x26, 0xc4, 0x7b,
+    0x3b, 0xdc, 0x9b, 0xed, 0xc9, 0xf6, 0xb4, 0xca, 0xaa, 0xf3, 0x8b, 0x41, 0x47, 0xc1, 0x24, 0x6f,
+    0xb7, 0x33, 0x15, 0xd9, 0x61, 0x9e, 0x5e, 0xb0, 0x3e, 0x74, 0x14, 0xdc, 0xa8, 0xc4, 0xbf, 0xce,
+    0x2e, 0x33, 0x8b, 0x15, 0xb5, 0x3b, 0xda, 0xee, 0x44, 0x95, 0x52, 0x5d, 0xbf, 0x72, 0x24, 0x9a,
+    0xc9, 0x57, 0x6a, 0x92, 0x7a, 0x7a, 0x83, 0xe9, 0xa7, 0x0e, 0x04, 0xd5, 0x3d, 0x7e, 0x32, 0x5c,
+    0xb8, 0x3a, 0x7a, 0x8f, 0x13, 0x13, 0x70, 0xa3, 0x05, 0x38, 0x69, 0xa5, 0x64, 0x1a, 0x67, 0x8b,
+    0xaf, 0xdd, 0x29, 0xee, 0x39, 0x02, 0x45, 0x79, 0x89, 0x66, 0x09, 0xea, 0xaf, 0x35, 0x5b, 0x00,
+    0x66, 0x2d, 0x59, 0x9d, 0xd5, 0xed, 0xc6, 0xe1, 0xb6, 0x1d, 0x79, 0xdb, 0x70, 0xef, 0xad, 0x5a,
+    0x8b, 0x54, 0x30, 0xb1, 0xf0, 0x6c, 0xb8, 0x2b, 0xb9, 0x2a, 0xd8, 0xbe, 0x2f, 0x72, 0xa5, 0x9a,
+    0x6a, 0xa1, 0xe5, 0x84, 0x89, 0xb4, 0x74, 0x3f, 0x04, 0x94, 0xd9, 0xd5, 0x54, 0x5a, 0x57, 0x52,
+    0xed, 0x41, 0x13, 0x2e, 0x62, 0x25, 0x49, 0x02, 0xdf, 0x9a, 0x3e, 0x3a, 0xbd, 0xbc, 0x74, 0x9d,
+    0x2e, 0x21, 0x7a, 0xf3, 0x1e, 0x8b, 0x99, 0x56, 0x89, 0x5c, 0x74, 0xc7, 0x22, 0x2a, 0x3b, 0xd9,
+    0x17, 0x54, 0x12, 0xfc, 0x45, 0x16, 0x8b, 0x67, 0x95, 0x05, 0x1e, 0x05, 0x13, 0x8a, 0x9c, 0x37,
+    0xec, 0x49, 0x0e, 0x1e, 0x31, 0xaa, 0xb4, 0x4c, 0xb0, 0x38, 0x0a, 0x53, 0xb8, 0xb4, 0x39, 0xd1,
+    0xb7, 0x69, 0x4f, 0xd5, 0xa6, 0x55, 0x72, 0xf0, 0x18, 0xd8, 0xe7, 0xcc, 0x4c, 0x59, 0x04, 0x8d,
+    0xff, 0xb3, 0xfb, 0x9d, 0xb7, 0x1d, 0xa7, 0xf2, 0x1e, 0x8d, 0x7e, 0x20, 0x32, 0xf0, 0x26, 0x4b,
+    0x09, 0x98, 0x35, 0xcb, 0x7c, 0xaa, 0x39, 0xcf, 0x94, 0x33, 0x3b, 0xad, 0xb3, 0x2b, 0x0b, 0xdb,
+    0xcc, 0x12, 0x88, 0x0b, 0xd2, 0x38, 0xe8, 0x5b, 0xe1, 0x1b, 0x3c, 0x9a, 0x90, 0x53, 0x37, 0xb2,
+    0x45, 0xe2, 0xd8, 0x80, 0xfe, 0xd7, 0x69, 0x7e, 0x8b, 0xe7, 0x66, 0xc5, 0xd1, 0x3c, 0x00, 0x8e,
+    0xfb, 0x51, 0xb1, 0x8b, 0x30, 0x46, 0x09, 0x43, 0xcb, 0x00, 0x63, 0x72, 0xb7, 0xdc, 0x9f, 0x64,
+    0xd1, 0xd6, 0x31, 0x2a, 0x87, 0x13, 0x35, 0xcb, 0x96, 0xae, 0x15, 0x66, 0xc9, 0xe9, 0x33, 0x2b,
+    0x79, 0x27, 0x3a, 0x2d, 0x30, 0x51, 0x6c, 0x45, 0xda, 0x60, 0xda, 0x10, 0xd6, 0xf5, 0x90, 0x29,
+    0x96, 0xdd, 0xbe, 0xe7, 0xdd, 0x1d, 0x7e, 0x4b, 0x2f, 0xbd, 0xb0, 0xaf, 0x07, 0x6f, 0x72, 0xc4,
+    0xf2, 0x11, 0x56, 0x1f, 0x6b, 0xc9, 0x49, 0x6c, 0x75, 0x49, 0x1d, 0x5e, 0x2c, 0xd8, 0x4d, 0x18,
+    0xcb, 0x3d, 0xf9, 0x10, 0xcf, 0x0d, 0x05, 0xc6, 0x0a, 0xc7, 0x3a, 0x30, 0x80, 0x95, 0x25, 0x61,
+    0x48, 0x86, 0x3a, 0x35, 0x48, 0x38, 0x82, 0x14, 0xe8, 0x20, 0x4c, 0x01, 0xfe, 0x31, 0x4d, 0xd3,
+    0x15, 0x94, 0x33, 0xb2, 0xd8, 0x18, 0xd3, 0x3f, 0x30, 0xd8, 0xf1, 0x5b, 0x7e, 0x18, 0x81, 0xf4,
+    0xe1, 0xb9, 0x20, 0x58, 0xed, 0xfd, 0x87, 0xef, 0xdc, 0xcf, 0x4f, 0xc0, 0xfb, 0x68, 0xa0, 0x31,
+    0x46, 0xbe, 0xdb, 0x1e, 0x93, 0x76, 0xa9, 0xa9, 0x5a, 0xbd, 0xad, 0x66, 0x65, 0x46, 0x82, 0x10,
+    0x85, 0x9f, 0xdd, 0x31, 0xa2, 0x50, 0xf5, 0x08, 0xe4, 0x00, 0xc5, 0x48, 0x6f, 0x05, 0x53, 0x95,
+    0x48, 0x35, 0x61, 0xcb, 0xad, 0x74, 0xad, 0xc5, 0x02, 0x88, 0x55, 0xb8, 0x81, 0x97, 0x50, 0xd3,
+    0x02, 0xfc, 0x3b, 0xf3, 0xee, 0xdc, 0x15, 0x4a, 0xfa, 0x7a, 0xba, 0x97, 0xee, 0xb7, 0xd7, 0x00,
+    0x54, 0xac, 0xae, 0xec, 0xeb, 0xee, 0xf9, 0xef, 0xbc, 0x48, 0x00, 0x05, 0xdd, 0x19, 0x35, 0x64,
+    0x60, 0x47, 0x3d, 0x43, 0x80, 0x8c, 0x72, 0xe2, 0x7a, 0xf3, 0xf6, 0x85, 0xd5, 0x0b, 0x0b, 0xee,
+    0xf9, 0xb3, 0x51, 0x74, 0xa8, 0xf3, 0x58, 0x41, 0x08, 0xf7, 0xb8, 0xe0, 0x02, 0xf6, 0xd9, 0x2c,
+    0x85, 0xa1, 0x02, 0xc6, 0x9c, 0x31, 0x2c, 0x31, 0xe0, 0x30, 0x35, 0x9a, 0xdd, 0xd8, 0xbc, 0x7e,
+    0x14, 0x94, 0x92, 0x2f, 0x18, 0x2c, 0xc7, 0x97, 0x74, 0x61, 0x13, 0xcc, 0xc9, 0x01, 0xa9, 0xe8,
+    0x60, 0x4c, 0x6b, 0xa6, 0x96, 0xc0, 0x79, 0x1e, 0x98, 0x10, 0xf3, 0x12, 0x1b, 0x0c, 0x0b, 0x7c,
+    0x27, 0xf7, 0x1c, 0x6b, 0x5c, 0x9b, 0x77, 0x4f, 0xdf, 0x70, 0xaf, 0xdc, 0xa1, 0xb8, 0xa0, 0xc7,
+    0xea, 0xa3, 0x5e, 0x4f, 0x8d, 0x85, 0x02, 0x93, 0x11, 0x3e, 0x30, 0x5b, 0x14, 0x2f, 0x00, 0x27,
+    0x8e, 0x20, 0x05, 0xdb, 0x48, 0x20, 0x69, 0x3f, 0xd1, 0xb3, 0xfb, 0x77, 0xf1, 0x92, 0x40, 0x9e,
+    0x56, 0x22, 0xcd, 0x72, 0xc1, 0xfd, 0x93, 0x40, 0x6e, 0x9a, 0x12, 0x4c, 0x11, 0x85, 0x0d, 0x41,
+    0xf0, 0xc4, 0xaf, 0x1d, 0x07, 0x05, 0x56, 0x0b, 0xbb, 0xff, 0x65, 0xae, 0xb1, 0x70, 0x8b, 0xfd,
+    0x42, 0x18, 0x89, 0xac, 0xa9, 0x2d, 0xb1, 0xe5, 0x98, 0x6a, 0xe3, 0xa6, 0xe5, 0xb4, 0xc2, 0x94,
+    0x0e, 0xb5, 0xf2, 0xc5, 0x37, 0x20, 0x45, 0x8d, 0xc5, 0x2f, 0x3a, 0xc7, 0xce, 0xef, 0xd2, 0x06,
+    0x11, 0x56, 0x53, 0xac, 0x30, 0xd8, 0x81, 0xd3, 0x07, 0xad, 0x78, 0xdc, 0x3a, 0xeb, 0x58, 0x46,
+    0x29, 0x99, 0x0a, 0xee, 0xe2, 0x90, 0x41, 0xab, 0x56, 0x31, 0x47, 0x4f, 0x75, 0x79, 0xc7, 0x6e,
+    0x1a, 0x58, 0xf8, 0x57, 0xb4, 0xa8, 0x39, 0xb6, 0xaf, 0xc1, 0xcf, 0xec, 0xea, 0x0d, 0x80, 0x4d,
+    0x41, 0x27, 0xe5, 0xb7, 0xb9, 0xb1, 0xdf, 0x20, 0x22, 0x1b, 0x6a, 0xf0, 0x2f, 0xbe, 0x23, 0x44,
+    0x02, 0xa3, 0x9e, 0xa4, 0x91, 0xc2, 0x34, 0x34, 0x4a, 0xa3, 0x2f, 0x12, 0xb2, 0xe9, 0xe7, 0x3e,
+    0x5e, 0x9d, 0x3b, 0x2a, 0xaa, 0x39, 0xb6, 0xa4, 0x27, 0xef, 0x83, 0x04, 0xa9, 0x51, 0xb8, 0xa8,
+    0xcc, 0x58, 0xdb, 0xe8, 0x32, 0x70, 0x17, 0xa2, 0x7d, 0x05, 0x1a, 0x51, 0x77, 0x04, 0xdd, 0xed,
+    0xb6, 0xfb, 0x6b, 0x89, 0xbb, 0x55, 0xb0, 0xc5, 0xa4, 0x27, 0x97, 0xb5, 0x76, 0xec, 0x2d, 0x46,
+    0x84, 0xc5, 0xb7, 0xb5, 0x5f, 0xd2, 0x3d, 0x7d, 0x91, 0x2d, 0x43, 0xfc, 0x1e, 0x39, 0xda, 0xc3,
+    0x0c, 0x44, 0xac, 0xfc, 0x6d, 0x86, 0xbf, 0x33, 0xaf, 0x8b, 0x95, 0x21, 0xb1, 0x30, 0xa5, 0x51,
+    0x9e, 0x24, 0x61, 0xac, 0x5d, 0x98, 0x8b, 0x90, 0xcb, 0xf4, 0x0e, 0x47, 0x86, 0xfb, 0xc8, 0x6d,
+    0x57, 0x9e, 0xd5, 0xd0, 0xa2, 0x7e, 0xdb, 0x01, 0xa3, 0xf0, 0x7f, 0x43, 0x97, 0xb3, 0x13, 0x07,
+    0x85, 0x92, 0x6e, 0xfc, 0x29, 0x5a, 0x01, 0x2c, 0x71, 0xc5, 0xbe, 0x66, 0x8d, 0x02, 0xd6, 0xad,
+    0x1a, 0x8b, 0xb9, 0xd7, 0x3d, 0x86, 0xc3, 0xf2, 0xa6, 0xad, 0x42, 0x74, 0x1e, 0xbd, 0xbd, 0x71,
+    0xe2, 0xc8, 0x1d, 0x3f, 0xd4, 0x70, 0xd4, 0x50, 0x94, 0x18, 0xf2, 0x68, 0x1e, 0xa5, 0xe4, 0x5b,
+    0xc1, 0x21, 0x3a, 0x75, 0x3c, 0x72, 0xab, 0xa9, 0xb5, 0x88, 0xe7, 0x91, 0xab, 0xa1, 0x42, 0x1c,
+    0x4c, 0xc7, 0xd7, 0xec, 0x10, 0x84, 0x7c, 0xce, 0xc2, 0x66, 0x16, 0x90, 0xc8, 0x92, 0x72, 0xa4,
+    0xe0, 0x7f, 0x4b, 0xeb, 0x44, 0x0a, 0x02, 0xe0, 0x1a, 0xbd, 0xcc, 0xa5, 0xed, 0x60, 0xb1, 0xbc,
+    0x05, 0xf3, 0xc8, 0xe8, 0x5f, 0x09, 0xf7, 0x12, 0x68, 0xe2, 0x18, 0x95, 0x34, 0x18, 0xee, 0x34,
+    0xc1, 0xc6, 0x2f, 0x40, 0xec, 0xdd, 0x04, 0x6d, 0x19, 0x35, 0x91, 0x6b, 0xda, 0x7b, 0x85, 0x1c,
+    0xbd, 0xd2, 0x1c, 0x9d, 0x75, 0x95, 0x8a, 0x40, 0x8e, 0xbd, 0x82, 0x1a, 0x1d, 0x63, 0x9d, 0xe1,
+    0x11, 0x4c, 0xb6, 0xc8, 0xc9, 0xf5, 0x3a, 0x3a, 0x03, 0x12, 0xcc, 0x91, 0xcc, 0x85, 0x4a, 0x77,
+    0x74, 0x48, 0xcf, 0x50, 0xf4, 0x3e, 0x27, 0x16, 0xeb, 0x00, 0x37, 0x8a, 0xa9, 0xb8, 0x4e, 0x81,
+    0x49, 0x59, 0x1c, 0xb9, 0x40, 0x49, 0x0f, 0x00, 0x37, 0xd8, 0xdb, 0x07, 0xde, 0x5e, 0x4c, 0x7d,
+    0x71, 0x91, 0x35, 0xa2, 0x6a, 0x53, 0x47, 0x41, 0xeb, 0x90, 0x71, 0xc8, 0xcf, 0x86, 0xb4, 0x29,
+    0x16, 0x29, 0xde, 0xf7, 0x0b, 0x54, 0x0a, 0xae, 0xbd, 0xe0, 0x20, 0x01, 0x29, 0x6b, 0xa9, 0xe9,
+    0x3b, 0x1a, 0x81, 0x59, 0xe5, 0x96, 0xba, 0x29, 0x70, 0x2e, 0x12, 0x10, 0xb4, 0x0e, 0x6f, 0x31,
+    0x87, 0xa4, 0x2e, 0xe2, 0xca, 0xb2, 0xda, 0xd9, 0x95, 0x65, 0x70, 0x19, 0xba, 0x5e, 0xed, 0x6d,
+    0xed, 0xc8, 0xf4, 0x08, 0xa1, 0xc0, 0x75, 0x4d, 0xb8, 0x29, 0x1d, 0x26, 0x7e, 0x0e, 0xc8, 0xef,
+    0x1d, 0x26, 0x77, 0x90, 0x71, 0x15, 0xad, 0x8f, 0xd6, 0x90, 0x66, 0x1d, 0xa3, 0x95, 0x3a, 0xcf,
+    0xdb, 0x6a, 0xa1, 0x4e, 0xd6, 0x94, 0x70, 0xdd, 0x42, 0xa3, 0x74, 0x98, 0x03, 0xd6, 0x52, 0x97,
+    0x74, 0x9e, 0x07, 0xd6, 0x4a, 0x8b, 0xbc, 0x48, 0xfe, 0x75, 0x84, 0xc8, 0xfc, 0x33, 0x09, 0xbb,
+    0x45, 0xfa, 0x6a, 0x84, 0xb5, 0x8e, 0x13, 0x17, 0x96, 0xe4, 0x8b, 0x33, 0xf4, 0x12, 0x59, 0x5f,
+    0x4a, 0xd6, 0x5a, 0xe4, 0x9a, 0x79, 0x29, 0x9d, 0xb4, 0xd6, 0x4c, 0x4c, 0x0a, 0x77, 0x28, 0xa2,
+    0x11, 0xd4, 0xdf, 0x81, 0xe4, 0x36, 0x1e, 0xc5, 0x89, 0x4a, 0xae, 0x89, 0x42, 0x23, 0x22, 0xa3,
+    0x86, 0xe2, 0xb3, 0xd6, 0xdc, 0xd0, 0x38, 0xbe, 0xec, 0x34, 0x1d, 0x23, 0x6c, 0x33, 0xd7, 0x74,
+    0xe2, 0x1f, 0xf3, 0xa3, 0x18, 0x6b, 0x3a, 0xf6, 0x6f, 0x23, 0xf1, 0xbf, 0xcc, 0xd9, 0x7f, 0x8c,
+    0xc7, 0xf0, 0x0a, 0xce, 0xff, 0x63, 0x7f, 0xc1, 0x63, 0x2d, 0xa9, 0x1b, 0x22, 0x4f, 0xe8, 0x14,
+    0xfa, 0xae, 0x42, 0x9a, 0x6f, 0xa8, 0xf1, 0xf7, 0x3e, 0xfc, 0xeb, 0x92, 0xc5, 0xd8, 0xa5, 0xf0,
+    0x7a, 0x92, 0x7c, 0x71, 0x69, 0xf4, 0x12, 0x8f, 0x7b, 0x31, 0x9b, 0x04, 0x10, 0x79, 0x75, 0x7e,
+    0xe0, 0x48, 0x2a, 0x38, 0x43, 0xe2, 0xcd, 0xe1, 0x40, 0x9d, 0x54, 0xff, 0x82, 0x1c, 0x3e, 0xc0,
+    0x1b, 0x72, 0x69, 0x1a, 0x37, 0x13, 0xee, 0xcb, 0xc7, 0x56, 0xe2, 0xa1, 0xcd, 0xf1, 0x48, 0x97,
+    0xb4, 0xe6, 0x3f, 0xcd, 0x2b, 0xff, 0xbe, 0x6e, 0xe0, 0x17, 0x7a, 0x55, 0xd4, 0x5a, 0x30, 0x09,
+    0xb2, 0xe8, 0xa4, 0x98, 0xf6, 0x18, 0x56, 0xe8, 0xf1, 0x7f, 0x62, 0xd8, 0x2e, 0x45, 0x14, 0x51,
+    0x00, 0xe7, 0xdc, 0x9f, 0xd9, 0x01, 0xfc, 0x7c, 0x10, 0x64, 0x53, 0x78, 0x96, 0x45, 0x2c, 0xd0,
+    0x33, 0xe7, 0xa0, 0x63, 0xd8, 0x2f, 0x98, 0x6e, 0x25, 0x35, 0x97, 0xd8, 0xcf, 0x2f, 0xe4, 0x2e,
+    0xfc, 0xce, 0x43, 0x37, 0x6a, 0x43, 0xfc, 0x8b, 0x57, 0xca, 0x47, 0xfe, 0x1b, 0x3b, 0x61, 0xf7,
+    0x8e, 0x2b, 0xa8, 0x00, 0x00,
+};
+
+const WebAsset INDEX_PAGE = {"/", "text/html", "\"80951c33\"", INDEX_PAGE_GZ, sizeof(INDEX_PAGE_GZ)};
+
+// 页面共用的独立资源，路径带内容哈希，可长期缓存
+const WebAsset* const SHARED_ASSETS[] = {&COMMON_JS};
+const size_t SHARED_ASSET_COUNT = sizeof(SHARED_ASSETS) / sizeof(SHARED_ASSETS[0]);
 
 #endif
@@ -1,67 +1,274 @@
 #include "web_server.h"
+#include "logger.h"
+#include "task_scheduler.h"
+#include "power_manager.h"
+#include "discovery_manager.h"
+#include "boot_profile.h"
+#if DISPLAY_ENABLED
+#include "display_manager.h"
+#endif
+#if MQTT_ENABLED
+#include "mqtt_manager.h"
+#endif
 #include "config.h"
 #include <ESP8266HTTPUpdateServer.h>
-#include <Updater.h>
 
 ESP8266HTTPUpdateServer httpUpdater;
 
-WebServer::WebServer(WiFiManager* wm, TimerManager* tm, TimeManager* timeM) : server(WEB_SERVER_PORT) {
+// 把 Print 输出按块缓冲后以 chunked 方式发送，流式导出时不需要在内存中拼出整个响应
+class ChunkedPrint : public Print {
+private:
+    ESP8266WebServer& server;
+    char buf[256];
+    size_t len;
+    
+public:
+    ChunkedPrint(ESP8266WebServer& s) : server(s), len(0) {}
+    
+    size_t write(uint8_t c) override {
+        buf[len++] = c;
+        if (len == sizeof(buf)) flush();
+        return 1;
+    }
+    
+    void flush() override {
+        if (len > 0) {
+            server.sendContent(buf, len);
+            len = 0;
+        }
+    }
+};
+
+// 各路由的请求体上限，顺序与 BodyRoute 一致
+static const size_t BODY_LIMITS[BODY_ROUTE_COUNT] = {
+    BODY_LIMIT_TIMER, BODY_LIMIT_TIMER, BODY_LIMIT_BATCH, BODY_LIMIT_MANUAL, BODY_LIMIT_WIFI
+};
+
+static const char* const BODY_ROUTE_NAMES[BODY_ROUTE_COUNT] = {
+    "POST /api/timers", "PUT /api/timers/{id}", "POST /api/timers/batch", "POST /api/manual", "POST /api/wifi"
+};
+
+// API 路由表：新增接口只需在这里加一行，哈希在编译期计算
+const Route WebServer::ROUTES[] = {
+    ROUTE(HTTP_GET, "/api/status", &WebServer::handleGetStatus),
+    ROUTE(HTTP_GET, "/api/system", &WebServer::handleGetSystemInfo),
+    ROUTE(HTTP_GET, "/api/timers", &WebServer::handleGetTimers),
+    ROUTE_BODY(HTTP_POST, "/api/timers", BODY_TIMER_ADD, &WebServer::handleAddTimer),
+    ROUTE(HTTP_POST, "/api/timers/clear", &WebServer::handleClearTimers),
+    ROUTE_BODY(HTTP_POST, "/api/timers/batch", BODY_TIMER_BATCH, &WebServer::handleBatchTimers),
+    ROUTE_PARAM(HTTP_PUT, "/api/timers/", PARAM_UINT, BODY_TIMER_UPDATE, &WebServer::handleUpdateTimer),
+    ROUTE_PARAM(HTTP_DELETE, "/api/timers/", PARAM_UINT, -1, &WebServer::handleDeleteTimer),
+    ROUTE(HTTP_GET, "/api/pins", &WebServer::handleGetPins),
+    ROUTE(HTTP_GET, "/api/history", &WebServer::handleGetHistory),
+    ROUTE(HTTP_GET, "/api/logs", &WebServer::handleGetLogs),
+    ROUTE(HTTP_GET, "/api/stats/daily", &WebServer::handleGetDailyStats),
+    ROUTE(HTTP_GET, "/api/archive", &WebServer::handleGetArchive),
+    ROUTE(HTTP_GET, "/api/archive/export", &WebServer::handleExportArchive),
+    ROUTE(HTTP_GET, "/api/pwm/config", &WebServer::handleGetPWMConfig),
+    ROUTE(HTTP_GET, "/api/encoding/bench", &WebServer::handleEncodingBenchmark),
+    ROUTE_BODY(HTTP_POST, "/api/manual", BODY_MANUAL, &WebServer::handleManualControl),
+    ROUTE_BODY(HTTP_POST, "/api/wifi", BODY_WIFI, &WebServer::handleWiFiConfig),
+    ROUTE(HTTP_POST, "/api/wifi/reset", &WebServer::handleWiFiReset),
+    ROUTE(HTTP_POST, "/api/restart-ap", &WebServer::handleRestartAP),
+    ROUTE(HTTP_GET, "/api/firmware/info", &WebServer::handleFirmwareInfo),
+    ROUTE(HTTP_GET, "/api/firmware/status", &WebServer::handleFirmwareStatus),
+};
+
+const size_t WebServer::ROUTE_COUNT = sizeof(WebServer::ROUTES) / sizeof(WebServer::ROUTES[0]);
+
+WebServer::WebServer(WiFiManager* wm, TimerManager* tm, TimeManager* timeM, ArchiveManager* am)
+    : server(WEB_SERVER_PORT), routes(this, ROUTES, ROUTE_COUNT) {
     wifiManager = wm;
     timerManager = tm;
     timeManager = timeM;
+    archiveManager = am;
+    bodyLength = 0;
+    bodyTooLarge = false;
+    bodyResponded = false;
+    bodyHeapStart = 0;
+    memset(bodyStats, 0, sizeof(bodyStats));
+    memset(&heapStats, 0, sizeof(heapStats));
+    requestActive = false;
+    memset(&connStats, 0, sizeof(connStats));
+    connPort = 0;
+    connRequests = 0;
+    connLastActive = 0;
+    connOpen = false;
+    connKeepAlive = false;
 }
 
 void WebServer::begin() {
-    // 设置最大上传文件大小为 2MB
-    server.setContentLength(2 * 1024 * 1024);
+    buildFilters();
+    
+    // 内容协商和缓存校验需要读取的请求头
+    const char* headerKeys[] = {"Accept", "Content-Type", "If-None-Match"};
+    server.collectHeaders(headerKeys, 3);
+    
+    // 每个请求解析出请求行后先做准入检查，再记录请求前的堆状态
+    server.addHook([this](const String&, const String&, WiFiClient* client, ESP8266WebServer::ContentTypeFunction) {
+        uint32_t retryAfter;
+        AdmissionResult result = admission.admit(client->remoteIP(), &retryAfter);
+        if (result != ADMIT) {
+            shedRequest(client, result, retryAfter);
+            return ESP8266WebServer::CLIENT_MUST_STOP;
+        }
+        
+        trackConnection(client);
+        requestActive = true;
+        heapStats.freeBefore = ESP.getFreeHeap();
+        heapStats.maxBlockBefore = ESP.getMaxFreeBlockSize();
+        heapStats.fragBefore = ESP.getHeapFragmentation();
+        return ESP8266WebServer::CLIENT_REQUEST_CAN_CONTINUE;
+    });
     
     setupRoutes();
     server.begin();
-    Serial.println("Web 服务器启动，端口: " + String(WEB_SERVER_PORT));
+    LOG_INFO("Web 服务器启动，端口: %d", WEB_SERVER_PORT);
 }
 
 void WebServer::handleClient() {
+    unsigned long start = micros();
     server.handleClient();
+    manageConnection();
+    
+    if (requestActive) {
+        admission.charge(micros() - start);
+        
+        // 响应已发送，处理函数中的 JsonDocument 均已析构，复位内存池
+        arena.reset();
+        requestActive = false;
+        
+        heapStats.requests++;
+        heapStats.freeAfter = ESP.getFreeHeap();
+        heapStats.maxBlockAfter = ESP.getMaxFreeBlockSize();
+        heapStats.fragAfter = ESP.getHeapFragmentation();
+        if (heapStats.fragAfter > heapStats.maxFragAfter) {
+            heapStats.maxFragAfter = heapStats.fragAfter;
+        }
+        if (heapStats.minMaxBlockAfter == 0 || heapStats.maxBlockAfter < heapStats.minMaxBlockAfter) {
+            heapStats.minMaxBlockAfter = heapStats.maxBlockAfter;
+        }
+    }
+}
+
+bool WebServer::hasPendingClient() {
+    // 有新连接排队，或当前连接上已收到下一个请求
+    return server.getServer().hasClient() || (connOpen && server.client().available());
+}
+
+void WebServer::shedRequest(WiFiClient* client, AdmissionResult result, uint32_t retryAfter) {
+    // 直接写出固定的响应后断开，不解析请求头和请求体，也不占用内存池
+    char response[128];
+    int length = snprintf_P(response, sizeof(response),
+        PSTR("HTTP/1.1 %s\r\nRetry-After: %u\r\nContent-Length: 0\r\nConnection: close\r\n\r\n"),
+        result == SHED_CLIENT ? "429 Too Many Requests" : "503 Service Unavailable", (unsigned)retryAfter);
+    client->write((const uint8_t*)response, length);
+}
+
+void WebServer::trackConnection(WiFiClient* client) {
+    // 同一连接上的请求来源地址和端口不变；端口变化说明客户端建立了新连接
+    if (!connOpen || client->remotePort() != connPort || client->remoteIP() != connIP) {
+        connStats.connections++;
+        connIP = client->remoteIP();
+        connPort = client->remotePort();
+        connRequests = 0;
+        connOpen = true;
+    } else {
+        connStats.reused++;
+    }
+    
+    connRequests++;
+    connStats.requests++;
+    if (connRequests > connStats.maxRequestsPerConnection) {
+        connStats.maxRequestsPerConnection = connRequests;
+    }
+    
+    // 在响应头之前决定是否保持连接：达到上限或有其他客户端在排队时回复 Connection: close
+    connKeepAlive = connRequests < KEEPALIVE_MAX_REQUESTS && !server.getServer().hasClient();
+    server.keepAlive(connKeepAlive);
+}
+
+void WebServer::manageConnection() {
+    if (!connOpen) {
+        return;
+    }
+    
+    WiFiClient& client = server.client();
+    if (!client.connected() && !client.available()) {
+        // 客户端已关闭连接
+        connOpen = false;
+        return;
+    }
+    
+    if (requestActive) {
+        // 本轮刚处理完一个请求
+        connLastActive = millis();
+        if (!connKeepAlive) {
+            if (connRequests >= KEEPALIVE_MAX_REQUESTS) {
+                connStats.capClosed++;
+            } else {
+                connStats.preempted++;
+            }
+            client.stop();
+            connOpen = false;
+        } else if (client.available()) {
+            // 流水线请求：下一轮 handleClient 直接从接收缓冲解析
+            connStats.pipelined++;
+        }
+        return;
+    }
+    
+    if (client.available()) {
+        return;
+    }
+    
+    // 空闲连接：服务器一次只服务一个连接，有新连接等待时让出，否则等到空闲超时
+    if (server.getServer().hasClient()) {
+        connStats.preempted++;
+        client.stop();
+        connOpen = false;
+    } else if (millis() - connLastActive > KEEPALIVE_IDLE_TIMEOUT) {
+        connStats.idleClosed++;
+        client.stop();
+        connOpen = false;
+    }
 }
 
 void WebServer::setupRoutes() {
+    // API 路由表最先注册，API 请求不会再逐个比较后面的页面和静态资源路由
+    server.addHandler(&routes);
+    
     // 主页
     server.on("/", HTTP_GET, [this]() { handleRoot(); });
     
-    // API 路由
-    server.on("/api/status", HTTP_GET, [this]() { handleGetStatus(); });
-    server.on("/api/system", HTTP_GET, [this]() { handleGetSystemInfo(); });
-    server.on("/api/timers", HTTP_GET, [this]() { handleGetTimers(); });
-    server.on("/api/timers", HTTP_POST, [this]() { handleAddTimer(); });
-    server.on("/api/timers/clear", HTTP_POST, [this]() { handleClearTimers(); });
-    server.on("/api/pins", HTTP_GET, [this]() { handleGetPins(); });
-    server.on("/api/pwm/config", HTTP_GET, [this]() { handleGetPWMConfig(); });
-    server.on("/api/manual", HTTP_POST, [this]() { handleManualControl(); });
-    server.on("/api/wifi", HTTP_POST, [this]() { handleWiFiConfig(); });
-    server.on("/api/wifi/reset", HTTP_POST, [this]() { handleWiFiReset(); });
-    server.on("/api/restart-ap", HTTP_POST, [this]() { handleRestartAP(); });
-    
-    // 固件更新测试端点
-    server.on("/api/firmware/info", HTTP_GET, [this]() {
-        enableCORS();
-        JsonDocument doc;
-        doc["version"] = "1.0.0";
-        doc["buildTime"] = __DATE__ " " __TIME__;
-        doc["chipId"] = String(ESP.getChipId(), HEX);
-        doc["flashSize"] = ESP.getFlashChipSize();
-        doc["freeSpace"] = ESP.getFreeSketchSpace();
-        sendJSON(doc);
-    });
+    // 页面共用的静态资源（路径带内容哈希）
+    for (size_t i = 0; i < SHARED_ASSET_COUNT; i++) {
+        const WebAsset* asset = SHARED_ASSETS[i];
+        server.on(asset->path, HTTP_GET, [this, asset]() { sendAsset(*asset, true); });
+    }
     
+    // 固件上传（multipart 上传由服务器内置的处理器解析）
     server.on("/api/firmware/update", HTTP_POST, 
         [this]() { 
             // 处理上传完成后的响应
             enableCORS();
-            if (Update.hasError()) {
-                sendJSON(500, "固件更新失败", false);
+            const OtaStatus& status = ota.getStatus();
+            if (status.state != OTA_SUCCESS) {
+                sendJSON(500, status.error ? status.error : "固件更新失败", false);
             } else {
-                sendJSON(200, "固件更新成功，设备即将重启");
+                JsonDocument doc(&arena);
+                doc["success"] = true;
+                doc["message"] = "固件更新成功，设备即将重启";
+                doc["bytes"] = status.received;
+                doc["elapsedMs"] = ota.getElapsed();
+                doc["bytesPerSecond"] = ota.getBytesPerSecond();
+                doc["md5Checked"] = status.md5Checked;
+                doc["sha256Checked"] = status.sha256Checked;
+                doc["compressed"] = status.compressed;
+                doc["imageSize"] = status.imageSize;
+                sendJSON(doc);
                 delay(1000);
+                logger.flush();
                 ESP.restart();
             }
         },
@@ -71,42 +278,39 @@ void WebServer::setupRoutes() {
         }
     );
     
-    // 404 处理 - 这里会处理动态路由
+    // 404 处理
     server.onNotFound([this]() {
-        String uri = server.uri();
-        
-        // 处理定时器的 PUT 和 DELETE 请求
-        if (uri.startsWith("/api/timers/") && uri != "/api/timers/clear") {
-            if (server.method() == HTTP_PUT) {
-                handleUpdateTimer();
-                return;
-            } else if (server.method() == HTTP_DELETE) {
-                handleDeleteTimer();
-                return;
-            }
-        }
-        
-        // 真正的 404
         server.send(404, "text/plain", "Not Found");
     });
 }
 
+void WebServer::handleFirmwareInfo() {
+    enableCORS();
+    JsonDocument doc(&arena);
+    doc["version"] = "1.0.0";
+    doc["buildTime"] = __DATE__ " " __TIME__;
+    doc["chipId"] = String(ESP.getChipId(), HEX);
+    doc["flashSize"] = ESP.getFlashChipSize();
+    doc["freeSpace"] = ESP.getFreeSketchSpace();
+    sendJSON(doc);
+}
+
 void WebServer::handleRoot() {
     enableCORS();
     
     // 如果设备处于AP模式且未连接WiFi，显示简化的WiFi设置页面
     if (wifiManager->isInAPMode() && !wifiManager->isConnected()) {
-        server.send_P(200, "text/html", AP_MODE_HTML);
+        sendAsset(AP_MODE_PAGE, false);
     } else {
         // 否则显示完整的控制面板
-        server.send_P(200, "text/html", INDEX_HTML);
+        sendAsset(INDEX_PAGE, false);
     }
 }
 
 void WebServer::handleGetStatus() {
     enableCORS();
     
-    JsonDocument doc;
+    JsonDocument doc(&arena);
     doc["wifiConnected"] = wifiManager->isConnected();
     doc["localIP"] = wifiManager->getLocalIP();
     doc["apIP"] = wifiManager->getAPIP();
@@ -119,13 +323,30 @@ void WebServer::handleGetStatus() {
     doc["currentDate"] = timeManager->getCurrentDateString();
     
     // 统计活跃定时器
-    int activeCount = 0;
-    for (int i = 0; i < timerManager->getTimerCount(); i++) {
-        TimerConfig timer = timerManager->getTimer(i);
-        if (timer.isActive) activeCount++;
+    int activeCount = timerManager->getActiveTimerCount();
+    
+    // 二进制格式：[wifiConnected, localIP, apIP, isAPMode, hasValidTime, currentTime, currentDate, activeTimers, totalTimers]
+    BinaryFormat format = negotiateFormat();
+    if (format != FORMAT_JSON) {
+        String body;
+        BinaryWriter writer(format, body);
+        writer.beginArray(9);
+        writer.writeBool(wifiManager->isConnected());
+        writer.writeString(wifiManager->getLocalIP());
+        writer.writeString(wifiManager->getAPIP());
+        writer.writeBool(wifiManager->isInAPMode());
+        writer.writeBool(timerManager->hasValidTime());
+        writer.writeString(timeManager->getCurrentTimeString());
+        writer.writeString(timeManager->getCurrentDateString());
+        writer.writeUInt(activeCount);
+        writer.writeUInt(timerManager->getTimerCount());
+        server.send(200, formatContentType(format), body);
+        return;
     }
+    
     doc["activeTimers"] = activeCount;
     doc["totalTimers"] = timerManager->getTimerCount();
+    doc["stateVersion"] = timerManager->getStateVersion();
     
     sendJSON(doc);
 }
@@ -133,14 +354,14 @@ void WebServer::handleGetStatus() {
 void WebServer::handleGetSystemInfo() {
     enableCORS();
     
-    JsonDocument doc;
+    JsonDocument doc(&arena);
     
     // 固件信息
     doc["firmwareVersion"] = FIRMWARE_VERSION;
     doc["firmwareName"] = FIRMWARE_NAME;
     doc["buildDate"] = BUILD_DATE;
     doc["buildTime"] = BUILD_TIME;
-    doc["buildDateTime"] = String(BUILD_DATE) + " " + String(BUILD_TIME);
+    doc["buildDateTime"] = BUILD_DATE " " BUILD_TIME;
     
     // 基本系统信息
     doc["chipId"] = String(ESP.getChipId(), HEX);
@@ -166,6 +387,20 @@ void WebServer::handleGetSystemInfo() {
     doc["uptimeMinutes"] = (uptime / (60 * 1000UL)) % 60;
     doc["uptimeSeconds"] = (uptime / 1000UL) % 60;
     
+    // 启动阶段：setup() 中各阶段的耗时，以及后台阶段首次完成的时间
+    JsonObject boot = doc["boot"].to<JsonObject>();
+    boot["restoredTimers"] = timerManager->getRestoredCount();
+    boot["reconcilePending"] = timerManager->hasPendingReconcile();
+    JsonArray phases = boot["phases"].to<JsonArray>();
+    for (int i = 0; i < bootProfile.getCount(); i++) {
+        const BootPhase& p = bootProfile.get(i);
+        JsonObject phase = phases.add<JsonObject>();
+        phase["name"] = p.name;
+        phase["atMs"] = p.atMs;
+        phase["durationMs"] = p.durationMs;
+        phase["background"] = p.background;
+    }
+    
         // WiFi 信息
     JsonObject wifi = doc["wifi"].to<JsonObject>();
     wifi["connected"] = wifiManager->isConnected();
@@ -188,6 +423,11 @@ void WebServer::handleGetSystemInfo() {
         wifi["ssid"] = "未连接";
         wifi["apSSID"] = DEFAULT_AP_SSID;
         wifi["apStationCount"] = WiFi.softAPgetStationNum();
+    } else if (wifiManager->isConnecting()) {
+        wifi["statusText"] = "连接中";
+        wifi["modeText"] = "Station模式";
+        wifi["rssi"] = 0;
+        wifi["ssid"] = "未连接";
     } else {
         wifi["statusText"] = "未连接";
         wifi["modeText"] = "未知";
@@ -211,32 +451,208 @@ void WebServer::handleGetSystemInfo() {
         JsonObject pin = pins.add<JsonObject>();
         pin["pin"] = AVAILABLE_PINS[i];      // 前端期望的字段名
         pin["number"] = AVAILABLE_PINS[i];   // 保持兼容
-        pin["state"] = digitalRead(AVAILABLE_PINS[i]);
-        // 检查是否被定时器占用
-        bool inUse = false;
-        int timerIndex = -1;
-        for (int j = 0; j < timerManager->getTimerCount(); j++) {
-            TimerConfig timer = timerManager->getTimer(j);
-            if (timer.pin == AVAILABLE_PINS[i] && timer.isActive) {
-                inUse = true;
-                timerIndex = j;
-                break;
-            }
-        }
-        pin["inUse"] = inUse;
-        pin["timerIndex"] = timerIndex;
+        // 从引脚状态表读取，O(1)
+        const PinState* ps = timerManager->getPinState(AVAILABLE_PINS[i]);
+        pin["state"] = ps->level ? 1 : 0;
+        pin["pwmValue"] = ps->pwmValue;
+        pin["owners"] = ps->ownerCount;
+        pin["inUse"] = ps->ownerCount > 0;
+        pin["timerId"] = timerManager->getPinTimerOwner(AVAILABLE_PINS[i]);
+    }
+    
+    // 执行层统计（批量提交次数与写入耗时）
+    const ActuationStats& act = timerManager->getActuationStats();
+    JsonObject actuation = doc["actuation"].to<JsonObject>();
+    actuation["commits"] = act.commits;
+    actuation["edges"] = act.edges;
+    actuation["maxBatch"] = act.maxBatch;
+    actuation["digitalWriteCycles"] = act.lastDigitalCycles;
+    actuation["maxDigitalWriteCycles"] = act.maxDigitalCycles;
+    actuation["pwmUpdateUs"] = act.lastPWMUpdateUs;
+    actuation["maxPwmUpdateUs"] = act.maxPWMUpdateUs;
+    
+    // 请求级内存池与堆碎片统计
+    const ArenaStats& arenaStats = arena.getStats();
+    JsonObject heap = doc["requestHeap"].to<JsonObject>();
+    heap["arenaSize"] = REQUEST_ARENA_SIZE;
+    heap["arenaAllocations"] = arenaStats.allocations;
+    heap["arenaFallbacks"] = arenaStats.fallbacks;
+    heap["arenaLastUsed"] = arenaStats.lastUsed;
+    heap["arenaPeakUsed"] = arenaStats.peakUsed;
+    heap["requests"] = heapStats.requests;
+    heap["freeBefore"] = heapStats.freeBefore;
+    heap["freeAfter"] = heapStats.freeAfter;
+    heap["maxBlockBefore"] = heapStats.maxBlockBefore;
+    heap["maxBlockAfter"] = heapStats.maxBlockAfter;
+    heap["fragBefore"] = heapStats.fragBefore;
+    heap["fragAfter"] = heapStats.fragAfter;
+    heap["maxFragAfter"] = heapStats.maxFragAfter;
+    heap["minMaxBlockAfter"] = heapStats.minMaxBlockAfter;
+    
+    // 请求体接收与解析统计
+    JsonArray bodyParsing = doc["bodyParsing"].to<JsonArray>();
+    for (int i = 0; i < BODY_ROUTE_COUNT; i++) {
+        JsonObject r = bodyParsing.add<JsonObject>();
+        r["route"] = BODY_ROUTE_NAMES[i];
+        r["limit"] = BODY_LIMITS[i];
+        r["requests"] = bodyStats[i].requests;
+        r["rejected"] = bodyStats[i].rejected;
+        r["maxBody"] = bodyStats[i].maxBody;
+        r["peakHeap"] = bodyStats[i].peakHeap;
+    }
+    
+    // 主循环任务统计
+    JsonObject sched = doc["scheduler"].to<JsonObject>();
+    sched["idleShare"] = scheduler.getIdleShare() / 10.0;
+    JsonArray taskList = sched["tasks"].to<JsonArray>();
+    for (int i = 0; i < scheduler.getCount(); i++) {
+        const Task& task = scheduler.getTask(i);
+        JsonObject t = taskList.add<JsonObject>();
+        t["name"] = task.name;
+        t["periodMs"] = task.periodMs;
+        t["priority"] = task.priority;
+        t["budgetUs"] = task.budgetUs;
+        t["runs"] = task.stats.runs;
+        t["overruns"] = task.stats.overruns;
+        t["skipped"] = task.stats.skipped;
+        t["maxRunUs"] = task.stats.maxRunUs;
+        t["maxLatenessMs"] = task.stats.maxLatenessMs;
+        t["utilization"] = task.stats.utilization / 10.0;   // 百分比
     }
     
+#if DISPLAY_ENABLED
+    // OLED 刷新统计
+    const DisplayStats& displayStats = display.getStats();
+    JsonObject disp = doc["display"].to<JsonObject>();
+    disp["pageBuffer"] = DISPLAY_PAGE_BUFFER;
+    disp["frames"] = displayStats.frames;
+    disp["unchanged"] = displayStats.unchanged;
+    disp["rowsSent"] = displayStats.rowsSent;
+    disp["chunks"] = displayStats.chunks;
+    disp["slices"] = displayStats.slices;
+    disp["sliceBudgetUs"] = DISPLAY_SLICE_US;
+    disp["maxSliceUs"] = displayStats.maxSliceUs;
+    disp["maxChunkUs"] = displayStats.maxChunkUs;
+    disp["lastFrameMs"] = displayStats.lastFrameMs;
+    disp["maxFrameMs"] = displayStats.maxFrameMs;
+#endif
+    
+    // 设备发现统计
+    const DiscoveryStats& discoveryStats = discoveryManager.getStats();
+    JsonObject discovery = doc["discovery"].to<JsonObject>();
+    discovery["hostname"] = discoveryManager.getHostname();
+    discovery["mdns"] = discoveryStats.mdnsStarted;
+    discovery["stateVersion"] = timerManager->getStateVersion();
+    discovery["beacons"] = discoveryStats.beacons;
+    discovery["changeBeacons"] = discoveryStats.changeBeacons;
+    discovery["beaconErrors"] = discoveryStats.beaconErrors;
+    
+#if MQTT_ENABLED
+    // MQTT 统计
+    const MqttStats& mqttStats = mqttManager.getStats();
+    JsonObject mqtt = doc["mqtt"].to<JsonObject>();
+    mqtt["broker"] = MQTT_BROKER;
+    mqtt["topic"] = mqttManager.getTopicBase();
+    mqtt["connected"] = mqttManager.isConnected();
+    mqtt["connects"] = mqttStats.connects;
+    mqtt["connectFailures"] = mqttStats.connectFailures;
+    mqtt["disconnects"] = mqttStats.disconnects;
+    mqtt["ackedSeq"] = mqttManager.getAckedSeq();
+    mqtt["pendingEvents"] = timerManager->getHistory().getLastSeq() - mqttManager.getAckedSeq();
+    mqtt["eventsAcked"] = mqttStats.eventsAcked;
+    mqtt["eventsResent"] = mqttStats.eventsResent;
+    mqtt["eventsLost"] = mqttStats.eventsLost;
+    mqtt["statePublished"] = mqttStats.statePublished;
+    mqtt["commands"] = mqttStats.commands;
+    mqtt["commandErrors"] = mqttStats.commandErrors;
+    mqtt["droppedPackets"] = mqttStats.droppedPackets;
+    mqtt["sendDeferred"] = mqttStats.sendDeferred;
+    mqtt["acksDeferred"] = mqttStats.acksDeferred;
+#endif
+    
+    // 省电模式统计
+    const PowerStats& powerStats = powerManager.getStats();
+    JsonObject power = doc["power"].to<JsonObject>();
+    power["enabled"] = powerManager.isEnabled();
+    power["sleeps"] = powerStats.sleeps;
+    power["sleptMs"] = powerStats.sleptMs;
+    power["sleepShare"] = millis() ? (float)powerStats.sleptMs / millis() : 0;
+    power["packetWakes"] = powerStats.packetWakes;
+    power["deadlineWakes"] = powerStats.deadlineWakes;
+    power["lateWakes"] = powerStats.lateWakes;
+    power["missedDeadlines"] = powerStats.missedDeadlines;
+    power["maxLatenessMs"] = powerStats.maxLatenessMs;
+    power["avgLatenessMs"] = powerStats.lateWakes ? (float)powerStats.totalLatenessMs / powerStats.lateWakes : 0;
+    power["estimatedCurrentMa"] = powerManager.getEstimatedCurrent();
+    
+    // 准入控制统计
+    const AdmissionStats& admissionStats = admission.getStats();
+    JsonObject adm = doc["admission"].to<JsonObject>();
+    adm["clientRate"] = ADMISSION_CLIENT_RATE;
+    adm["clientBurst"] = ADMISSION_CLIENT_BURST;
+    adm["httpShare"] = ADMISSION_HTTP_SHARE;
+    adm["budgetMs"] = admission.getBudgetMs();
+    adm["admitted"] = admissionStats.admitted;
+    adm["shedClient"] = admissionStats.shedClient;
+    adm["shedBusy"] = admissionStats.shedBusy;
+    adm["evicted"] = admissionStats.evicted;
+    adm["busyMs"] = admissionStats.busyMs;
+    adm["maxRequestMs"] = admissionStats.maxRequestMs;
+    JsonArray admClients = adm["clients"].to<JsonArray>();
+    const ClientBucket* buckets = admission.getClients();
+    for (int i = 0; i < ADMISSION_CLIENTS && buckets[i].ip; i++) {
+        JsonObject c = admClients.add<JsonObject>();
+        c["ip"] = IPAddress(buckets[i].ip).toString();
+        c["admitted"] = buckets[i].admitted;
+        c["shed"] = buckets[i].shed;
+    }
+    
+    // 路由表统计
+    const RouteStats& routeStats = routes.getStats();
+    JsonObject routing = doc["routes"].to<JsonObject>();
+    routing["count"] = routes.getCount();
+    routing["matched"] = routeStats.matched;
+    routing["missed"] = routeStats.missed;
+    routing["badParam"] = routeStats.badParam;
+    routing["probes"] = routeStats.probes;
+    
+    // 持久连接统计
+    JsonObject conn = doc["connections"].to<JsonObject>();
+    conn["idleTimeout"] = KEEPALIVE_IDLE_TIMEOUT;
+    conn["maxRequests"] = KEEPALIVE_MAX_REQUESTS;
+    conn["connections"] = connStats.connections;
+    conn["requests"] = connStats.requests;
+    conn["reused"] = connStats.reused;
+    conn["reuseRatio"] = connStats.requests ? (float)connStats.reused / connStats.requests : 0;
+    conn["requestsPerConnection"] = connStats.connections ? (float)connStats.requests / connStats.connections : 0;
+    conn["maxRequestsPerConnection"] = connStats.maxRequestsPerConnection;
+    conn["pipelined"] = connStats.pipelined;
+    conn["idleClosed"] = connStats.idleClosed;
+    conn["preempted"] = connStats.preempted;
+    conn["capClosed"] = connStats.capClosed;
+    
+    // 日志缓冲统计
+    const LogStats& logStats = logger.getStats();
+    JsonObject log = doc["log"].to<JsonObject>();
+    log["level"] = LOG_LEVEL;
+    log["lines"] = logStats.lines;
+    log["dropped"] = logStats.dropped;
+    log["truncated"] = logStats.truncated;
+    log["pending"] = logStats.pending;
+    log["peakPending"] = logStats.peakPending;
+    log["bufferSize"] = LOG_BUFFER_SIZE;
+    
     // 定时器统计
     JsonObject timerStats = doc["timerStats"].to<JsonObject>();
     timerStats["total"] = timerManager->getTimerCount();
     
     int enabled = 0, active = 0, repeatDaily = 0, oneTime = 0;
-    for (int i = 0; i < timerManager->getTimerCount(); i++) {
-        TimerConfig timer = timerManager->getTimer(i);
-        if (timer.enabled) enabled++;
-        if (timer.isActive) active++;
-        if (timer.repeatDaily) repeatDaily++;
+    for (int i = 0; i < MAX_TIMERS; i++) {
+        const TimerConfig* timer = timerManager->getTimerBySlot(i);
+        if (!timer) continue;
+        if (timer->enabled) enabled++;
+        if (timer->isActive) active++;
+        if (timer->repeatDaily) repeatDaily++;
         else oneTime++;
     }
     
@@ -252,26 +668,31 @@ void WebServer::handleGetSystemInfo() {
     eeprom["wifiConfigStart"] = WIFI_SSID_ADDR;
     eeprom["wifiConfigSize"] = TIMER_CONFIG_ADDR - WIFI_SSID_ADDR;
     eeprom["timerConfigStart"] = TIMER_CONFIG_ADDR;
-    eeprom["timerConfigUsed"] = 1 + (timerManager->getTimerCount() * 25); // 1 byte count + 25 bytes per timer (12 config + 13 runtime)
+    eeprom["timerConfigUsed"] = 1 + MAX_TIMERS * TIMER_SLOT_RECORD_SIZE; // 1 字节标记 + 每个槽位定长记录
     
     sendJSON(doc);
 }
 
 void WebServer::handleGetTimers() {
     enableCORS();
+    
+    BinaryFormat format = negotiateFormat();
+    if (format != FORMAT_JSON) {
+        String body;
+        BinaryWriter writer(format, body);
+        timerManager->writeTimers(writer);
+        server.send(200, formatContentType(format), body);
+        return;
+    }
+    
     server.send(200, "application/json", timerManager->getTimersJSON());
 }
 
 void WebServer::handleAddTimer() {
     enableCORS();
     
-    if (!server.hasArg("plain")) {
-        sendJSON(400, "缺少请求数据", false);
-        return;
-    }
-    
-    JsonDocument doc;
-    deserializeJson(doc, server.arg("plain"));
+    JsonDocument doc(&arena);
+    if (!parseBody(doc, BODY_TIMER_ADD)) return;
     
     int pin = doc["pin"];
     int hour = doc["hour"];
@@ -281,8 +702,14 @@ void WebServer::handleAddTimer() {
     bool isPWM = doc["isPWM"].as<bool>();
     int pwmValue = doc["pwmValue"].is<int>() ? doc["pwmValue"].as<int>() : 512; // 默认值50%
     
-    if (timerManager->addTimer(pin, hour, minute, duration, repeatDaily, isPWM, pwmValue)) {
-        sendJSON(200, "定时器添加成功");
+    uint16_t id = timerManager->addTimer(pin, hour, minute, duration, repeatDaily, isPWM, pwmValue);
+    if (id != INVALID_TIMER_ID) {
+        // 返回新定时器的稳定 ID，客户端无需重新列出定时器来查找
+        JsonDocument result(&arena);
+        result["success"] = true;
+        result["message"] = "定时器添加成功";
+        result["id"] = id;
+        sendJSON(result);
     } else {
         sendJSON(400, "定时器添加失败，请检查参数", false);
     }
@@ -291,22 +718,14 @@ void WebServer::handleAddTimer() {
 void WebServer::handleUpdateTimer() {
     enableCORS();
     
-    String uri = server.uri();
-    int lastSlash = uri.lastIndexOf('/');
-    if (lastSlash == -1) {
-        sendJSON(400, "无效的请求路径", false);
+    uint32_t id = routes.getParam();
+    if (id > UINT16_MAX) {
+        sendJSON(404, "定时器不存在或已被删除", false);
         return;
     }
     
-    int index = uri.substring(lastSlash + 1).toInt();
-    
-    if (!server.hasArg("plain")) {
-        sendJSON(400, "缺少请求数据", false);
-        return;
-    }
-    
-    JsonDocument doc;
-    deserializeJson(doc, server.arg("plain"));
+    JsonDocument doc(&arena);
+    if (!parseBody(doc, BODY_TIMER_UPDATE)) return;
     
     int pin = doc["pin"];
     int hour = doc["hour"];
@@ -317,7 +736,9 @@ void WebServer::handleUpdateTimer() {
     bool isPWM = doc["isPWM"].as<bool>();
     int pwmValue = doc["pwmValue"].is<int>() ? doc["pwmValue"].as<int>() : 512; // 默认值50%
     
-    if (timerManager->updateTimer(index, pin, hour, minute, duration, enabled, repeatDaily, isPWM, pwmValue)) {
+    if (!timerManager->findTimer(id)) {
+        sendJSON(404, "定时器不存在或已被删除", false);
+    } else if (timerManager->updateTimer(id, pin, hour, minute, duration, enabled, repeatDaily, isPWM, pwmValue)) {
         sendJSON(200, "定时器更新成功");
     } else {
         sendJSON(400, "定时器更新失败", false);
@@ -327,22 +748,47 @@ void WebServer::handleUpdateTimer() {
 void WebServer::handleDeleteTimer() {
     enableCORS();
     
-    String uri = server.uri();
-    int lastSlash = uri.lastIndexOf('/');
-    if (lastSlash == -1) {
-        sendJSON(400, "无效的请求路径", false);
+    uint32_t id = routes.getParam();
+    if (id > UINT16_MAX) {
+        sendJSON(404, "定时器不存在或已被删除", false);
         return;
     }
     
-    int index = uri.substring(lastSlash + 1).toInt();
-    
-    if (timerManager->removeTimer(index)) {
+    if (timerManager->removeTimer(id)) {
         sendJSON(200, "定时器删除成功");
     } else {
-        sendJSON(400, "定时器删除失败", false);
+        sendJSON(404, "定时器不存在或已被删除", false);
     }
 }
 
+void WebServer::handleBatchTimers() {
+    enableCORS();
+    
+    JsonDocument doc(&arena);
+    if (!parseBody(doc, BODY_TIMER_BATCH)) return;
+    
+    // 支持 {"operations": [...]} 或直接传数组
+    JsonArray ops = doc["operations"].is<JsonArray>() ? doc["operations"].as<JsonArray>() : doc.as<JsonArray>();
+    if (ops.isNull() || ops.size() == 0) {
+        sendJSON(400, "缺少操作列表", false);
+        return;
+    }
+    
+    JsonDocument result(&arena);
+    JsonArray results = result["results"].to<JsonArray>();
+    if (!timerManager->applyBatch(ops, results)) {
+        result["success"] = false;
+        result["message"] = "批量操作校验失败，未做任何修改";
+        sendJSON(result, 400);
+        return;
+    }
+    
+    result["success"] = true;
+    result["message"] = "批量操作完成";
+    result["applied"] = ops.size();
+    sendJSON(result);
+}
+
 void WebServer::handleClearTimers() {
     enableCORS();
     
@@ -352,19 +798,178 @@ void WebServer::handleClearTimers() {
 
 void WebServer::handleGetPins() {
     enableCORS();
+    
+    BinaryFormat format = negotiateFormat();
+    if (format != FORMAT_JSON) {
+        String body;
+        BinaryWriter writer(format, body);
+        timerManager->writePins(writer);
+        server.send(200, formatContentType(format), body);
+        return;
+    }
+    
     server.send(200, "application/json", timerManager->getAvailablePinsJSON());
 }
 
-void WebServer::handleManualControl() {
+void WebServer::handleGetHistory() {
     enableCORS();
     
-    if (!server.hasArg("plain")) {
-        sendJSON(400, "缺少请求数据", false);
+    HistoryManager& history = timerManager->getHistory();
+    uint32_t after = server.hasArg("after") ? strtoul(server.arg("after").c_str(), nullptr, 10) : 0;
+    int limit = server.hasArg("limit") ? server.arg("limit").toInt() : HISTORY_PAGE_SIZE;
+    if (limit <= 0 || limit > HISTORY_PAGE_SIZE) limit = HISTORY_PAGE_SIZE;
+    
+    uint32_t oldest = history.getOldestSeq();
+    uint32_t latest = history.getLastSeq();
+    
+    // 序号在重启后从 1 重新开始：客户端带回的 boot 与本次启动不同，或游标超过最新序号时，
+    // 从最旧的保留记录重新开始，并通过 reset 告知客户端丢弃旧游标
+    bool reset = after > latest ||
+                 (server.hasArg("boot") && strtoul(server.arg("boot").c_str(), nullptr, 10) != history.getBootId());
+    if (reset) after = 0;
+    uint32_t seq = after + 1;
+    
+    JsonDocument doc(&arena);
+    doc["bootId"] = history.getBootId();
+    doc["reset"] = reset;
+    doc["oldest"] = oldest;
+    doc["latest"] = latest;
+    // 游标已落后于环形缓冲最旧的记录，中间的事件已被覆盖
+    doc["truncated"] = oldest > 0 && seq < oldest;
+    if (seq < oldest) seq = oldest;
+    
+    JsonArray events = doc["events"].to<JsonArray>();
+    uint32_t next = after;
+    for (int n = 0; n < limit && seq <= latest; n++, seq++) {
+        const ActivationRecord* r = history.get(seq);
+        if (!r) break;
+        JsonObject e = events.add<JsonObject>();
+        e["seq"] = r->seq;
+        e["timerId"] = r->timerId;
+        e["pin"] = r->pin;
+        e["start"] = r->epochStart;
+        e["requestedMs"] = r->requestedMs;
+        e["actualMs"] = r->actualMs;
+        e["pwmValue"] = r->pwmValue;
+        e["source"] = triggerSourceName(r->source);
+        next = r->seq;
+    }
+    doc["next"] = next;
+    doc["hasMore"] = next < latest;
+    
+    sendJSON(doc);
+}
+
+void WebServer::handleGetLogs() {
+    enableCORS();
+    
+    // 立即返回当前内容，由客户端轮询：服务器一次只服务一个连接，在处理函数中等待会阻塞其他客户端和主循环任务
+    uint32_t since = server.hasArg("since") ? strtoul(server.arg("since").c_str(), nullptr, 10) : 0;
+    uint32_t bootId = timerManager->getHistory().getBootId();
+    
+    // 偏移在重启后从 0 重新开始：客户端带回的 boot 与本次启动不同，或游标超过当前末尾时，
+    // 游标属于之前的启动，从最早保留的内容重新开始
+    bool reset = since > logger.getHead() ||
+                 (server.hasArg("boot") && strtoul(server.arg("boot").c_str(), nullptr, 10) != bootId);
+    
+    // 游标已被覆盖或已失效时从最早保留的完整行开始，并通过响应头告知
+    uint32_t oldest = logger.getOldest();
+    bool truncated = reset || since < oldest;
+    if (truncated) since = logger.alignToLine(oldest);
+    uint32_t next = logger.getHead();
+    
+    server.sendHeader("Access-Control-Expose-Headers", "X-Log-Offset, X-Log-Next, X-Log-Truncated, X-Log-Boot");
+    server.sendHeader("X-Log-Boot", String(bootId));
+    server.sendHeader("X-Log-Offset", String(since));
+    server.sendHeader("X-Log-Next", String(next));
+    server.sendHeader("X-Log-Truncated", truncated ? "1" : "0");
+    server.setContentLength(next - since);
+    server.send(200, "text/plain; charset=utf-8", "");
+    
+    // 直接从环形缓冲发送，最多分两段
+    while (since < next) {
+        const char* data;
+        size_t len = logger.getSpan(since, &data);
+        if (len == 0) break;
+        if (len > next - since) len = next - since;
+        server.sendContent(data, len);
+        since += len;
+    }
+}
+
+void WebServer::handleGetDailyStats() {
+    enableCORS();
+    
+    int days = server.hasArg("days") ? server.arg("days").toInt() : STATS_DAYS;
+    if (days <= 0 || days > STATS_DAYS) days = STATS_DAYS;
+    int pin = server.hasArg("pin") ? server.arg("pin").toInt() : -1;
+    
+    JsonDocument doc(&arena);
+    JsonArray list = doc["days"].to<JsonArray>();
+    // 直接读取预先汇总的结果，O(天数 × 引脚数)
+    for (int d = 0; d < days; d++) {
+        const DailyRollup* r = timerManager->getDailyStats(d);
+        if (!r) break;
+        JsonObject day = list.add<JsonObject>();
+        day["day"] = r->day;
+        day["start"] = r->day * 86400UL;
+        JsonArray pins = day["pins"].to<JsonArray>();
+        for (int i = 0; i < AVAILABLE_PINS_COUNT; i++) {
+            if (pin >= 0 && AVAILABLE_PINS[i] != pin) continue;
+            if (pin < 0 && r->onMs[i] == 0 && r->activations[i] == 0) continue;
+            JsonObject p = pins.add<JsonObject>();
+            p["pin"] = AVAILABLE_PINS[i];
+            p["onMs"] = r->onMs[i];
+            p["activations"] = r->activations[i];
+            // 平均占空比（0~PWM_MAX_VALUE），数字输出按满占空比计
+            p["avgDuty"] = r->onMs[i] > 0 ? (uint32_t)((uint64_t)r->dutyMs[i] * PWM_MAX_VALUE / r->onMs[i]) : 0;
+        }
+    }
+    
+    sendJSON(doc);
+}
+
+void WebServer::handleGetArchive() {
+    enableCORS();
+    
+    JsonDocument doc(&arena);
+    doc["mounted"] = archiveManager->isMounted();
+    doc["blocks"] = archiveManager->getBlockCount();
+    doc["maxBlocks"] = ARCHIVE_MAX_BLOCKS;
+    doc["bytes"] = archiveManager->getTotalBytes();
+    doc["pending"] = archiveManager->getPendingCount();
+    doc["recordsWritten"] = archiveManager->getRecordsWritten();
+    doc["recordsLost"] = archiveManager->getRecordsLost();
+    
+    sendJSON(doc);
+}
+
+void WebServer::handleExportArchive() {
+    enableCORS();
+    
+    if (!archiveManager->isMounted()) {
+        sendJSON(503, "归档存储不可用", false);
         return;
     }
     
-    JsonDocument doc;
-    deserializeJson(doc, server.arg("plain"));
+    // 先把内存中尚未写入的记录落盘，再按时间范围流式导出 CSV
+    archiveManager->flush();
+    uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10) : 0;
+    uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), nullptr, 10) : 0;
+    
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/csv", "");
+    ChunkedPrint out(server);
+    archiveManager->exportCSV(from, to, out);
+    out.flush();
+    server.sendContent("");
+}
+
+void WebServer::handleManualControl() {
+    enableCORS();
+    
+    JsonDocument doc(&arena);
+    if (!parseBody(doc, BODY_MANUAL)) return;
     
     int pin = doc["pin"];
     float duration = doc["duration"];
@@ -378,13 +983,8 @@ void WebServer::handleManualControl() {
 void WebServer::handleWiFiConfig() {
     enableCORS();
     
-    if (!server.hasArg("plain")) {
-        sendJSON(400, "缺少请求数据", false);
-        return;
-    }
-    
-    JsonDocument doc;
-    deserializeJson(doc, server.arg("plain"));
+    JsonDocument doc(&arena);
+    if (!parseBody(doc, BODY_WIFI)) return;
     
     String ssid = doc["ssid"];
     String password = doc["password"];
@@ -401,6 +1001,7 @@ void WebServer::handleWiFiConfig() {
     
     // 延迟重启以确保响应发送完成
     delay(1000);
+    logger.flush();
     ESP.restart();
 }
 
@@ -414,6 +1015,7 @@ void WebServer::handleWiFiReset() {
     
     // 延迟重启
     delay(1000);
+    logger.flush();
     ESP.restart();
 }
 
@@ -427,24 +1029,179 @@ void WebServer::handleRestartAP() {
     
     // 延迟重启
     delay(1000);
+    logger.flush();
     ESP.restart();
 }
 
 void WebServer::sendJSON(int code, const String& message, bool success) {
-    JsonDocument doc;
+    JsonDocument doc(&arena);
     doc["success"] = success;
     doc["message"] = message;
     
-    String response;
-    serializeJson(doc, response);
-    
+    sendJSON(doc, code);
+}
+
+void WebServer::sendJSON(JsonDocument& doc, int code) {
+    // 响应直接序列化到内存池，不经过 String
+    size_t length = measureJson(doc);
+    char* response = (char*)arena.allocate(length + 1);
+    if (!response) {
+        server.send(500, "application/json", "{\"success\":false}");
+        return;
+    }
+    serializeJson(doc, response, length + 1);
     server.send(code, "application/json", response);
+    arena.deallocate(response);
+}
+
+void WebServer::sendAsset(const WebAsset& asset, bool immutable) {
+    // 页面每次都要向服务器校验（内容随固件变化），带哈希的资源可以永久缓存
+    server.sendHeader("ETag", asset.etag);
+    server.sendHeader("Cache-Control", immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    
+    if (server.header("If-None-Match") == asset.etag) {
+        server.send(304);
+        return;
+    }
+    
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, asset.contentType, (PGM_P)asset.data, asset.length);
+}
+
+BinaryFormat WebServer::negotiateFormat() {
+    const String& accept = server.header("Accept");
+    if (accept.indexOf("application/cbor") >= 0) {
+        return FORMAT_CBOR;
+    }
+    if (accept.indexOf("msgpack") >= 0) {
+        // application/msgpack、application/x-msgpack、application/vnd.msgpack
+        return FORMAT_MSGPACK;
+    }
+    return FORMAT_JSON;
+}
+
+static void addTimerFields(JsonObject f) {
+    f["pin"] = true;
+    f["hour"] = true;
+    f["minute"] = true;
+    f["duration"] = true;
+    f["enabled"] = true;
+    f["repeatDaily"] = true;
+    f["isPWM"] = true;
+    f["pwmValue"] = true;
+}
+
+void WebServer::buildFilters() {
+    addTimerFields(timerFilter.to<JsonObject>());
+    
+    JsonObject op = batchFilter["operations"].to<JsonArray>().add<JsonObject>();
+    addTimerFields(op);
+    op["op"] = true;
+    op["id"] = true;
+    batchArrayFilter.to<JsonArray>().add(op);
+    
+    manualFilter["pin"] = true;
+    manualFilter["duration"] = true;
+    manualFilter["isPWM"] = true;
+    manualFilter["pwmValue"] = true;
+    
+    wifiFilter["ssid"] = true;
+    wifiFilter["password"] = true;
 }
 
-void WebServer::sendJSON(JsonDocument& doc) {
-    String response;
-    serializeJson(doc, response);
-    server.send(200, "application/json", response);
+void WebServer::receiveBody(BodyRoute route) {
+    HTTPRaw& raw = server.raw();
+    size_t limit = BODY_LIMITS[route];
+    
+    if (raw.status == RAW_START) {
+        bodyLength = 0;
+        bodyTooLarge = false;
+        bodyResponded = false;
+        bodyHeapStart = ESP.getFreeHeap();
+        bodyStats[route].requests++;
+        
+        // 声明的长度已超限：直接回复 413 并断开，不再读取剩余数据
+        if (server.clientContentLength() > limit) {
+            bodyTooLarge = true;
+            bodyStats[route].rejected++;
+            enableCORS();
+            server.sendHeader("Connection", "close");
+            sendJSON(413, "请求数据过大", false);
+            server.client().stop();
+            bodyResponded = true;
+        }
+    } else if (raw.status == RAW_WRITE) {
+        if (bodyTooLarge) return;
+        if (bodyLength + raw.currentSize > limit) {
+            bodyTooLarge = true;
+            bodyStats[route].rejected++;
+            return;
+        }
+        memcpy(body + bodyLength, raw.buf, raw.currentSize);
+        bodyLength += raw.currentSize;
+    } else if (raw.status == RAW_ABORTED) {
+        bodyLength = 0;
+    }
+}
+
+bool WebServer::parseBody(JsonDocument& doc, BodyRoute route) {
+    size_t length = bodyLength;
+    bool tooLarge = bodyTooLarge;
+    bool responded = bodyResponded;
+    bodyLength = 0;
+    bodyTooLarge = false;
+    bodyResponded = false;
+    
+    // 声明的长度超限时 receiveBody() 已回复过 413，这里只在接收过程中才发现超限时回复
+    if (responded) return false;
+    if (tooLarge) {
+        sendJSON(413, "请求数据过大", false);
+        return false;
+    }
+    if (length == 0) {
+        sendJSON(400, "缺少请求数据", false);
+        return false;
+    }
+    
+    // 批量接口同时接受对象和数组两种形式，按首字节选择过滤器
+    JsonDocument* filter = &timerFilter;
+    if (route == BODY_TIMER_BATCH) {
+        size_t i = 0;
+        while (i < length && isspace((unsigned char)body[i])) i++;
+        uint8_t first = i < length ? body[i] : 0;
+        bool isArray = first == '[' || (first >= 0x90 && first <= 0x9F) || first == 0xDC || first == 0xDD;
+        filter = isArray ? &batchArrayFilter : &batchFilter;
+    } else if (route == BODY_MANUAL) {
+        filter = &manualFilter;
+    } else if (route == BODY_WIFI) {
+        filter = &wifiFilter;
+    }
+    
+    const String& contentType = server.header("Content-Type");
+    DeserializationError error;
+    
+    if (contentType.indexOf("msgpack") >= 0) {
+        error = deserializeMsgPack(doc, (const uint8_t*)body, length, DeserializationOption::Filter(*filter));
+    } else if (contentType.indexOf("application/cbor") >= 0) {
+        sendJSON(415, "请求体暂不支持 CBOR，请使用 JSON 或 MessagePack", false);
+        return false;
+    } else {
+        error = deserializeJson(doc, (const char*)body, length, DeserializationOption::Filter(*filter));
+    }
+    
+    // 从开始接收到解析完成的堆占用（不含 Web 服务器自身的接收缓冲）
+    BodyRouteStats& stats = bodyStats[route];
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (bodyHeapStart > freeHeap && bodyHeapStart - freeHeap > stats.peakHeap) {
+        stats.peakHeap = bodyHeapStart - freeHeap;
+    }
+    if (length > stats.maxBody) stats.maxBody = length;
+    
+    if (error) {
+        sendJSON(400, "请求数据格式错误", false);
+        return false;
+    }
+    return true;
 }
 
 void WebServer::enableCORS() {
@@ -460,7 +1217,7 @@ void WebServer::enableCORS() {
 void WebServer::handleGetPWMConfig() {
     enableCORS();
     
-    JsonDocument doc;
+    JsonDocument doc(&arena);
     doc["frequency"] = PWM_FREQUENCY;
     doc["resolution"] = PWM_RESOLUTION;
     doc["maxValue"] = PWM_MAX_VALUE;
@@ -470,46 +1227,107 @@ void WebServer::handleGetPWMConfig() {
     sendJSON(doc);
 }
 
+void WebServer::handleEncodingBenchmark() {
+    enableCORS();
+    
+    // 在设备上对同一份定时器数据分别用 serializeJson 和二进制编码器编码，比较体积与耗时
+    const int rounds = 20;
+    JsonDocument doc(&arena);
+    
+    unsigned long start = micros();
+    size_t jsonBytes = 0;
+    for (int i = 0; i < rounds; i++) {
+        jsonBytes = timerManager->getTimersJSON().length();
+    }
+    unsigned long jsonUs = (micros() - start) / rounds;
+    
+    const BinaryFormat formats[] = {FORMAT_MSGPACK, FORMAT_CBOR};
+    const char* names[] = {"msgpack", "cbor"};
+    for (int f = 0; f < 2; f++) {
+        size_t bytes = 0;
+        start = micros();
+        for (int i = 0; i < rounds; i++) {
+            String body;
+            BinaryWriter writer(formats[f], body);
+            timerManager->writeTimers(writer);
+            bytes = body.length();
+        }
+        JsonObject result = doc[names[f]].to<JsonObject>();
+        result["bytes"] = bytes;
+        result["us"] = (micros() - start) / rounds;
+    }
+    
+    JsonObject json = doc["json"].to<JsonObject>();
+    json["bytes"] = jsonBytes;
+    json["us"] = jsonUs;
+    doc["timers"] = timerManager->getTimerCount();
+    doc["rounds"] = rounds;
+    
+    sendJSON(doc);
+}
+
 void WebServer::handleFirmwareUpdate() {
     HTTPUpload& upload = server.upload();
     
     if (upload.status == UPLOAD_FILE_START) {
-        Serial.printf("固件更新开始: %s\n", upload.filename.c_str());
+        LOG_INFO("固件更新开始: %s", upload.filename.c_str());
         
-        // 检查文件扩展名
-        if (!upload.filename.endsWith(".bin")) {
-            Serial.println("错误：不支持的文件格式");
+        // 检查文件扩展名：.bin 或 gzip 压缩的 .bin.gz
+        if (!upload.filename.endsWith(".bin") && !upload.filename.endsWith(".bin.gz")) {
+            LOG_ERROR("不支持的文件格式");
+            ota.fail("不支持的文件格式");
             return;
         }
         
-        // 开始OTA更新
-        uint32_t maxSketchSpace = (ESP.getFreeSketchSpace() - 0x1000) & 0xFFFFF000;
-        if (!Update.begin(maxSketchSpace)) {
-            Serial.println("错误：无法开始固件更新");
-            Update.printError(Serial);
-            return;
-        }
-        Serial.println("固件更新已开始...");
+        // 预期摘要和大小通过查询参数传入：/api/firmware/update?md5=...&sha256=...&size=...
+        size_t expected = server.hasArg("size") ? strtoul(server.arg("size").c_str(), nullptr, 10) : server.clientContentLength();
+        ota.begin(expected, server.arg("md5"), server.arg("sha256"));
     }
     else if (upload.status == UPLOAD_FILE_WRITE) {
-        // 写入固件数据
-        Serial.printf("写入 %u 字节...\n", upload.currentSize);
-        if (Update.write(upload.buf, upload.currentSize) != upload.currentSize) {
-            Serial.println("错误：固件写入失败");
-            Update.printError(Serial);
-        }
+        // 不逐块打印日志，串口输出会拖慢上传
+        ota.write(upload.buf, upload.currentSize);
+        
+        // 上传期间主循环被阻塞，在这里继续驱动定时器并输出缓冲日志
+        timerManager->update();
+        logger.drain();
     }
     else if (upload.status == UPLOAD_FILE_END) {
-        // 完成固件更新
-        if (Update.end(true)) {
-            Serial.printf("固件更新成功: %u 字节\n", upload.totalSize);
-        } else {
-            Serial.println("错误：固件更新完成失败");
-            Update.printError(Serial);
-        }
+        ota.end();
     }
     else if (upload.status == UPLOAD_FILE_ABORTED) {
-        Update.end();
-        Serial.println("固件更新被中止");
+        ota.abort();
+    }
+}
+
+void WebServer::handleFirmwareStatus() {
+    enableCORS();
+    
+    const OtaStatus& status = ota.getStatus();
+    JsonDocument doc(&arena);
+    doc["state"] = otaStateName(status.state);
+    doc["received"] = status.received;
+    doc["expected"] = status.expected;
+    if (status.expected > 0) {
+        doc["percent"] = min(100, (int)((uint64_t)status.received * 100 / status.expected));
+    }
+    doc["elapsedMs"] = ota.getElapsed();
+    doc["bytesPerSecond"] = ota.getBytesPerSecond();
+    doc["md5Checked"] = status.md5Checked;
+    doc["sha256Checked"] = status.sha256Checked;
+    doc["compressed"] = status.compressed;
+    if (status.state == OTA_SUCCESS) {
+        doc["imageSize"] = status.imageSize;
+        if (status.compressed && status.imageSize > 0) {
+            doc["compressionRatio"] = (float)status.received / status.imageSize;
+        }
+    }
+    if (status.error) {
+        doc["error"] = status.error;
     }
+    doc["uploadBufferSize"] = HTTP_UPLOAD_BUFLEN;
+    if (status.state != OTA_IDLE) {
+        doc["minFreeHeap"] = status.minFreeHeap;
+    }
+    
+    sendJSON(doc);
 }
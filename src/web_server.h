@@ -7,22 +7,112 @@
 #include "wifi_manager.h"
 #include "timer_manager.h"
 #include "time_manager.h"
+#include "archive_manager.h"
+#include "request_arena.h"
+#include "ota_manager.h"
+#include "route_table.h"
+#include "admission_control.h"
 #include "web_pages.h"
 
+// 带请求体的路由
+enum BodyRoute {
+    BODY_TIMER_ADD,
+    BODY_TIMER_UPDATE,
+    BODY_TIMER_BATCH,
+    BODY_MANUAL,
+    BODY_WIFI,
+    BODY_ROUTE_COUNT
+};
+
+// 每个路由的请求体统计
+struct BodyRouteStats {
+    unsigned long requests;
+    unsigned long rejected;         // 超出大小限制被拒绝
+    size_t maxBody;                 // 最大请求体字节数
+    uint32_t peakHeap;              // 接收到解析完成之间的最大堆占用
+};
+
+// 请求前后的堆状态，用于确认长期运行时堆不会逐渐碎片化
+struct RequestHeapStats {
+    unsigned long requests;
+    uint32_t freeBefore;            // 最近一次请求开始/结束时的空闲堆
+    uint32_t freeAfter;
+    uint32_t maxBlockBefore;        // 最近一次请求开始/结束时的最大连续空闲块
+    uint32_t maxBlockAfter;
+    uint8_t fragBefore;             // 最近一次请求开始/结束时的碎片率（%）
+    uint8_t fragAfter;
+    uint8_t maxFragAfter;
+    uint32_t minMaxBlockAfter;
+};
+
+// 持久连接统计
+struct ConnectionStats {
+    unsigned long connections;      // 建立的连接数
+    unsigned long requests;
+    unsigned long reused;           // 在已有连接上处理的请求（省去握手）
+    unsigned long pipelined;        // 响应发送时下一个请求已在接收缓冲中
+    unsigned long idleClosed;       // 空闲超时关闭
+    unsigned long preempted;        // 有新连接等待时关闭的空闲连接
+    unsigned long capClosed;        // 达到单连接请求上限后关闭
+    unsigned long maxRequestsPerConnection;
+};
+
 class WebServer {
+    friend class RouteTable;
+    
 private:
     ESP8266WebServer server;
     WiFiManager* wifiManager;
     TimerManager* timerManager;
     TimeManager* timeManager;
+    ArchiveManager* archiveManager;
+    
+    // 请求体直接接收到静态缓冲，不经过 String
+    char body[BODY_BUFFER_SIZE];
+    size_t bodyLength;
+    bool bodyTooLarge;
+    bool bodyResponded;                  // 接收阶段已回复 413 并断开，处理函数不再回复
+    uint32_t bodyHeapStart;
+    BodyRouteStats bodyStats[BODY_ROUTE_COUNT];
+    
+    // 解析时只保留各路由需要的字段
+    JsonDocument timerFilter;
+    JsonDocument batchFilter;
+    JsonDocument batchArrayFilter;
+    JsonDocument manualFilter;
+    JsonDocument wifiFilter;
+    
+    RequestArena arena;
+    OtaManager ota;
+    RequestHeapStats heapStats;
+    bool requestActive;
+    AdmissionControl admission;
+    
+    // 当前持久连接
+    ConnectionStats connStats;
+    IPAddress connIP;
+    uint16_t connPort;
+    unsigned long connRequests;
+    unsigned long connLastActive;
+    bool connOpen;
+    bool connKeepAlive;
+    
+    // API 路由表（编译期构建）
+    static const Route ROUTES[];
+    static const size_t ROUTE_COUNT;
+    RouteTable routes;
     
 public:
-    WebServer(WiFiManager* wm, TimerManager* tm, TimeManager* timeM);
+    WebServer(WiFiManager* wm, TimerManager* tm, TimeManager* timeM, ArchiveManager* am);
     void begin();
     void handleClient();
+    bool hasPendingClient();
     
 private:
     void setupRoutes();
+    void trackConnection(WiFiClient* client);
+    void shedRequest(WiFiClient* client, AdmissionResult result, uint32_t retryAfter);
+    void manageConnection();
     
     // 页面路由
     void handleRoot();
@@ -34,18 +124,32 @@ private:
     void handleAddTimer();
     void handleUpdateTimer();
     void handleDeleteTimer();
+    void handleBatchTimers();
     void handleClearTimers();
     void handleGetPins();
+    void handleGetHistory();
+    void handleGetLogs();
+    void handleGetDailyStats();
+    void handleGetArchive();
+    void handleExportArchive();
     void handleGetPWMConfig();
     void handleManualControl();
     void handleWiFiConfig();
     void handleWiFiReset();
     void handleRestartAP();
     void handleFirmwareUpdate();
+    void handleFirmwareInfo();
+    void handleFirmwareStatus();
+    void handleEncodingBenchmark();
     
     // 工具函数
     void sendJSON(int code, const String& message, bool success = true);
-    void sendJSON(JsonDocument& doc);
+    void sendJSON(JsonDocument& doc, int code = 200);
+    void sendAsset(const WebAsset& asset, bool immutable);
+    BinaryFormat negotiateFormat();
+    void buildFilters();
+    void receiveBody(BodyRoute route);
+    bool parseBody(JsonDocument& doc, BodyRoute route);
     void enableCORS();
 };
 
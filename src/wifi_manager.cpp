@@ -1,31 +1,31 @@
 #include "wifi_manager.h"
+#include "logger.h"
+#include "boot_profile.h"
 
 WiFiManager::WiFiManager() {
     isAPMode = false;
+    connecting = false;
+    connectStart = 0;
 }
 
-bool WiFiManager::begin() {
+void WiFiManager::begin() {
     EEPROM.begin(EEPROM_SIZE);
     
     savedSSID = loadWiFiSSID();
     savedPassword = loadWiFiPassword();
     
-    Serial.println("WiFi Manager 初始化");
-    Serial.println("保存的 SSID: " + savedSSID);
+    LOG_INFO("WiFi Manager 初始化，保存的 SSID: %s", savedSSID.c_str());
     
-    // 如果有保存的 WiFi 信息，尝试连接
+    // 如果有保存的 WiFi 信息，在后台连接，由 handleWiFiConnection() 推进
     if (savedSSID.length() > 0) {
-        Serial.println("尝试连接到保存的 WiFi...");
-        if (connectToWiFi(savedSSID, savedPassword)) {
-            Serial.println("连接成功！IP: " + WiFi.localIP().toString());
-            return true;
-        }
+        LOG_INFO("后台连接保存的 WiFi...");
+        startConnect();
+        return;
     }
     
-    // 连接失败或没有保存的信息，启动 AP 模式
-    Serial.println("启动 AP 模式");
+    // 没有保存的信息，启动 AP 模式
+    LOG_INFO("启动 AP 模式");
     setupAP();
-    return false;
 }
 
 void WiFiManager::setupAP() {
@@ -34,28 +34,15 @@ void WiFiManager::setupAP() {
     WiFi.softAP(DEFAULT_AP_SSID);
     isAPMode = true;
     
-    Serial.println("AP 模式启动");
-    Serial.println("SSID: " + String(DEFAULT_AP_SSID));
-    Serial.println("密码: 无密码");
-    Serial.println("AP IP: " + WiFi.softAPIP().toString());
+    LOG_INFO("AP 模式启动，SSID: %s，密码: 无密码，AP IP: %s", DEFAULT_AP_SSID, WiFi.softAPIP().toString().c_str());
 }
 
-bool WiFiManager::connectToWiFi(const String& ssid, const String& password) {
+void WiFiManager::startConnect() {
     WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid.c_str(), password.c_str());
-    
-    unsigned long startTime = millis();
-    while (WiFi.status() != WL_CONNECTED && millis() - startTime < WIFI_TIMEOUT) {
-        delay(500);
-        Serial.print(".");
-    }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-        isAPMode = false;
-        return true;
-    }
-    
-    return false;
+    WiFi.begin(savedSSID.c_str(), savedPassword.c_str());
+    isAPMode = false;
+    connecting = true;
+    connectStart = millis();
 }
 
 void WiFiManager::saveWiFiCredentials(const String& ssid, const String& password) {
@@ -79,7 +66,7 @@ void WiFiManager::saveWiFiCredentials(const String& ssid, const String& password
     savedSSID = ssid;
     savedPassword = password;
     
-    Serial.println("WiFi 凭据已保存");
+    LOG_INFO("WiFi 凭据已保存");
 }
 
 String WiFiManager::loadWiFiSSID() {
@@ -110,6 +97,10 @@ bool WiFiManager::isInAPMode() {
     return isAPMode;
 }
 
+bool WiFiManager::isConnecting() {
+    return connecting;
+}
+
 String WiFiManager::getLocalIP() {
     if (isConnected()) {
         return WiFi.localIP().toString();
@@ -124,12 +115,27 @@ String WiFiManager::getAPIP() {
     return "";
 }
 
+// 由主循环定期调用：推进后台连接，超时后切换到 AP 模式；连接丢失时重新连接
 void WiFiManager::handleWiFiConnection() {
-    if (!isAPMode && WiFi.status() != WL_CONNECTED) {
-        Serial.println("WiFi 连接丢失，重新连接...");
-        if (!connectToWiFi(savedSSID, savedPassword)) {
-            Serial.println("重连失败，启动 AP 模式");
+    if (isAPMode) return;
+    
+    if (connecting) {
+        if (WiFi.status() == WL_CONNECTED) {
+            connecting = false;
+            LOG_INFO("WiFi 连接成功，用时 %lums，可通过 http://%s 访问",
+                     millis() - connectStart, WiFi.localIP().toString().c_str());
+            bootProfile.milestone("wifi_connected");
+        } else if (millis() - connectStart >= WIFI_TIMEOUT) {
+            connecting = false;
+            LOG_WARN("WiFi 连接超时，启动 AP 模式");
+            LOG_WARN("⚠️  AP 模式下定时器功能受限，请连接 WiFi 以启用完整功能");
             setupAP();
         }
+        return;
+    }
+    
+    if (WiFi.status() != WL_CONNECTED) {
+        LOG_WARN("WiFi 连接丢失，重新连接...");
+        startConnect();
     }
 }
@@ -10,17 +10,21 @@ private:
     String savedSSID;
     String savedPassword;
     bool isAPMode;
+    bool connecting;                 // 正在后台连接保存的 WiFi
+    unsigned long connectStart;
+    
+    void startConnect();
     
 public:
     WiFiManager();
-    bool begin();
+    void begin();
     void setupAP();
-    bool connectToWiFi(const String& ssid, const String& password);
     void saveWiFiCredentials(const String& ssid, const String& password);
     String loadWiFiSSID();
     String loadWiFiPassword();
     bool isConnected();
     bool isInAPMode();
+    bool isConnecting();
     String getLocalIP();
     String getAPIP();
     void handleWiFiConnection();
@@ -0,0 +1,268 @@
+"""
+网页资源构建脚本：把 web/ 下的 HTML/CSS/JS 压缩、计算内容哈希并生成 src/web_pages.h
+
+- 页面中引用的本地 CSS/JS：只被一个页面使用的直接内联；被多个页面引用的作为独立资源输出，
+  路径带内容哈希（如 /common.1a2b3c4d.js），浏览器可长期缓存，闪存中也只存一份
+- 所有资源以 gzip 形式存入 PROGMEM，由 Web 服务器带 Content-Encoding: gzip 和 ETag 发送
+- 每次构建打印原始、压缩后和 gzip 后的大小；内容未变化时不改写头文件，避免触发重新编译
+
+作为 PlatformIO 的 pre 脚本运行（platformio.ini 中 extra_scripts = pre:tools/build_web.py），
+也可以直接执行：python3 tools/build_web.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821  由 PlatformIO (SCons) 提供
+    PROJECT_DIR = env.subst("$PROJECT_DIR")  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0])))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUTPUT = os.path.join(PROJECT_DIR, "src", "web_pages.h")
+
+# 页面：源文件 -> 头文件中的资源名
+PAGES = [
+    ("ap.html", "AP_MODE_PAGE"),
+    ("index.html", "INDEX_PAGE"),
+]
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+}
+
+LINK_RE = re.compile(r'<link rel="stylesheet" href="([\w.-]+\.css)">')
+SCRIPT_RE = re.compile(r'<script src="([\w.-]+\.js)"></script>')
+
+# JS 中两侧空格可以省略的标点
+JS_PUNCT = set("{}()[];,:=")
+
+
+def read(name):
+    with open(os.path.join(WEB_DIR, name), encoding="utf-8") as f:
+        return f.read()
+
+
+def minify_css(src):
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    src = re.sub(r"\s+", " ", src)
+    src = re.sub(r"\s*([{};,>])\s*", r"\1", src)
+    src = re.sub(r":\s+", ":", src)
+    return src.replace(";}", "}").strip()
+
+
+def minify_js(src):
+    """保守的 JS 压缩：去掉注释和缩进，保留换行（不依赖分号自动插入规则）。
+    识别字符串和模板字符串（含 ${} 嵌套），源码中不要使用正则字面量。"""
+    out = []
+    i = 0
+    n = len(src)
+    stack = []  # 模板字符串嵌套：'`' 表示在模板文本中，'{' 表示在 ${} 表达式中
+    while i < n:
+        c = src[i]
+        if stack and stack[-1] == "`":
+            # 模板文本原样保留
+            if c == "\\":
+                out.append(src[i:i + 2])
+                i += 2
+                continue
+            if c == "`":
+                stack.pop()
+            elif src.startswith("${", i):
+                stack.append("{")
+                out.append("${")
+                i += 2
+                continue
+            out.append(c)
+            i += 1
+            continue
+        if c in "'\"":
+            j = i + 1
+            while j < n and src[j] != c:
+                j += 2 if src[j] == "\\" else 1
+            out.append(src[i:j + 1])
+            i = j + 1
+            continue
+        if c == "`":
+            stack.append("`")
+            out.append(c)
+            i += 1
+            continue
+        if src.startswith("//", i):
+            while i < n and src[i] != "\n":
+                i += 1
+            continue
+        if src.startswith("/*", i):
+            i = src.index("*/", i) + 2
+            continue
+        if c == "{" and stack:
+            stack.append("{")
+        elif c == "}" and stack and stack[-1] == "{":
+            stack.pop()
+        if c in " \t\r\n":
+            j = i
+            while j < n and src[j] in " \t\r\n":
+                j += 1
+            if "\n" in src[i:j]:
+                out.append("\n")
+            elif not (out and out[-1][-1:] in JS_PUNCT) and not (j < n and src[j] in JS_PUNCT):
+                # 标点两侧的空格可以去掉，其余（如 let x、return x）必须保留
+                out.append(" ")
+            i = j
+            continue
+        out.append(c)
+        i += 1
+
+    lines = [line.strip() for line in "".join(out).split("\n")]
+    return "\n".join(line for line in lines if line)
+
+
+def minify_html(src):
+    src = re.sub(r"<!--.*?-->", "", src, flags=re.S)
+    src = re.sub(r">\s*\n\s*<", ">\n<", src)
+    src = re.sub(r"[ \t]*\n\s*", "\n", src)
+    src = re.sub(r"[ \t]{2,}", " ", src)
+    return src.strip()
+
+
+def minify(name, src):
+    ext = os.path.splitext(name)[1]
+    if ext == ".css":
+        return minify_css(src)
+    if ext == ".js":
+        return minify_js(src)
+    return minify_html(src)
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def gzip_bytes(data):
+    # 固定 mtime，保证相同输入生成相同输出
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def ident(name):
+    return re.sub(r"\W", "_", name).upper()
+
+
+def build():
+    pages = [(name, asset, read(name)) for name, asset in PAGES]
+
+    # 统计被多个页面引用的本地资源
+    refs = {}
+    for name, _, html in pages:
+        for ref in set(LINK_RE.findall(html) + SCRIPT_RE.findall(html)):
+            refs[ref] = refs.get(ref, 0) + 1
+    shared = sorted(ref for ref, count in refs.items() if count > 1)
+
+    assets = []   # (资源名, URL 路径, 源文件, 原始大小, 压缩后内容)
+    shared_paths = {}
+    for ref in shared:
+        src = read(ref)
+        data = minify(ref, src).encode("utf-8")
+        base, ext = os.path.splitext(ref)
+        path = "/%s.%s%s" % (base, content_hash(data), ext)
+        shared_paths[ref] = path
+        assets.append((ident(ref), path, ref, len(src.encode("utf-8")), data))
+
+    for name, asset, html in pages:
+        raw = len(html.encode("utf-8"))
+
+        def inline_css(m):
+            ref = m.group(1)
+            if ref in shared_paths:
+                return '<link rel="stylesheet" href="%s">' % shared_paths[ref]
+            nonlocal raw
+            src = read(ref)
+            raw += len(src.encode("utf-8"))
+            return "<style>%s</style>" % minify(ref, src)
+
+        def inline_js(m):
+            ref = m.group(1)
+            if ref in shared_paths:
+                return '<script src="%s"></script>' % shared_paths[ref]
+            nonlocal raw
+            src = read(ref)
+            raw += len(src.encode("utf-8"))
+            return "<script>\n%s\n</script>" % minify(ref, src)
+
+        # 先压缩 HTML 本身，再内联已压缩的 CSS/JS
+        out = minify_html(html)
+        out = LINK_RE.sub(inline_css, out)
+        out = SCRIPT_RE.sub(inline_js, out)
+        assets.append((asset, "/", name, raw, out.encode("utf-8")))
+
+    # 生成头文件
+    body = []
+    report = []
+    total_raw = total_min = total_gz = 0
+    for asset, path, source, raw, data in assets:
+        gz = gzip_bytes(data)
+        ext = os.path.splitext(source)[1]
+        body.append(c_array(asset + "_GZ", gz))
+        body.append('const WebAsset %s = {"%s", "%s", "\\"%s\\"", %s_GZ, sizeof(%s_GZ)};\n'
+                    % (asset, path, CONTENT_TYPES[ext], content_hash(data), asset, asset))
+        total_raw += raw
+        total_min += len(data)
+        total_gz += len(gz)
+        report.append("  %-22s %7d -> %7d (min) -> %6d (gzip)" % (path if path != "/" else source, raw, len(data), len(gz)))
+
+    shared_list = ", ".join("&" + ident(ref) for ref in shared)
+    summary = "源文件 %d 字节，压缩后 %d 字节，gzip 后 %d 字节（闪存减少 %.0f%%）" % (
+        total_raw, total_min, total_gz, 100.0 * (total_raw - total_gz) / total_raw)
+
+    header = """#ifndef WEB_PAGES_H
+#define WEB_PAGES_H
+
+// 由 tools/build_web.py 根据 web/ 目录生成，请勿手动修改
+// %s
+
+#include <Arduino.h>
+
+// gzip 压缩后的网页资源
+struct WebAsset {
+    const char* path;
+    const char* contentType;
+    const char* etag;
+    const uint8_t* data;
+    size_t length;
+};
+
+%s
+// 页面共用的独立资源，路径带内容哈希，可长期缓存
+const WebAsset* const SHARED_ASSETS[] = {%s};
+const size_t SHARED_ASSET_COUNT = sizeof(SHARED_ASSETS) / sizeof(SHARED_ASSETS[0]);
+
+#endif
+""" % (summary, "\n".join(body), shared_list)
+
+    old = None
+    if os.path.exists(OUTPUT):
+        with open(OUTPUT, encoding="utf-8") as f:
+            old = f.read()
+    if old != header:
+        with open(OUTPUT, "w", encoding="utf-8") as f:
+            f.write(header)
+
+    print("Web 资源:")
+    for line in report:
+        print(line)
+    print("  " + summary + ("" if old != header else "，未变化"))
+
+
+build()
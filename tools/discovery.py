@@ -0,0 +1,191 @@
+"""
+设备发现工具：监听 PetIO 组播状态信标，或在本机模拟多台设备
+
+  python3 tools/discovery.py listen [--fetch]
+      监听信标，列出设备；加 --fetch 时只在设备首次出现、状态版本变化或重启后请求 /api/status
+
+  python3 tools/discovery.py simulate -n 5 [--base-port 8081]
+      模拟 n 台设备：每台在不同端口提供 /api/status，并按设备固件的规则发送信标，
+      状态版本随机变化，可配合 listen 在没有硬件的情况下测试收集端
+
+信标格式与 src/discovery_manager.h 一致（小端，24 字节）。
+mDNS 服务可用系统工具查看，例如：avahi-browse -r _petio._tcp 或 dns-sd -B _petio._tcp
+"""
+
+import argparse
+import json
+import random
+import socket
+import struct
+import threading
+import time
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+GROUP = "239.255.80.73"
+PORT = 4210
+BEACON = struct.Struct("<4sBBHIIIBBH")
+MAGIC = b"PIOB"
+BEACON_INTERVAL = 10.0
+BEACON_MIN_GAP = 1.0
+
+
+def parse_beacon(data):
+    if len(data) < BEACON.size:
+        return None
+    magic, fmt, flags, http_port, device_id, version, uptime, active, total, _ = BEACON.unpack_from(data)
+    if magic != MAGIC or fmt != 1:
+        return None
+    return {
+        "id": "%06x" % device_id,
+        "httpPort": http_port,
+        "stateVersion": version,
+        "uptime": uptime,
+        "activeTimers": active,
+        "totalTimers": total,
+        "timeValid": bool(flags & 0x01),
+    }
+
+
+def listen(args):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    sock.bind(("", PORT))
+    mreq = struct.pack("4s4s", socket.inet_aton(GROUP), socket.inet_aton("0.0.0.0"))
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_ADD_MEMBERSHIP, mreq)
+
+    devices = {}
+    beacons = fetches = 0
+    print("监听 %s:%d ..." % (GROUP, PORT))
+    while True:
+        data, (ip, _) = sock.recvfrom(64)
+        beacon = parse_beacon(data)
+        if not beacon:
+            continue
+        beacons += 1
+
+        # 设备以 ID + 端口区分（模拟设备共用主机 IP 和芯片 ID 前缀）
+        key = (beacon["id"], beacon["httpPort"])
+        known = devices.get(key)
+        changed = (known is None
+                   or known["stateVersion"] != beacon["stateVersion"]
+                   or beacon["uptime"] < known["uptime"])
+        devices[key] = beacon
+        if not changed:
+            continue
+
+        reason = "新设备" if known is None else ("重启" if beacon["uptime"] < known["uptime"] else "状态变化")
+        line = "%-8s %s:%d id=%s version=%d active=%d/%d" % (
+            reason, ip, beacon["httpPort"], beacon["id"], beacon["stateVersion"],
+            beacon["activeTimers"], beacon["totalTimers"])
+        if args.fetch:
+            url = "http://%s:%d/api/status" % (ip, beacon["httpPort"])
+            try:
+                with urllib.request.urlopen(url, timeout=3) as resp:
+                    status = json.loads(resp.read())
+                fetches += 1
+                line += " -> 已获取 /api/status (version=%s)" % status.get("stateVersion")
+            except OSError as e:
+                line += " -> 获取失败: %s" % e
+        print(line)
+        print("  设备 %d 台，信标 %d 个，状态请求 %d 次" % (len(devices), beacons, fetches))
+
+
+class SimulatedDevice:
+    def __init__(self, index, http_port):
+        self.device_id = 0xF00000 + index
+        self.http_port = http_port
+        self.version = 0
+        self.total = random.randint(1, 6)
+        self.active = 0
+        self.started = time.monotonic()
+        self.lock = threading.Lock()
+
+    def status(self):
+        with self.lock:
+            return {
+                "wifiConnected": True,
+                "hasValidTime": True,
+                "activeTimers": self.active,
+                "totalTimers": self.total,
+                "stateVersion": self.version,
+            }
+
+    def change(self):
+        with self.lock:
+            self.active = random.randint(0, self.total)
+            self.version += 1
+
+    def beacon(self):
+        with self.lock:
+            return BEACON.pack(MAGIC, 1, 0x01, self.http_port, self.device_id, self.version,
+                               int(time.monotonic() - self.started), self.active, self.total, 0)
+
+
+def serve_status(device):
+    class Handler(BaseHTTPRequestHandler):
+        def do_GET(self):
+            if self.path != "/api/status":
+                self.send_error(404)
+                return
+            body = json.dumps(device.status()).encode()
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            self.send_header("Content-Length", str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, *args):
+            pass
+
+    server = ThreadingHTTPServer(("0.0.0.0", device.http_port), Handler)
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+
+def simulate(args):
+    devices = [SimulatedDevice(i, args.base_port + i) for i in range(args.count)]
+    for device in devices:
+        serve_status(device)
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM, socket.IPPROTO_UDP)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_TTL, 1)
+    sock.setsockopt(socket.IPPROTO_IP, socket.IP_MULTICAST_LOOP, 1)
+
+    print("模拟 %d 台设备，HTTP 端口 %d-%d" % (args.count, args.base_port, args.base_port + args.count - 1))
+    last_beacon = {id(d): 0.0 for d in devices}
+    last_version = {id(d): -1 for d in devices}
+    while True:
+        now = time.monotonic()
+        for device in devices:
+            if random.random() < args.change_rate / 10.0:
+                device.change()
+            # 与固件相同：状态变化时尽快发送（至少间隔 1 秒），否则每 10 秒一次
+            elapsed = now - last_beacon[id(device)]
+            changed = device.version != last_version[id(device)]
+            if elapsed >= BEACON_INTERVAL or (changed and elapsed >= BEACON_MIN_GAP):
+                sock.sendto(device.beacon(), (GROUP, PORT))
+                last_beacon[id(device)] = now
+                last_version[id(device)] = device.version
+        time.sleep(0.1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="PetIO 设备发现")
+    sub = parser.add_subparsers(dest="command", required=True)
+    p = sub.add_parser("listen", help="监听状态信标")
+    p.add_argument("--fetch", action="store_true", help="状态变化时请求 /api/status")
+    p.set_defaults(func=listen)
+    p = sub.add_parser("simulate", help="模拟多台设备")
+    p.add_argument("-n", "--count", type=int, default=3)
+    p.add_argument("--base-port", type=int, default=8081)
+    p.add_argument("--change-rate", type=float, default=0.2, help="每台设备每秒状态变化的概率")
+    p.set_defaults(func=simulate)
+    args = parser.parse_args()
+    try:
+        args.func(args)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
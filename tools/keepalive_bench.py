@@ -0,0 +1,172 @@
+"""
+持久连接基准：对同一个接口分别用“每请求新建连接”、“持久连接”和“流水线”三种方式请求，
+比较单客户端的每秒请求数，并打印设备端 /api/system 中的连接复用统计
+
+设备按 IP 限速（config.h 中的 ADMISSION_CLIENT_RATE，默认每秒 10 个），超出返回 429 并断开连接，
+所以请求按 --rate 限速发出（默认每秒 8 个），每秒请求数按扣除限速等待后的实际耗时计算。
+返回 429/503 的请求不计入完成数，单独统计；其他非 200 状态直接退出。
+
+用法：python3 tools/keepalive_bench.py 192.168.1.100 [-n 200] [--path /api/status] [--rate 8]
+"""
+
+import argparse
+import http.client
+import io
+import json
+import socket
+import sys
+import time
+
+REJECTED = (429, 503)
+
+
+class Pacer:
+    """按固定速率发请求，并记录等待时间，以便从总耗时中扣除"""
+
+    def __init__(self, rate):
+        self.interval = 1.0 / rate if rate > 0 else 0.0
+        self.next = time.monotonic()
+        self.waited = 0.0
+
+    def wait(self, requests=1):
+        now = time.monotonic()
+        if now < self.next:
+            time.sleep(self.next - now)
+            self.waited += self.next - now
+            now = self.next
+        self.next = now + self.interval * requests
+
+
+class Result:
+    def __init__(self, pacer):
+        self.pacer = pacer
+        self.waited_before = pacer.waited
+        self.ok = 0
+        self.rejected = 0
+        self.start = time.monotonic()
+        self.elapsed = 0.0
+
+    def check(self, resp):
+        """200 计入完成数，429/503 计入被拒绝数，返回连接是否需要重建"""
+        if resp.status == 200:
+            self.ok += 1
+        elif resp.status in REJECTED:
+            self.rejected += 1
+            return True
+        else:
+            sys.exit("请求失败: HTTP %d %s" % (resp.status, resp.reason))
+        return resp.getheader("Connection", "").lower() == "close"
+
+    def finish(self):
+        waited = self.pacer.waited - self.waited_before
+        self.elapsed = time.monotonic() - self.start - waited
+        return self
+
+    def rate(self):
+        return self.ok / self.elapsed if self.elapsed > 0 else 0.0
+
+
+def new_connection_per_request(host, path, count, pacer):
+    result = Result(pacer)
+    for _ in range(count):
+        pacer.wait()
+        conn = http.client.HTTPConnection(host, 80, timeout=10)
+        conn.request("GET", path, headers={"Connection": "close"})
+        resp = conn.getresponse()
+        resp.read()
+        result.check(resp)
+        conn.close()
+    return result.finish()
+
+
+def persistent_connection(host, path, count, pacer):
+    result = Result(pacer)
+    conn = http.client.HTTPConnection(host, 80, timeout=10)
+    for _ in range(count):
+        pacer.wait()
+        conn.request("GET", path)
+        resp = conn.getresponse()
+        resp.read()
+        if result.check(resp):
+            # 服务器达到单连接请求上限、有其他客户端排队或拒绝请求时会关闭连接
+            conn.close()
+            conn = http.client.HTTPConnection(host, 80, timeout=10)
+    result.finish()
+    conn.close()
+    return result
+
+
+class SharedReader(io.BufferedReader):
+    """让同一连接上的多个 HTTPResponse 共用一个缓冲区，避免预读走后面的响应。
+    HTTPResponse 读完响应后会关闭文件，这里忽略，连接由调用方关闭"""
+
+    def __init__(self, sock):
+        super().__init__(socket.SocketIO(sock, "rb"))
+
+    def makefile(self, mode):
+        return self
+
+    def close(self):
+        pass
+
+
+def pipelined(host, path, count, pacer, depth=4):
+    """一次发出 depth 个请求再依次读取响应"""
+    request = ("GET %s HTTP/1.1\r\nHost: %s\r\n\r\n" % (path, host)).encode()
+    result = Result(pacer)
+    sock = socket.create_connection((host, 80), timeout=10)
+    reader = SharedReader(sock)
+    done = 0
+    while done < count:
+        batch = min(depth, count - done)
+        pacer.wait(batch)
+        sock.sendall(request * batch)
+        for _ in range(batch):
+            resp = http.client.HTTPResponse(reader)
+            resp.begin()
+            resp.read()
+            done += 1
+            if result.check(resp):
+                sock.close()
+                sock = socket.create_connection((host, 80), timeout=10)
+                reader = SharedReader(sock)
+                # 本批剩余的请求随旧连接丢失，按已处理数量继续
+                break
+    result.finish()
+    sock.close()
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description="PetIO HTTP 持久连接基准")
+    parser.add_argument("host")
+    parser.add_argument("-n", "--count", type=int, default=200)
+    parser.add_argument("--path", default="/api/status")
+    parser.add_argument("--rate", type=float, default=8,
+                        help="每秒最多发出的请求数，应低于设备的 ADMISSION_CLIENT_RATE（0 为不限速）")
+    args = parser.parse_args()
+
+    pacer = Pacer(args.rate)
+    base = new_connection_per_request(args.host, args.path, args.count, pacer)
+    keep = persistent_connection(args.host, args.path, args.count, pacer)
+    pipe = pipelined(args.host, args.path, args.count, pacer)
+
+    for name, result in (("每请求新建连接", base), ("持久连接      ", keep), ("流水线        ", pipe)):
+        ratio = result.rate() / base.rate() if base.rate() > 0 else 0.0
+        print("%s: %6.1f 请求/秒 (%.1fx)，完成 %d，被拒绝 %d"
+              % (name, result.rate(), ratio, result.ok, result.rejected))
+    if base.rejected or keep.rejected or pipe.rejected:
+        print("有请求返回 429/503（不计入完成数，但耗时计入），请降低 --rate 后重新测试")
+
+    pacer.wait()
+    conn = http.client.HTTPConnection(args.host, 80, timeout=10)
+    conn.request("GET", "/api/system", headers={"Connection": "close"})
+    resp = conn.getresponse()
+    if resp.status != 200:
+        sys.exit("读取 /api/system 失败: HTTP %d" % resp.status)
+    stats = json.loads(resp.read()).get("connections", {})
+    print("设备端连接统计: " + json.dumps(stats, ensure_ascii=False))
+
+
+if __name__ == "__main__":
+    main()
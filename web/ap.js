@@ -0,0 +1,92 @@
+function showMessage(message, type = 'info') {
+    const messageDiv = document.getElementById('wifi-message');
+    messageDiv.className = `alert alert-${type}`;
+    messageDiv.textContent = message;
+    messageDiv.classList.remove('hidden');
+    
+    if (type === 'success') {
+        setTimeout(() => {
+            messageDiv.classList.add('hidden');
+        }, 3000);
+    }
+}
+
+async function saveWiFi(event) {
+    event.preventDefault();
+    
+    const ssid = document.getElementById('wifi-ssid').value.trim();
+    const password = document.getElementById('wifi-password').value;
+    
+    if (!ssid) {
+        showMessage('请输入WiFi网络名称', 'error');
+        return;
+    }
+    
+    try {
+        showMessage('正在连接WiFi，请稍候...', 'info');
+        
+        const result = await submitWiFi(ssid, password);
+        
+        if (result.success) {
+            showMessage('WiFi配置已保存！设备正在重启并连接网络...', 'success');
+            // 15秒后尝试重定向到设备的新IP
+            setTimeout(() => {
+                if (result.ip) {
+                    window.location.href = `http://${result.ip}`;
+                } else {
+                    window.location.reload();
+                }
+            }, 15000);
+        } else {
+            showMessage(result.message || 'WiFi配置失败，请检查网络名称和密码', 'error');
+        }
+    } catch (error) {
+        console.error('WiFi配置错误:', error);
+        showMessage('网络错误，请重试', 'error');
+    }
+}
+
+async function restartAP() {
+    try {
+        showMessage('正在重启为热点模式...', 'info');
+        
+        const response = await fetch('/api/restart-ap', {
+            method: 'POST'
+        });
+        
+        if (response.ok) {
+            showMessage('设备正在重启为热点模式...', 'success');
+            setTimeout(() => {
+                window.location.reload();
+            }, 5000);
+        } else {
+            showMessage('重启失败，请重试', 'error');
+        }
+    } catch (error) {
+        console.error('重启错误:', error);
+        showMessage('网络错误，请重试', 'error');
+    }
+}
+
+// 页面加载时检查连接状态
+document.addEventListener('DOMContentLoaded', function() {
+    // 定期检查是否已连接WiFi
+    const checkConnection = async () => {
+        try {
+            const response = await fetch('/api/status');
+            const status = await response.json();
+            
+            if (status.wifiConnected) {
+                showMessage('WiFi连接成功！正在跳转到完整界面...', 'success');
+                setTimeout(() => {
+                    window.location.href = '/';
+                }, 2000);
+            }
+        } catch (error) {
+            // 忽略错误，继续检查
+        }
+    };
+    
+    // 每5秒检查一次连接状态
+    setInterval(checkConnection, 5000);
+});
@@ -0,0 +1,16 @@
+// AP 设置页和控制面板共用的脚本，构建时作为独立的带哈希资源输出，浏览器只需下载一次
+
+// 以 JSON 提交请求体
+function requestJSON(url, data, method = 'POST') {
+    return fetch(url, {
+        method,
+        headers: {'Content-Type': 'application/json'},
+        body: JSON.stringify(data)
+    });
+}
+
+// 保存 WiFi 凭据，返回服务器的 JSON 响应
+async function submitWiFi(ssid, password) {
+    const response = await requestJSON('/api/wifi', {ssid, password});
+    return response.json();
+}
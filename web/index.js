@@ -0,0 +1,777 @@
+let currentData = {
+    timers: [],
+    pins: [],
+    systemInfo: null
+};
+
+let isLoadingData = false;
+
+// --- Class definitions for styling ---
+const activeTabClasses = ['active', 'text-indigo-600', 'font-semibold'];
+const inactiveTabClasses = ['text-gray-500', 'hover:text-gray-700'];
+const baseTabClasses = ['py-3', 'px-4', 'text-sm', 'font-medium', 'text-center', 'border-b-2', 'border-transparent', 'transition-colors', 'whitespace-nowrap'];
+
+document.addEventListener('DOMContentLoaded', function() {
+    // Initialize tabs with base classes
+    document.querySelectorAll('.tab').forEach(tab => {
+        tab.classList.add(...baseTabClasses);
+        if (!tab.classList.contains('active')) {
+            tab.classList.add(...inactiveTabClasses);
+        }
+    });
+    
+    // Set current time as default for timer
+    setCurrentTimeAsDefault();
+    
+    loadData();
+    // 使用异步轮询替代 setInterval
+    startPolling();
+});
+
+function setCurrentTimeAsDefault() {
+    const now = new Date();
+    const hours = String(now.getHours()).padStart(2, '0');
+    const minutes = String(now.getMinutes()).padStart(2, '0');
+    const currentTime = `${hours}:${minutes}`;
+    document.getElementById('timer-time').value = currentTime;
+}
+
+function startPolling() {
+    async function poll() {
+        if (!isLoadingData) {
+            await loadData();
+        }
+        // 等待5秒后再次轮询
+        setTimeout(poll, 5000);
+    }
+    poll();
+}
+
+function switchTab(tabName, clickedTab) {
+    document.querySelectorAll('.tab-content').forEach(content => content.classList.add('hidden'));
+    document.querySelectorAll('.tab').forEach(tab => {
+        tab.classList.remove(...activeTabClasses, 'active');
+        tab.classList.add(...inactiveTabClasses);
+    });
+    
+    document.getElementById(tabName + '-content').classList.remove('hidden');
+    clickedTab.classList.add(...activeTabClasses);
+    clickedTab.classList.remove(...inactiveTabClasses);
+    
+    if (tabName === 'system') {
+        loadSystemInfo();
+    }
+}
+
+async function loadData() {
+    if (isLoadingData) {
+        return; // 如果正在加载，直接返回
+    }
+    
+    isLoadingData = true;
+    try {
+        const [statusRes, timersRes, pinsRes] = await Promise.all([
+            fetch('/api/status'),
+            fetch('/api/timers'),
+            fetch('/api/pins')
+        ]);
+        const status = await statusRes.json();
+        const timers = await timersRes.json();
+        const pins = await pinsRes.json();
+
+        currentData.timers = timers;
+        currentData.pins = pins;
+
+        updateStatus(status);
+        updateTimersList();
+        updatePinsList();
+        updatePinSelects();
+
+        if (document.getElementById('system-content').offsetParent !== null) {
+            await loadSystemInfo();
+        }
+    } catch (error) {
+        console.error('加载数据失败:', error);
+        document.getElementById('connection-status').innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-red-100 text-red-800">加载失败</span>`;
+    } finally {
+        isLoadingData = false;
+    }
+}
+
+async function loadSystemInfo() {
+    try {
+        const response = await fetch('/api/system');
+        const systemInfo = await response.json();
+        currentData.systemInfo = systemInfo;
+        updateSystemInfo(systemInfo);
+    } catch (error) {
+        console.error('加载系统信息失败:', error);
+    }
+}
+
+function updateStatus(status) {
+    const statusElement = document.getElementById('connection-status');
+    const apNotice = document.getElementById('ap-mode-notice');
+    const timerRelated = ['timer-form', 'timer-list-container'];
+
+    if (status.wifiConnected) {
+        statusElement.innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-green-100 text-green-800">✅ WiFi: ${status.localIP}</span>`;
+        apNotice.classList.add('hidden');
+        timerRelated.forEach(id => document.getElementById(id).style.opacity = 1);
+    } else {
+        statusElement.innerHTML = `<span class="inline-flex items-center px-2.5 py-0.5 rounded-full bg-yellow-100 text-yellow-800">📶 AP: ${status.apIP}</span>`;
+        apNotice.classList.remove('hidden');
+        timerRelated.forEach(id => document.getElementById(id).style.opacity = 0.5);
+    }
+    
+    const timeInfo = status.hasValidTime ? `🕐 ${status.currentTime}` : `🕐 时间未同步`;
+    document.getElementById('device-info').innerHTML = `${timeInfo} | 活跃定时器: ${status.activeTimers || 0}`;
+}
+
+function updateTimersList() {
+    const list = document.getElementById('timer-list');
+    if (currentData.timers.length === 0) {
+        list.innerHTML = '<div class="text-center p-10 text-gray-500">暂无定时器</div>';
+        return;
+    }
+    list.innerHTML = currentData.timers.map((timer, index) => {
+        const statusText = timer.isActive ? '🔴 运行中' : (timer.enabled ? '⏰ 等待中' : '⏸️ 已禁用');
+        const statusColor = timer.isActive ? 'text-red-600' : (timer.enabled ? 'text-blue-600' : 'text-gray-500');
+        const cardBorder = timer.isActive ? 'border-red-300' : (timer.enabled ? 'border-blue-300' : 'border-gray-200');
+        
+        return `
+        <div class="border ${cardBorder} rounded-lg p-4 flex flex-col sm:flex-row justify-between items-start sm:items-center transition-all hover:shadow-md hover:border-indigo-300 ${!timer.enabled ? 'opacity-60' : ''}">
+            <div class="grid grid-cols-2 sm:grid-cols-3 md:grid-cols-6 gap-x-4 gap-y-2 text-sm w-full">
+                <div class="font-bold text-gray-800 col-span-2 sm:col-span-1">📌 引脚 ${timer.pin}</div>
+                <div class="flex items-center">⏰ ${timer.hour.toString().padStart(2, '0')}:${timer.minute.toString().padStart(2, '0')}</div>
+                <div class="flex items-center">⏳ ${timer.duration}秒</div>
+                <div class="flex items-center">${timer.repeatDaily ? '🔄 每天' : '📅 单次'}</div>
+                <div class="flex items-center">${timer.isPWM ? `🔧 PWM ${Math.round((timer.pwmValue / 1023) * 100)}%` : '🔌 数字'}</div>
+                <div class="flex items-center font-semibold ${statusColor}">${statusText}</div>
+            </div>
+            <div class="flex space-x-2 mt-3 sm:mt-0 sm:ml-4 flex-shrink-0">
+                <div class="relative">
+                    <button id="timer-menu-${index}" class="text-xs font-semibold py-1 px-3 rounded-md bg-gray-100 text-gray-700 hover:bg-gray-200 transition-colors" onclick="toggleTimerMenu(${index})">
+                        ⚙️ 操作
+                    </button>
+                    <div id="timer-dropdown-${index}" class="absolute right-0 mt-1 w-32 bg-white rounded-md shadow-lg border border-gray-200 z-10 hidden">
+                        <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 ${timer.enabled ? 'text-amber-800' : 'text-green-800'}" onclick="toggleTimer(${index}); hideTimerMenu(${index})">${timer.enabled ? '🚫 禁用' : '✅ 启用'}</button>
+                        <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 text-blue-800" onclick="editTimer(${index}); hideTimerMenu(${index})">✏️ 修改</button>
+                        <button class="w-full text-left px-3 py-2 text-xs hover:bg-gray-50 text-red-800" onclick="deleteTimer(${index}); hideTimerMenu(${index})">🗑️ 删除</button>
+                    </div>
+                </div>
+            </div>
+        </div>`;
+    }).join('');
+}
+
+function updatePinsList() {
+    const grid = document.getElementById('pins-grid');
+    if (currentData.pins.length === 0) {
+        grid.innerHTML = '<p class="text-gray-500 col-span-full">没有可用的引脚</p>';
+        return;
+    }
+    grid.innerHTML = currentData.pins.map(pin => {
+        let stateClass = 'bg-white hover:bg-gray-100';
+        if (pin.inUse) stateClass = 'bg-yellow-100 text-yellow-800 border-yellow-300';
+        else if (pin.state) stateClass = 'bg-red-100 text-red-800 border-red-300';
+        
+        return `
+        <div class="border-2 rounded-lg p-3 text-center cursor-pointer transition-all ${stateClass}" onclick="togglePin(${pin.pin})" title="点击切换状态">
+            <div class="font-bold text-lg">${pin.pin}</div>
+            <div class="text-2xl">${pin.state ? '🔴' : '⚫'}</div>
+            ${pin.inUse ? '<div class="text-xs font-semibold">占用</div>' : '<div class="text-xs text-gray-400">空闲</div>'}
+        </div>`;
+    }).join('');
+}
+
+function updatePinSelects() {
+    const selects = ['timer-pin', 'manual-pin'];
+    const options = currentData.pins.map(pin => `<option value="${pin.pin}">引脚 ${pin.pin}</option>`).join('');
+    selects.forEach(id => {
+        const select = document.getElementById(id);
+        const currentValue = select.value;
+        select.innerHTML = `<option value="">选择引脚</option>${options}`;
+        if (currentValue) select.value = currentValue;
+    });
+}
+
+function updateSystemInfo(info) {
+    document.getElementById('chip-id').textContent = info.chipId || '未知';
+    document.getElementById('cpu-freq').textContent = `${info.cpuFreqMHz || 0} MHz`;
+    document.getElementById('flash-size').textContent = formatBytes(info.flashChipSize || 0);
+    document.getElementById('free-heap').textContent = formatBytes(info.freeHeap || 0);
+    document.getElementById('heap-frag').textContent = `${info.heapFragmentation || 0}%`;
+    document.getElementById('uptime').textContent = `${info.uptimeDays || 0}天 ${info.uptimeHours || 0}:${String(info.uptimeMinutes || 0).padStart(2, '0')}:${String(info.uptimeSeconds || 0).padStart(2, '0')}`;
+    
+    updateWiFiDetails(info.wifi || {});
+    updateTimeDetails(info.time || {});
+    updateTimerStats(info.timerStats || {});
+    updateStorageDetails(info);
+    updatePinDetails(info.pins || []);
+}
+
+function createInfoCard(label, value) {
+    return `<div class="bg-gray-50 p-4 rounded-lg border border-gray-200">
+                <label class="block text-xs text-gray-500 font-medium mb-1">${label}</label>
+                <span class="text-base font-semibold text-gray-800">${value}</span>
+            </div>`;
+}
+
+function updateWiFiDetails(wifi) {
+    const container = document.getElementById('wifi-details');
+    let html = createInfoCard('连接状态', `<span class="inline-block w-2 h-2 rounded-full mr-2 ${wifi.status === 3 ? 'bg-green-500' : 'bg-red-500'}"></span>${wifi.statusText || '未知'}`)
+             + createInfoCard('工作模式', wifi.modeText || '未知');
+    if (wifi.ssid) {
+        html += createInfoCard('网络名称', wifi.ssid)
+              + createInfoCard('信号强度', `${wifi.rssi} dBm`)
+              + createInfoCard('本地 IP', wifi.localIP)
+              + createInfoCard('MAC 地址', wifi.macAddress);
+    }
+    if (wifi.apSSID) {
+        html += createInfoCard('AP 名称', wifi.apSSID)
+              + createInfoCard('AP IP', wifi.apIP)
+              + createInfoCard('连接设备数', wifi.apStationCount || 0);
+    }
+    container.innerHTML = html;
+}
+
+function updateTimeDetails(time) {
+    document.getElementById('time-details').innerHTML = 
+        createInfoCard('同步状态', `<span class="inline-block w-2 h-2 rounded-full mr-2 ${time.hasValidTime ? 'bg-green-500' : 'bg-yellow-500'}"></span>${time.hasValidTime ? '已同步' : '未同步'}`)
+      + createInfoCard('时间源', time.timeSource || '未知')
+      + createInfoCard('当前时间', time.currentTime || '未知')
+      + createInfoCard('当前日期', time.currentDate || '未知');
+}
+
+function updateTimerStats(stats) {
+    const usage = Math.round((stats.total || 0) / (stats.maxTimers || 1) * 100);
+    document.getElementById('timer-stats').innerHTML = 
+        createInfoCard('总数', `${stats.total || 0} / ${stats.maxTimers || 0}`)
+      + createInfoCard('使用率', `${usage}%`)
+      + createInfoCard('已启用', stats.enabled || 0)
+      + createInfoCard('运行中', stats.active || 0);
+}
+
+function updateStorageDetails(info) {
+    const eeprom = info.eeprom || {};
+    const eepromUsage = Math.round((eeprom.timerConfigUsed || 0) / (eeprom.size || 1) * 100);
+    document.getElementById('storage-details').innerHTML = 
+        createInfoCard('程序大小', formatBytes(info.sketchSize || 0))
+      + createInfoCard('可用空间', formatBytes(info.freeSketchSpace || 0))
+      + createInfoCard('EEPROM大小', `${eeprom.size || 0} 字节`)
+      + createInfoCard('配置已用', `${eeprom.timerConfigUsed || 0} 字节 (${eepromUsage}%)`)
+      + createInfoCard('重启原因', info.resetReason || '未知');
+}
+
+function updatePinDetails(pins) {
+    document.getElementById('pin-details').innerHTML = pins.map(pin => {
+        let stateClass = 'bg-gray-100 border-gray-200';
+        if (pin.inUse) stateClass = 'bg-yellow-100 border-yellow-300';
+        else if (pin.state) stateClass = 'bg-red-100 border-red-300';
+        return `<div class="p-2 text-center rounded-md border ${stateClass}">
+                    <div class="font-bold text-sm">${pin.pin}</div>
+                    <div class="text-xs">${pin.inUse ? (pin.timerId >= 0 ? `🔒 #${pin.timerId}${pin.owners > 1 ? ` ×${pin.owners}` : ''}` : '🔒 手动') : (pin.state ? 'ON' : 'OFF')}</div>
+                </div>`;
+    }).join('');
+}
+
+function formatBytes(bytes) {
+    if (bytes === 0) return '0 B';
+    const k = 1024;
+    const sizes = ['B', 'KB', 'MB', 'GB'];
+    const i = Math.floor(Math.log(bytes) / Math.log(k));
+    return `${parseFloat((bytes / Math.pow(k, i)).toFixed(2))} ${sizes[i]}`;
+}
+
+async function addTimer() {
+    const pin = document.getElementById('timer-pin').value;
+    const timeValue = document.getElementById('timer-time').value;
+    const duration = document.getElementById('timer-duration').value;
+    const repeatDaily = document.getElementById('timer-repeat').checked;
+    const isPWM = document.getElementById('timer-pwm-mode').checked;
+    const pwmValue = document.getElementById('timer-pwm-value').value;
+    
+    if (!pin || !timeValue || !duration) {
+        showMessage('timer-message', '请填写完整信息', 'error');
+        return;
+    }
+    
+    const [hour, minute] = timeValue.split(':').map(Number);
+    
+    try {
+        const body = { 
+            pin: parseInt(pin), 
+            hour, 
+            minute, 
+            duration: parseFloat(duration), 
+            repeatDaily,
+            isPWM: isPWM,
+            pwmValue: parseInt(pwmValue)
+        };
+        
+        const response = await requestJSON('/api/timers', body);
+        const result = await response.json();
+        if (result.success) {
+            showMessage('timer-message', '定时器添加成功！', 'success');
+            loadData();
+        } else {
+            showMessage('timer-message', result.message || '添加失败', 'error');
+        }
+    } catch (error) {
+        showMessage('timer-message', '请求失败', 'error');
+    }
+}
+
+async function deleteTimer(index) {
+    if (!confirm('确定要删除这个定时器吗？')) return;
+    try {
+        const response = await fetch(`/api/timers/${currentData.timers[index].id}`, {method: 'DELETE'});
+        if (response.ok) loadData();
+        else alert('删除失败');
+    } catch (error) {
+        alert('请求失败');
+    }
+}
+
+async function toggleTimer(index) {
+    const timer = currentData.timers[index];
+    try {
+        const response = await requestJSON(`/api/timers/${timer.id}`, { ...timer, enabled: !timer.enabled }, 'PUT');
+        if (response.ok) loadData();
+        else alert('操作失败');
+    } catch (error) {
+        alert('请求失败');
+    }
+}
+
+async function clearAllTimers() {
+    if (!confirm('确定要清除所有定时器吗？此操作不可恢复！')) return;
+    try {
+        const response = await fetch('/api/timers/clear', {method: 'POST'});
+        if (response.ok) {
+            showMessage('timer-message', '所有定时器已清除', 'success');
+            loadData();
+        } else {
+            showMessage('timer-message', '清除失败', 'error');
+        }
+    } catch (error) {
+        showMessage('timer-message', '请求失败', 'error');
+    }
+}
+
+async function manualControl() {
+    const pin = document.getElementById('manual-pin').value;
+    const duration = document.getElementById('manual-duration').value;
+    const isPWM = document.getElementById('manual-pwm-mode').checked;
+    const pwmValue = document.getElementById('manual-pwm-value').value;
+    
+    if (!pin) {
+        showMessage('manual-message', '请选择引脚', 'error');
+        return;
+    }
+    try {
+        const body = { 
+            pin: parseInt(pin), 
+            duration: parseFloat(duration) || 0,
+            isPWM: isPWM,
+            pwmValue: parseInt(pwmValue)
+        };
+        
+        const response = await requestJSON('/api/manual', body);
+        const result = await response.json();
+        if (result.success) {
+            showMessage('manual-message', '控制命令执行成功', 'success');
+            loadData();
+        } else {
+            showMessage('manual-message', `控制失败: ${result.message || '未知错误'}`, 'error');
+        }
+    } catch (error) {
+        showMessage('manual-message', '请求失败', 'error');
+    }
+}
+
+async function togglePin(pin) {
+    try {
+        const response = await requestJSON('/api/manual', {
+            pin: pin, 
+            duration: 0,
+            isPWM: false,
+            pwmValue: 0
+        });
+        if (response.ok) {
+            loadData();
+        }
+    } catch (error) {
+        console.error('引脚切换失败:', error);
+    }
+}
+
+async function saveWiFi() {
+    const ssid = document.getElementById('wifi-ssid').value;
+    const password = document.getElementById('wifi-password').value;
+    if (!ssid) {
+        showMessage('wifi-message', '请输入 WiFi 名称', 'error');
+        return;
+    }
+    showMessage('wifi-message', '正在保存设置...', 'info');
+    try {
+        const result = await submitWiFi(ssid, password);
+        if (result.success) {
+            showMessage('wifi-message', 'WiFi 设置已保存，设备将重启并尝试连接...', 'success');
+            setTimeout(() => window.location.reload(), 3000);
+        } else {
+            showMessage('wifi-message', `设置失败: ${result.message || '未知错误'}`, 'error');
+        }
+    } catch (error) {
+        showMessage('wifi-message', '请求失败', 'error');
+    }
+}
+
+async function restartAP() {
+    if (!confirm('确定要重启为 AP 模式吗？设备将断开当前 WiFi 连接。')) return;
+    showMessage('wifi-message', '正在重启...', 'info');
+    try {
+        const response = await fetch('/api/wifi/reset', {method: 'POST'});
+        if (response.ok) {
+            showMessage('wifi-message', '设备将重启为 AP 模式...', 'success');
+            setTimeout(() => window.location.reload(), 3000);
+        }
+    } catch (error) {
+        showMessage('wifi-message', '请求失败', 'error');
+    }
+}
+
+function togglePWMMode() {
+    const pwmControls = document.getElementById('pwm-controls');
+    const isPWMMode = document.getElementById('manual-pwm-mode').checked;
+    
+    if (isPWMMode) {
+        pwmControls.classList.remove('hidden');
+    } else {
+        pwmControls.classList.add('hidden');
+    }
+}
+
+function updatePWMPercentage(value) {
+    const percentage = Math.round((value / 1023) * 100);
+    document.getElementById('pwm-percentage').textContent = percentage + '%';
+}
+
+function toggleTimerPWMMode() {
+    const pwmControls = document.getElementById('timer-pwm-controls');
+    const isPWMMode = document.getElementById('timer-pwm-mode').checked;
+    
+    if (isPWMMode) {
+        pwmControls.classList.remove('hidden');
+    } else {
+        pwmControls.classList.add('hidden');
+    }
+}
+
+function updateTimerPWMPercentage(value) {
+    const percentage = Math.round((value / 1023) * 100);
+    document.getElementById('timer-pwm-percentage').textContent = percentage + '%';
+}
+
+// 固件更新相关函数
+document.addEventListener('DOMContentLoaded', function() {
+    const fileInput = document.getElementById('firmware-file');
+    const uploadBtn = document.getElementById('upload-btn');
+    
+    if (fileInput && uploadBtn) {
+        fileInput.addEventListener('change', function() {
+            const file = this.files[0];
+            if (file) {
+                if (file.size > 2 * 1024 * 1024) { // 2MB限制
+                    showMessage('firmware-message', '文件大小不能超过 2MB', 'error');
+                    this.value = '';
+                    uploadBtn.disabled = true;
+                    return;
+                }
+                const name = file.name.toLowerCase();
+                if (!name.endsWith('.bin') && !name.endsWith('.bin.gz')) {
+                    showMessage('firmware-message', '请选择 .bin 或 .bin.gz 格式的固件文件', 'error');
+                    this.value = '';
+                    uploadBtn.disabled = true;
+                    return;
+                }
+                uploadBtn.disabled = false;
+                showMessage('firmware-message', `已选择文件: ${file.name} (${(file.size / 1024).toFixed(1)} KB)`, 'info');
+            } else {
+                uploadBtn.disabled = true;
+            }
+        });
+    }
+    
+    // 加载当前固件信息
+    loadFirmwareInfo();
+});
+
+async function loadFirmwareInfo() {
+    try {
+        const response = await fetch('/api/system');
+        if (response.ok) {
+            const data = await response.json();
+            document.getElementById('current-version').textContent = data.firmwareVersion || 'v1.0.0';
+            document.getElementById('build-time').textContent = data.buildDateTime || '未知';
+            document.getElementById('firmware-chip-id').textContent = data.chipId || '未知';
+        }
+    } catch (error) {
+        console.error('加载固件信息失败:', error);
+    }
+}
+
+async function startFirmwareUpdate() {
+    const fileInput = document.getElementById('firmware-file');
+    const file = fileInput.files[0];
+    
+    if (!file) {
+        showMessage('firmware-message', '请先选择固件文件', 'error');
+        return;
+    }
+    
+    if (!confirm('确定要更新固件吗？更新过程中请勿断电，设备将自动重启。')) {
+        return;
+    }
+    
+    const uploadBtn = document.getElementById('upload-btn');
+    const progressDiv = document.getElementById('upload-progress');
+    const progressBar = document.getElementById('progress-bar');
+    const progressText = document.getElementById('progress-text');
+    
+    // 禁用上传按钮并显示进度条
+    uploadBtn.disabled = true;
+    progressDiv.classList.remove('hidden');
+    progressBar.style.width = '0%';
+    progressText.textContent = '正在上传固件...';
+    
+    const formData = new FormData();
+    formData.append('firmware', file);
+    
+    console.log('开始上传固件文件:', file.name, file.size, 'bytes');
+    
+    try {
+        const xhr = new XMLHttpRequest();
+        
+        // 监听上传进度
+        xhr.upload.onprogress = function(e) {
+            if (e.lengthComputable) {
+                const percentComplete = Math.round((e.loaded / e.total) * 100);
+                progressBar.style.width = percentComplete + '%';
+                progressText.textContent = `上传中... ${percentComplete}%`;
+            }
+        };
+        
+        // 监听状态变化
+        xhr.onreadystatechange = function() {
+            if (xhr.readyState === XMLHttpRequest.DONE) {
+                if (xhr.status === 200) {
+                    progressBar.style.width = '100%';
+                    progressText.textContent = '上传完成，正在刷写固件...';
+                    try {
+                        const result = JSON.parse(xhr.responseText);
+                        if (result.bytesPerSecond) {
+                            console.log(`固件写入 ${result.bytes} 字节，平均 ${(result.bytesPerSecond / 1024).toFixed(1)} KB/s`);
+                        }
+                    } catch (e) {}
+                    showMessage('firmware-message', '固件上传成功，正在更新...请等待设备重启', 'success');
+                    
+                    // 模拟刷写进度
+                    setTimeout(() => {
+                        progressText.textContent = '固件更新中，请稍候...';
+                    }, 1000);
+                    
+                    setTimeout(() => {
+                        progressText.textContent = '更新完成，设备即将重启...';
+                        showMessage('firmware-message', '固件更新完成！设备将在几秒钟后重启', 'success');
+                    }, 3000);
+                    
+                    setTimeout(() => {
+                        window.location.reload();
+                    }, 8000);
+                } else {
+                    console.error('上传失败，状态码:', xhr.status);
+                    let errorMessage = '未知错误';
+                    try {
+                        const response = JSON.parse(xhr.responseText);
+                        errorMessage = response.message || errorMessage;
+                    } catch (e) {
+                        errorMessage = `服务器错误 (${xhr.status})`;
+                    }
+                    showMessage('firmware-message', `更新失败: ${errorMessage}`, 'error');
+                    resetUploadUI();
+                }
+            }
+        };
+        
+        xhr.onerror = function() {
+            console.error('网络错误或请求失败');
+            showMessage('firmware-message', '上传失败，请检查网络连接', 'error');
+            resetUploadUI();
+        };
+        
+        xhr.onabort = function() {
+            console.error('上传被中止');
+            showMessage('firmware-message', '上传被中止', 'error');
+            resetUploadUI();
+        };
+        
+        const md5 = document.getElementById('firmware-md5').value.trim().toLowerCase();
+        let url = `/api/firmware/update?size=${file.size}`;
+        if (md5) url += `&md5=${md5}`;
+        xhr.open('POST', url, true);
+        console.log('发送固件上传请求到:', '/api/firmware/update');
+        xhr.send(formData);
+        
+    } catch (error) {
+        console.error('固件更新失败:', error);
+        showMessage('firmware-message', '更新失败: ' + error.message, 'error');
+        resetUploadUI();
+    }
+}
+
+function resetUploadUI() {
+    const uploadBtn = document.getElementById('upload-btn');
+    const progressDiv = document.getElementById('upload-progress');
+    const fileInput = document.getElementById('firmware-file');
+    
+    uploadBtn.disabled = false;
+    progressDiv.classList.add('hidden');
+    fileInput.value = '';
+}
+
+let currentEditingTimerIndex = -1;
+
+// 定时器菜单控制函数
+function toggleTimerMenu(index) {
+    // 关闭其他菜单
+    document.querySelectorAll('[id^="timer-dropdown-"]').forEach(dropdown => {
+        if (dropdown.id !== `timer-dropdown-${index}`) {
+            dropdown.classList.add('hidden');
+        }
+    });
+    
+    const dropdown = document.getElementById(`timer-dropdown-${index}`);
+    dropdown.classList.toggle('hidden');
+}
+
+function hideTimerMenu(index) {
+    document.getElementById(`timer-dropdown-${index}`).classList.add('hidden');
+}
+
+// 点击页面其他地方关闭菜单
+document.addEventListener('click', function(event) {
+    if (!event.target.closest('[id^="timer-menu-"]')) {
+        document.querySelectorAll('[id^="timer-dropdown-"]').forEach(dropdown => {
+            dropdown.classList.add('hidden');
+        });
+    }
+});
+
+// 编辑定时器功能
+function editTimer(index) {
+    currentEditingTimerIndex = index;
+    const timer = currentData.timers[index];
+    
+    // 填充表单数据
+    updateEditPinSelect();
+    document.getElementById('edit-timer-pin').value = timer.pin;
+    document.getElementById('edit-timer-time').value = `${timer.hour.toString().padStart(2, '0')}:${timer.minute.toString().padStart(2, '0')}`;
+    document.getElementById('edit-timer-duration').value = timer.duration;
+    document.getElementById('edit-timer-repeat').checked = timer.repeatDaily;
+    document.getElementById('edit-timer-pwm-mode').checked = timer.isPWM || false;
+    document.getElementById('edit-timer-pwm-value').value = timer.pwmValue || 512;
+    
+    // 更新PWM显示
+    toggleEditTimerPWMMode();
+    updateEditTimerPWMPercentage(timer.pwmValue || 512);
+    
+    // 显示模态弹窗
+    document.getElementById('edit-timer-modal').classList.remove('hidden');
+}
+
+function closeEditModal() {
+    document.getElementById('edit-timer-modal').classList.add('hidden');
+    currentEditingTimerIndex = -1;
+    document.getElementById('edit-timer-message').classList.add('hidden');
+}
+
+function updateEditPinSelect() {
+    const select = document.getElementById('edit-timer-pin');
+    select.innerHTML = '<option value="">选择引脚</option>' +
+        currentData.pins.map(pin => `<option value="${pin.pin}">引脚 ${pin.pin}</option>`).join('');
+}
+
+async function saveTimerEdit() {
+    if (currentEditingTimerIndex === -1) return;
+    
+    const pin = document.getElementById('edit-timer-pin').value;
+    const timeValue = document.getElementById('edit-timer-time').value;
+    const duration = document.getElementById('edit-timer-duration').value;
+    const repeatDaily = document.getElementById('edit-timer-repeat').checked;
+    const isPWM = document.getElementById('edit-timer-pwm-mode').checked;
+    const pwmValue = document.getElementById('edit-timer-pwm-value').value;
+    
+    if (!pin || !timeValue || !duration) {
+        showMessage('edit-timer-message', '请填写完整信息', 'error');
+        return;
+    }
+    
+    const [hour, minute] = timeValue.split(':').map(Number);
+    
+    try {
+        const body = { 
+            pin: parseInt(pin), 
+            hour, 
+            minute, 
+            duration: parseFloat(duration), 
+            repeatDaily,
+            isPWM: isPWM,
+            pwmValue: parseInt(pwmValue)
+        };
+        
+        const response = await requestJSON(`/api/timers/${currentData.timers[currentEditingTimerIndex].id}`, body, 'PUT');
+        const result = await response.json();
+        if (result.success) {
+            showMessage('edit-timer-message', '定时器修改成功！', 'success');
+            setTimeout(() => {
+                closeEditModal();
+                loadData();
+            }, 1000);
+        } else {
+            showMessage('edit-timer-message', result.message || '修改失败', 'error');
+        }
+    } catch (error) {
+        showMessage('edit-timer-message', '请求失败', 'error');
+    }
+}
+
+function toggleEditTimerPWMMode() {
+    const pwmControls = document.getElementById('edit-timer-pwm-controls');
+    const isPWMMode = document.getElementById('edit-timer-pwm-mode').checked;
+    
+    if (isPWMMode) {
+        pwmControls.classList.remove('hidden');
+    } else {
+        pwmControls.classList.add('hidden');
+    }
+}
+
+function updateEditTimerPWMPercentage(value) {
+    const percentage = Math.round((value / 1023) * 100);
+    document.getElementById('edit-timer-pwm-percentage').textContent = percentage + '%';
+}
+
+function showMessage(elementId, message, type) {
+    const el = document.getElementById(elementId);
+    el.textContent = message;
+    const typeClasses = {
+        success: 'bg-green-50 text-green-800 border-green-200',
+        error: 'bg-red-50 text-red-800 border-red-200',
+        info: 'bg-blue-50 text-blue-800 border-blue-200'
+    };
+    el.className = `p-3 mb-4 text-sm rounded-lg border ${typeClasses[type] || typeClasses.info}`;
+    el.classList.remove('hidden');
+    setTimeout(() => el.classList.add('hidden'), 5000);
+}